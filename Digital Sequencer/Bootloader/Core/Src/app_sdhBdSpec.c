@@ -10,6 +10,9 @@
 
 GOS_STATIC gos_result_t app_sdhBdSpecRead (u32_t address, u8_t* pData, u32_t size);
 GOS_STATIC gos_result_t app_sdhBdSpecWrite (u32_t address, u8_t* pData, u32_t size);
+GOS_STATIC gos_result_t app_sdhBdSpecErase (u32_t address, u32_t size);
+GOS_STATIC gos_result_t app_sdhBdSpecReadStreamStart (u32_t address, u8_t* pData, u32_t size);
+GOS_STATIC gos_result_t app_sdhBdSpecReadStreamNext (u8_t* pData, u32_t size);
 
 GOS_STATIC drv_w25q64Descriptor_t mem01a1flash =
 {
@@ -19,12 +22,16 @@ GOS_STATIC drv_w25q64Descriptor_t mem01a1flash =
 	.readTriggerTmo  = 2000u,
 	.writeMutexTmo   = 1000u,
 	.writeTriggerTmo = 2000u,
+	.useDma          = GOS_TRUE
 };
 
 GOS_STATIC svl_sdhCfg_t sdhCfg =
 {
-	.readFunction  = app_sdhBdSpecRead,
-	.writeFunction = app_sdhBdSpecWrite
+	.readFunction            = app_sdhBdSpecRead,
+	.writeFunction           = app_sdhBdSpecWrite,
+	.eraseFunction           = app_sdhBdSpecErase,
+	.readStreamStartFunction = app_sdhBdSpecReadStreamStart,
+	.readStreamNextFunction  = app_sdhBdSpecReadStreamNext
 };
 
 gos_result_t app_sdhBdSpecInit (void_t)
@@ -67,3 +74,52 @@ GOS_STATIC gos_result_t app_sdhBdSpecWrite (u32_t address, u8_t* pData, u32_t si
 		return GOS_ERROR;
 	}
 }
+
+GOS_STATIC gos_result_t app_sdhBdSpecErase (u32_t address, u32_t size)
+{
+	drv_w25q64EraseData((void_t*)&mem01a1flash, address, size);
+
+	if ((mem01a1flash.errorFlags & (DRV_ERROR_W25Q64_MUTEX_LOCK | DRV_ERROR_W25Q64_WRITE | DRV_ERROR_W25Q64_ERASE)) == 0u)
+	{
+		return GOS_SUCCESS;
+	}
+	else
+	{
+		return GOS_ERROR;
+	}
+}
+
+GOS_STATIC gos_result_t app_sdhBdSpecReadStreamStart (u32_t address, u8_t* pData, u32_t size)
+{
+	drv_w25q64ReadStreamStart((void_t*)&mem01a1flash, address, pData, size);
+
+	if ((mem01a1flash.errorFlags & DRV_ERROR_W25Q64_READ) == 0u)
+	{
+		return GOS_SUCCESS;
+	}
+	else
+	{
+		return GOS_ERROR;
+	}
+}
+
+GOS_STATIC gos_result_t app_sdhBdSpecReadStreamNext (u8_t* pData, u32_t size)
+{
+	if (pData != NULL)
+	{
+		drv_w25q64ReadStreamNext((void_t*)&mem01a1flash, pData, size);
+	}
+	else
+	{
+		drv_w25q64ReadStreamStop((void_t*)&mem01a1flash);
+	}
+
+	if ((mem01a1flash.errorFlags & DRV_ERROR_W25Q64_READ) == 0u)
+	{
+		return GOS_SUCCESS;
+	}
+	else
+	{
+		return GOS_ERROR;
+	}
+}
@@ -58,6 +58,34 @@ drv_dmaDescriptor_t dmaConfig [] =
 	    .mode                = DMA_NORMAL,
 	    .priority            = DMA_PRIORITY_LOW,
 	    .fifoMode            = DMA_FIFOMODE_DISABLE,
+	},
+	// DMA1 stream 3 -> SPI2 RX
+	[DMA_CFG_SPI2_RX] =
+	{
+		.dmaStream           = DRV_DMA_1_STREAM_3,
+		.channel             = DMA_CHANNEL_0,
+		.direction           = DMA_PERIPH_TO_MEMORY,
+		.periphInc           = DMA_PINC_DISABLE,
+		.memInc              = DMA_MINC_ENABLE,
+		.periphDataAlignment = DMA_PDATAALIGN_BYTE,
+		.memDataAlignment    = DMA_MDATAALIGN_BYTE,
+		.mode                = DMA_NORMAL,
+		.priority            = DMA_PRIORITY_HIGH,
+		.fifoMode            = DMA_FIFOMODE_DISABLE,
+	},
+	// DMA1 stream 4 -> SPI2 TX (clocks out the dummy bytes of receptions)
+	[DMA_CFG_SPI2_TX] =
+	{
+		.dmaStream           = DRV_DMA_1_STREAM_4,
+		.channel             = DMA_CHANNEL_0,
+		.direction           = DMA_MEMORY_TO_PERIPH,
+		.periphInc           = DMA_PINC_DISABLE,
+		.memInc              = DMA_MINC_ENABLE,
+		.periphDataAlignment = DMA_PDATAALIGN_BYTE,
+		.memDataAlignment    = DMA_MDATAALIGN_BYTE,
+		.mode                = DMA_NORMAL,
+		.priority            = DMA_PRIORITY_LOW,
+		.fifoMode            = DMA_FIFOMODE_DISABLE,
 	}
 };
 
@@ -74,8 +102,8 @@ drv_dmaDescriptor_t* pDMADescriptorLut [DRV_DMA_X_STREAM_NUM] =
 	[DRV_DMA_1_STREAM_0] = &dmaConfig[DMA_CFG_UART5_RX],
 	[DRV_DMA_1_STREAM_1] = NULL,
 	[DRV_DMA_1_STREAM_2] = &dmaConfig[DMA_CFG_UART4_RX],
-	[DRV_DMA_1_STREAM_3] = NULL,
-	[DRV_DMA_1_STREAM_4] = NULL,
+	[DRV_DMA_1_STREAM_3] = &dmaConfig[DMA_CFG_SPI2_RX],
+	[DRV_DMA_1_STREAM_4] = &dmaConfig[DMA_CFG_SPI2_TX],
 	[DRV_DMA_1_STREAM_5] = NULL,
 	[DRV_DMA_1_STREAM_6] = NULL,
 	[DRV_DMA_1_STREAM_7] = NULL,
@@ -58,6 +58,16 @@ GOS_CONST drv_itDescriptor_t itConfig [] =
 		.preemtPriority = 0,
 		.subPriority    = 0
 	},
+	{
+		.irqType        = DMA1_Stream3_IRQn,
+		.preemtPriority = 0,
+		.subPriority    = 0
+	},
+	{
+		.irqType        = DMA1_Stream4_IRQn,
+		.preemtPriority = 0,
+		.subPriority    = 0
+	},
 };
 
 /**
@@ -27,7 +27,9 @@ GOS_CONST drv_spiDescriptor_t spiConfig [] =
 		.firstBit          = SPI_FIRSTBIT_MSB,
 		.tiMode            = SPI_TIMODE_DISABLE,
 		.crcCalculation    = SPI_CRCCALCULATION_DISABLE,
-		.crcPolynomial     = 10
+		.crcPolynomial     = 10,
+		.dmaConfigRx       = &dmaConfig[DMA_CFG_SPI2_RX],
+		.dmaConfigTx       = &dmaConfig[DMA_CFG_SPI2_TX]
 	}
 };
 
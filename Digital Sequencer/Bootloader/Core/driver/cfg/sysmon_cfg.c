@@ -10,10 +10,12 @@
 // TODO
 GOS_CONST svl_sysmonServiceConfig_t sysmonConfig =
 {
-	.wiredChannelNumber    = 0u,
-	.wiredTxFunction       = drv_sysmonWiredTransmit,
-	.wiredRxFunction       = drv_sysmonWiredReceive,
-	.wirelessChannelNumber = 1u,
-	.wirelessTxFunction    = drv_sysmonWirelessTransmit,
-	.wirelessRxFunction    = drv_sysmonWirelessReceive
+	.wiredChannelNumber       = 0u,
+	.wiredTxFunction          = drv_sysmonWiredTransmit,
+	.wiredTxVectorFunction    = drv_sysmonWiredTransmitVector,
+	.wiredRxFunction          = drv_sysmonWiredReceive,
+	.wirelessChannelNumber    = 1u,
+	.wirelessTxFunction       = drv_sysmonWirelessTransmit,
+	.wirelessTxVectorFunction = drv_sysmonWirelessTransmitVector,
+	.wirelessRxFunction       = drv_sysmonWirelessReceive
 };
@@ -9,6 +9,7 @@
 #include "cfg_def.h"
 #include "rcc_driver.h"
 
+#include "drv_crc.h"
 #include "drv_dma.h"
 #include "drv_gpio.h"
 #include "drv_it.h"
@@ -33,6 +34,7 @@ gos_result_t driver_init (void_t)
 	driverInitResult &= drv_dmaInit();
 	driverInitResult &= drv_uartInit();
 	driverInitResult &= drv_itInit();
+	driverInitResult &= drv_crcInit();
 
 	gos_kernelRegisterSysTickHook(sysTickHook);
 
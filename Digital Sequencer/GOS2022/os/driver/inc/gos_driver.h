@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_driver.h
 //! @author     Ahmed Gazar
-//! @date       2025-07-29
-//! @version    1.3
+//! @date       2026-10-19
+//! @version    1.5
 //!
 //! @brief      GOS driver header.
 //! @details    This header is used for the inclusion of all driver skeletons.
@@ -28,6 +28,8 @@
 // 1.1        2022-12-13    Ahmed Gazar     +    Unsafe log driver transmit function added
 // 1.2        2023-07-25    Ahmed Gazar     +    System monitoring drivers added
 // 1.3        2025-07-29    Ahmed Gazar     -    System monitoring drivers removed
+// 1.4        2026-10-19    Ahmed Gazar     +    Trace binary transmit driver added
+// 1.5        2026-10-19    Ahmed Gazar     +    Shell buffer receive driver added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -70,7 +72,9 @@ typedef struct
     gos_shellDriverTransmitString_t        shellDriverTransmitString;       //!< Shell string transmit function.
     gos_traceDriverTransmitString_t        traceDriverTransmitString;       //!< Log string transmit function.
     gos_traceDriverTransmitString_Unsafe_t traceDriverTransmitStringUnsafe; //!< Log unsafe string transmit function.
+    gos_traceDriverTransmitBinary_t        traceDriverTransmitBinary;       //!< Log binary data transmit function.
     gos_timerDriverSysTimerGetVal_t        timerDriverSysTimerGetValue;     //!< System timer get function.
+    gos_shellDriverReceiveBuffer_t         shellDriverReceiveBuffer;        //!< Shell buffer receive function.
 }gos_driver_functions_t;
 
 /*
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_shell_driver.h
 //! @author     Ahmed Gazar
-//! @date       2023-06-17
-//! @version    1.1
+//! @date       2026-10-19
+//! @version    1.2
 //!
 //! @brief      GOS SHELL driver header.
 //! @details    This driver provides a skeleton for the driver for the shell service.
@@ -27,6 +27,7 @@
 // 1.0        2022-12-11    Ahmed Gazar     Initial version created.
 // 1.1        2023-06-17    Ahmed Gazar     +    Variable parameters added to
 //                                               gos_shellDriverTransmitString
+// 1.2        2026-10-19    Ahmed Gazar     +    gos_shellDriverReceiveBuffer added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -62,6 +63,11 @@
  */
 typedef gos_result_t (*gos_shellDriverReceiveChar_t)(char_t*);
 
+/**
+ * Shell driver receive buffer function type.
+ */
+typedef gos_result_t (*gos_shellDriverReceiveBuffer_t)(char_t*, u16_t, u16_t*);
+
 /**
  * Shell driver transmit string function type.
  */
@@ -83,6 +89,23 @@ typedef gos_result_t (*gos_shellDriverTransmitString_t)(char_t*);
  */
 gos_result_t gos_shellDriverReceiveChar (char_t* pChar);
 
+/**
+ * @brief   Receives every buffered character.
+ * @details If registered, it calls the custom buffer receiver function. The function
+ *          is expected to block until at least one character is available (or its
+ *          timeout elapses) and then return all buffered characters.
+ *
+ * @param[out] pBuffer       Buffer to store the received characters in.
+ * @param[in]  bufferSize    Size of the buffer.
+ * @param[out] pReceivedSize Number of received characters (0 on timeout).
+ *
+ * @return  Result of reception.
+ *
+ * @retval  #GOS_SUCCESS According to user implementation.
+ * @retval  #GOS_ERROR   According to user implementation / function not registered.
+ */
+gos_result_t gos_shellDriverReceiveBuffer (char_t* pBuffer, u16_t bufferSize, u16_t* pReceivedSize);
+
 /**
  * @brief   Transmits a string.
  * @details If registered, it calls the custom string transmitter function.
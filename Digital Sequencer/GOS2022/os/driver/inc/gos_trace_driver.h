@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_trace_driver.h
 //! @author     Ahmed Gazar
-//! @date       2023-01-13
-//! @version    1.2
+//! @date       2026-10-19
+//! @version    1.3
 //!
 //! @brief      GOS trace driver header.
 //! @details    This driver provides a skeleton for the driver for the trace service.
@@ -27,6 +27,7 @@
 // 1.0        2022-12-11    Ahmed Gazar     Initial version created.
 // 1.1        2022-12-13    Ahmed Gazar     +    Unsafe transmit string function added
 // 1.2        2023-01-13    Ahmed Gazar     *    Service renamed to trace
+// 1.3        2026-10-19    Ahmed Gazar     +    Binary transmit function added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -67,6 +68,11 @@ typedef gos_result_t (*gos_traceDriverTransmitString_t)(char_t*);
  */
 typedef gos_result_t (*gos_traceDriverTransmitString_Unsafe_t)(char_t*);
 
+/**
+ * Trace driver transmit binary data function type.
+ */
+typedef gos_result_t (*gos_traceDriverTransmitBinary_t)(u8_t*, u16_t);
+
 /*
  * Function prototypes
  */
@@ -96,4 +102,18 @@ gos_result_t gos_traceDriverTransmitString (char_t* pString);
  */
 gos_result_t gos_traceDriverTransmitString_Unsafe (char_t* pString);
 
+/**
+ * @brief   Trace driver transmit binary data function skeleton.
+ * @details If registered, it calls the custom binary transmit function.
+ *
+ * @param[in] pData Pointer to the data to transmit.
+ * @param[in] size  Size of the data [byte].
+ *
+ * @return  Result of data transmission.
+ *
+ * @retval  #GOS_SUCCESS According to user implementation.
+ * @retval  #GOS_ERROR   According to user implementation / function not registered.
+ */
+gos_result_t gos_traceDriverTransmitBinary (u8_t* pData, u16_t size);
+
 #endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_driver.c
 //! @author     Ahmed Gazar
-//! @date       2022-12-11
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.2
 //!
 //! @brief      GOS driver source.
 //! @details    For a more detailed description of this driver, please refer to
@@ -26,6 +26,8 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2022-12-11    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     *    Driver function initializer made designated
+// 1.2        2026-10-19    Ahmed Gazar     +    Shell buffer receive function initialized
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -55,7 +57,16 @@
 /*
  * Global variables
  */
-gos_driver_functions_t driverFunctions = { NULL, NULL, NULL, NULL, NULL };
+gos_driver_functions_t driverFunctions =
+{
+    .shellDriverReceiveChar          = NULL,
+    .shellDriverTransmitString       = NULL,
+    .traceDriverTransmitString       = NULL,
+    .traceDriverTransmitStringUnsafe = NULL,
+    .traceDriverTransmitBinary       = NULL,
+    .timerDriverSysTimerGetValue     = NULL,
+    .shellDriverReceiveBuffer        = NULL,
+};
 
 /*
  * Function: gos_driverInit
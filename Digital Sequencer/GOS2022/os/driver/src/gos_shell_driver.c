@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_shell_driver.c
 //! @author     Ahmed Gazar
-//! @date       2023-06-17
-//! @version    1.1
+//! @date       2026-10-19
+//! @version    1.2
 //!
 //! @brief      GOS SHELL driver source.
 //! @details    For a more detailed description of this driver, please refer to
@@ -27,6 +27,7 @@
 // ------------------------------------------------------------------------------------------------
 // 1.0        2022-12-11    Ahmed Gazar     Initial version created.
 // 1.1        2023-06-17    Ahmed Gazar     +    Formatted string support added
+// 1.2        2026-10-19    Ahmed Gazar     +    gos_shellDriverReceiveBuffer added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -94,6 +95,31 @@ gos_result_t gos_shellDriverReceiveChar (char_t* pChar)
     return shellDriverReceiveResult;
 }
 
+/*
+ * Function: gos_shellDriverReceiveBuffer
+ */
+gos_result_t gos_shellDriverReceiveBuffer (char_t* pBuffer, u16_t bufferSize, u16_t* pReceivedSize)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t shellDriverReceiveResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (driverFunctions.shellDriverReceiveBuffer != NULL)
+    {
+        shellDriverReceiveResult = driverFunctions.shellDriverReceiveBuffer(pBuffer, bufferSize, pReceivedSize);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return shellDriverReceiveResult;
+}
+
 /*
  * Function: gos_shellDriverTransmitString
  */
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_trace_driver.c
 //! @author     Ahmed Gazar
-//! @date       2023-01-13
-//! @version    1.2
+//! @date       2026-10-19
+//! @version    1.3
 //!
 //! @brief      GOS trace driver source.
 //! @details    For a more detailed description of this driver, please refer to
@@ -28,6 +28,7 @@
 // 1.0        2022-12-11    Ahmed Gazar     Initial version created.
 // 1.1        2022-12-13    Ahmed Gazar     +    Unsafe transmit string function added
 // 1.2        2023-01-13    Ahmed Gazar     *    Service renamed to trace
+// 1.3        2026-10-19    Ahmed Gazar     +    Binary transmit function added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -108,3 +109,28 @@ gos_result_t gos_traceDriverTransmitString_Unsafe (char_t* pString)
 
     return traceDriverTransmitResult;
 }
+
+/*
+ * Function: gos_traceDriverTransmitBinary
+ */
+gos_result_t gos_traceDriverTransmitBinary (u8_t* pData, u16_t size)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t traceDriverTransmitResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (driverFunctions.traceDriverTransmitBinary != NULL)
+    {
+        traceDriverTransmitResult = driverFunctions.traceDriverTransmitBinary(pData, size);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return traceDriverTransmitResult;
+}
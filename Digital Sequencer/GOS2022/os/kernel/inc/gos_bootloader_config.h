@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_bootloader_config.h
 //! @author     Ahmed Gazar
-//! @date       2023-09-26
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.11
 //!
 //! @brief      GOS bootloader configuration header.
 //! @details    This header contains the kernel and service configurations of the operating system.
@@ -25,6 +25,35 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2023-09-26    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     -    CFG_TASK_MESSAGE_DAEMON_STACK removed
+//                                          -    CFG_TASK_MESSAGE_DAEMON_PRIO removed
+// 1.2        2026-10-19    Ahmed Gazar     +    CFG_MESSAGE_MAX_ADDRESSEES added
+//                                          +    CFG_MESSAGE_MAX_SUBSCRIBERS added
+//                                          +    CFG_MESSAGE_MAX_TOPICS added
+//                                          +    CFG_MESSAGE_MAX_PUBLICATIONS added
+//                                          +    CFG_MESSAGE_SUBSCRIBER_QUEUE added
+// 1.3        2026-10-19    Ahmed Gazar     +    CFG_SIGNAL_INVOKE_QUEUE_LENGTH added
+// 1.4        2026-10-19    Ahmed Gazar     +    CFG_SIGNAL_HANDLER_QUEUE_LENGTH added
+//                                          +    CFG_SIGNAL_WORKER_NUMBER added
+//                                          +    CFG_SIGNAL_WORKER_QUEUE_LENGTH added
+//                                          +    CFG_TASK_SIGNAL_WORKER_STACK added
+//                                          +    CFG_TASK_SIGNAL_WORKER_PRIO added
+// 1.5        2026-10-19    Ahmed Gazar     +    CFG_TRACE_BINARY_RING_LENGTH added
+//                                          +    CFG_TRACE_BINARY_MAX_ARGS added
+// 1.6        2026-10-19    Ahmed Gazar     +    CFG_TRACE_RING_SIZE added
+//                                          -    CFG_TRACE_BINARY_RING_LENGTH removed
+// 1.7        2026-10-19    Ahmed Gazar     +    CFG_TRACE_MAX_CHANNELS added
+//                                          +    CFG_TRACE_LEVEL_CEILING added
+// 1.8        2026-10-19    Ahmed Gazar     +    CFG_SHELL_COMMAND_HASH_SIZE added
+// 1.9        2026-10-19    Ahmed Gazar     +    CFG_GCP_WINDOW_SIZE added
+//                                          +    CFG_GCP_MAX_RETRIES added
+// 1.10       2026-10-19    Ahmed Gazar     +    CFG_GCP_MAX_TRANSACTIONS added
+//                                          +    CFG_GCP_ACK_TMO_MS added
+//                                          +    CFG_GCP_RESPONSE_TMO_MS added
+//                                          +    CFG_GCP_READER_POLL_MS added
+// 1.11       2026-10-19    Ahmed Gazar     +    CFG_GCP_COMPRESSION added
+//                                          +    CFG_GCP_COMPRESSION_BUFFER_SIZE added
+//                                          +    CFG_GCP_COMPRESSION_HASH_BITS added
 //*************************************************************************************************
 #ifndef GOS_BOOTLOADER_CONFIG_H
 #define GOS_BOOTLOADER_CONFIG_H
@@ -97,13 +126,13 @@
  */
 #define CFG_TASK_SIGNAL_DAEMON_STACK    ( 0x400 )
 /**
- * Time daemon task stack size.
+ * Signal worker task stack size.
  */
-#define CFG_TASK_TIME_DAEMON_STACK      ( 0x300 )
+#define CFG_TASK_SIGNAL_WORKER_STACK    ( 0x300 )
 /**
- * Message daemon task stack size.
+ * Time daemon task stack size.
  */
-#define CFG_TASK_MESSAGE_DAEMON_STACK   ( 0x300 )
+#define CFG_TASK_TIME_DAEMON_STACK      ( 0x300 )
 /**
  * Shell daemon task stack size.
  */
@@ -120,14 +149,14 @@
  * Trace daemon task priority.
  */
 #define CFG_TASK_TRACE_DAEMON_PRIO      ( 193 )
-/**
- * Message daemon task priority.
- */
-#define CFG_TASK_MESSAGE_DAEMON_PRIO    ( 198 )
 /**
  * Signal daemon task priority.
  */
 #define CFG_TASK_SIGNAL_DAEMON_PRIO     ( 197 )
+/**
+ * Signal worker task (idle) priority.
+ */
+#define CFG_TASK_SIGNAL_WORKER_PRIO     ( 197 )
 /**
  * Shell daemon task priority.
  */
@@ -177,6 +206,22 @@
  * Maximum number of signal subscribers.
  */
 #define CFG_SIGNAL_MAX_SUBSCRIBERS      ( 6 )
+/**
+ * Signal invoke queue length.
+ */
+#define CFG_SIGNAL_INVOKE_QUEUE_LENGTH  ( 8 )
+/**
+ * Number of pending invocations per task mode signal handler.
+ */
+#define CFG_SIGNAL_HANDLER_QUEUE_LENGTH ( 2 )
+/**
+ * Number of signal worker tasks (0: worker dispatch mode is not available).
+ */
+#define CFG_SIGNAL_WORKER_NUMBER        ( 0 )
+/**
+ * Signal worker job queue length.
+ */
+#define CFG_SIGNAL_WORKER_QUEUE_LENGTH  ( 4 )
 
 /*
  * Message service parameters.
@@ -197,6 +242,26 @@
  * Maximum number of message IDs a task can wait for (includes the terminating 0).
  */
 #define CFG_MESSAGE_MAX_WAITER_IDS      ( 8 )
+/**
+ * Maximum number of message addressees (subscribers of one published message ID).
+ */
+#define CFG_MESSAGE_MAX_ADDRESSEES      ( 4 )
+/**
+ * Maximum number of message subscribers.
+ */
+#define CFG_MESSAGE_MAX_SUBSCRIBERS     ( 4 )
+/**
+ * Maximum number of message IDs with subscribers (topics).
+ */
+#define CFG_MESSAGE_MAX_TOPICS          ( 4 )
+/**
+ * Maximum number of published messages held at once.
+ */
+#define CFG_MESSAGE_MAX_PUBLICATIONS    ( 2 )
+/**
+ * Maximum number of published messages pending for one subscriber.
+ */
+#define CFG_MESSAGE_SUBSCRIBER_QUEUE    ( 2 )
 
 /*
  * Shell service parameters.
@@ -221,6 +286,11 @@
  * Command buffer size.
  */
 #define CFG_SHELL_COMMAND_BUFFER_SIZE   ( 200 )
+/**
+ * Shell command lookup table size (power of two, at least twice the number of
+ * registered and linker section commands).
+ */
+#define CFG_SHELL_COMMAND_HASH_SIZE     ( 16 )
 /**
  * Shell daemon startup delay time [ms].
  */
@@ -233,6 +303,45 @@
  * GCP maximum number of channels.
  */
 #define CFG_GCP_CHANNELS_MAX_NUMBER     ( 2 )
+/**
+ * GCP transmit window size (number of chunks in flight, 1 to 32). With 1, every
+ * chunk is acknowledged.
+ */
+#define CFG_GCP_WINDOW_SIZE             ( 8 )
+/**
+ * GCP maximum number of window rounds without progress before a transfer is aborted.
+ */
+#define CFG_GCP_MAX_RETRIES             ( 3 )
+/**
+ * GCP maximum number of concurrent transfers (transmissions, awaited requests and
+ * responses) over all channels.
+ */
+#define CFG_GCP_MAX_TRANSACTIONS        ( 4 )
+/**
+ * GCP acknowledge timeout [ms] (a round without acknowledge is re-sent).
+ */
+#define CFG_GCP_ACK_TMO_MS              ( 1000 )
+/**
+ * GCP timeout [ms] of a submitted request without response activity.
+ */
+#define CFG_GCP_RESPONSE_TMO_MS         ( 5000 )
+/**
+ * GCP polling period [ms] of tasks waiting for frames read by another task.
+ */
+#define CFG_GCP_READER_POLL_MS          ( 5 )
+/**
+ * GCP payload compression flag (protocol 2.3). When enabled, chunks are compressed
+ * for peers that support it, and compressed chunks are accepted.
+ */
+#define CFG_GCP_COMPRESSION             ( 1 )
+/**
+ * GCP compression buffer size (larger chunks are sent uncompressed).
+ */
+#define CFG_GCP_COMPRESSION_BUFFER_SIZE ( 256 )
+/**
+ * GCP compression hash table size (number of bits, 4 to 12).
+ */
+#define CFG_GCP_COMPRESSION_HASH_BITS   ( 6 )
 
 /*
  * Trace service parameters.
@@ -241,6 +350,22 @@
  * Trace maximum (line) length.
  */
 #define CFG_TRACE_MAX_LENGTH            ( 200 )
+/**
+ * Trace ring size [byte] (power of 2).
+ */
+#define CFG_TRACE_RING_SIZE             ( 512 )
+/**
+ * Binary trace maximum number of arguments.
+ */
+#define CFG_TRACE_BINARY_MAX_ARGS       ( 4 )
+/**
+ * Maximum number of trace channels.
+ */
+#define CFG_TRACE_MAX_CHANNELS          ( 4 )
+/**
+ * Trace level ceiling: traces above this level are compiled out (see GOS_TRACE_LEVEL_*).
+ */
+#define CFG_TRACE_LEVEL_CEILING         ( 2 )
 
 /*
  * Error handling parameters.
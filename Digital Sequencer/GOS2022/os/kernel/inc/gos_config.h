@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_config.h
 //! @author     Ahmed Gazar
-//! @date       2024-04-24
-//! @version    1.10
+//! @date       2026-10-19
+//! @version    1.22
 //!
 //! @brief      GOS configuration header.
 //! @details    This header contains the kernel and service configurations of the operating system.
@@ -43,6 +43,34 @@
 // 1.9        2024-02-13    Ahmed Gazar     +    CFG_SYSMON_MAX_USER_MESSAGES added
 // 1.10       2024-04-24    Ahmed Gazar     -    Process service related definitions removed
 // 1.11       2025-07-29    Ahmed Gazar     -    Sysmon service related definitions removed
+// 1.12       2026-10-19    Ahmed Gazar     -    CFG_TASK_MESSAGE_DAEMON_STACK removed
+//                                          -    CFG_TASK_MESSAGE_DAEMON_PRIO removed
+// 1.13       2026-10-19    Ahmed Gazar     +    CFG_MESSAGE_MAX_SUBSCRIBERS added
+//                                          +    CFG_MESSAGE_MAX_TOPICS added
+//                                          +    CFG_MESSAGE_MAX_PUBLICATIONS added
+//                                          +    CFG_MESSAGE_SUBSCRIBER_QUEUE added
+//                                          +    CFG_SIGNAL_INVOKE_QUEUE_LENGTH added
+// 1.15       2026-10-19    Ahmed Gazar     +    CFG_SIGNAL_HANDLER_QUEUE_LENGTH added
+//                                          +    CFG_SIGNAL_WORKER_NUMBER added
+//                                          +    CFG_SIGNAL_WORKER_QUEUE_LENGTH added
+//                                          +    CFG_TASK_SIGNAL_WORKER_STACK added
+//                                          +    CFG_TASK_SIGNAL_WORKER_PRIO added
+// 1.16       2026-10-19    Ahmed Gazar     +    CFG_TRACE_BINARY_RING_LENGTH added
+//                                          +    CFG_TRACE_BINARY_MAX_ARGS added
+// 1.17       2026-10-19    Ahmed Gazar     +    CFG_TRACE_RING_SIZE added
+//                                          -    CFG_TRACE_BINARY_RING_LENGTH removed
+// 1.18       2026-10-19    Ahmed Gazar     +    CFG_TRACE_MAX_CHANNELS added
+//                                          +    CFG_TRACE_LEVEL_CEILING added
+// 1.19       2026-10-19    Ahmed Gazar     +    CFG_SHELL_COMMAND_HASH_SIZE added
+// 1.20       2026-10-19    Ahmed Gazar     +    CFG_GCP_WINDOW_SIZE added
+//                                          +    CFG_GCP_MAX_RETRIES added
+// 1.21       2026-10-19    Ahmed Gazar     +    CFG_GCP_MAX_TRANSACTIONS added
+//                                          +    CFG_GCP_ACK_TMO_MS added
+//                                          +    CFG_GCP_RESPONSE_TMO_MS added
+//                                          +    CFG_GCP_READER_POLL_MS added
+// 1.22       2026-10-19    Ahmed Gazar     +    CFG_GCP_COMPRESSION added
+//                                          +    CFG_GCP_COMPRESSION_BUFFER_SIZE added
+//                                          +    CFG_GCP_COMPRESSION_HASH_BITS added
 //*************************************************************************************************
 #ifndef GOS_CONFIG_H
 #define GOS_CONFIG_H
@@ -122,13 +150,13 @@
  */
 #define CFG_TASK_SIGNAL_DAEMON_STACK    ( 0x400 )
 /**
- * Time daemon task stack size.
+ * Signal worker task stack size.
  */
-#define CFG_TASK_TIME_DAEMON_STACK      ( 0x300 )
+#define CFG_TASK_SIGNAL_WORKER_STACK    ( 0x400 )
 /**
- * Message daemon task stack size.
+ * Time daemon task stack size.
  */
-#define CFG_TASK_MESSAGE_DAEMON_STACK   ( 0x600 )
+#define CFG_TASK_TIME_DAEMON_STACK      ( 0x300 )
 /**
  * Shell daemon task stack size.
  */
@@ -145,14 +173,14 @@
  * Trace daemon task priority.
  */
 #define CFG_TASK_TRACE_DAEMON_PRIO      ( 193 )
-/**
- * Message daemon task priority.
- */
-#define CFG_TASK_MESSAGE_DAEMON_PRIO    ( 198 )
 /**
  * Signal daemon task priority.
  */
 #define CFG_TASK_SIGNAL_DAEMON_PRIO     ( 197 )
+/**
+ * Signal worker task (idle) priority.
+ */
+#define CFG_TASK_SIGNAL_WORKER_PRIO     ( 197 )
 /**
  * Shell daemon task priority.
  */
@@ -202,6 +230,22 @@
  * Maximum number of signal subscribers.
  */
 #define CFG_SIGNAL_MAX_SUBSCRIBERS      ( 6 )
+/**
+ * Signal invoke queue length.
+ */
+#define CFG_SIGNAL_INVOKE_QUEUE_LENGTH  ( 16 )
+/**
+ * Number of pending invocations per task mode signal handler.
+ */
+#define CFG_SIGNAL_HANDLER_QUEUE_LENGTH ( 4 )
+/**
+ * Number of signal worker tasks (0: worker dispatch mode is not available).
+ */
+#define CFG_SIGNAL_WORKER_NUMBER        ( 2 )
+/**
+ * Signal worker job queue length.
+ */
+#define CFG_SIGNAL_WORKER_QUEUE_LENGTH  ( 8 )
 
 /*
  * Message service parameters.
@@ -223,9 +267,25 @@
  */
 #define CFG_MESSAGE_MAX_WAITER_IDS      ( 8 )
 /**
- * Maximum number of message addressees.
+ * Maximum number of message addressees (subscribers of one published message ID).
  */
 #define CFG_MESSAGE_MAX_ADDRESSEES      ( 8 )
+/**
+ * Maximum number of message subscribers.
+ */
+#define CFG_MESSAGE_MAX_SUBSCRIBERS     ( 8 )
+/**
+ * Maximum number of message IDs with subscribers (topics).
+ */
+#define CFG_MESSAGE_MAX_TOPICS          ( 8 )
+/**
+ * Maximum number of published messages held at once.
+ */
+#define CFG_MESSAGE_MAX_PUBLICATIONS    ( 4 )
+/**
+ * Maximum number of published messages pending for one subscriber.
+ */
+#define CFG_MESSAGE_SUBSCRIBER_QUEUE    ( 4 )
 
 /*
  * Shell service parameters.
@@ -250,6 +310,11 @@
  * Command buffer size.
  */
 #define CFG_SHELL_COMMAND_BUFFER_SIZE   ( 200 )
+/**
+ * Shell command lookup table size (power of two, at least twice the number of
+ * registered and linker section commands).
+ */
+#define CFG_SHELL_COMMAND_HASH_SIZE     ( 64 )
 /**
  * Shell daemon startup delay time [ms].
  */
@@ -262,6 +327,45 @@
  * GCP maximum number of channels.
  */
 #define CFG_GCP_CHANNELS_MAX_NUMBER     ( 4 )
+/**
+ * GCP transmit window size (number of chunks in flight, 1 to 32). With 1, every
+ * chunk is acknowledged.
+ */
+#define CFG_GCP_WINDOW_SIZE             ( 8 )
+/**
+ * GCP maximum number of window rounds without progress before a transfer is aborted.
+ */
+#define CFG_GCP_MAX_RETRIES             ( 3 )
+/**
+ * GCP maximum number of concurrent transfers (transmissions, awaited requests and
+ * responses) over all channels.
+ */
+#define CFG_GCP_MAX_TRANSACTIONS        ( 8 )
+/**
+ * GCP acknowledge timeout [ms] (a round without acknowledge is re-sent).
+ */
+#define CFG_GCP_ACK_TMO_MS              ( 1000 )
+/**
+ * GCP timeout [ms] of a submitted request without response activity.
+ */
+#define CFG_GCP_RESPONSE_TMO_MS         ( 5000 )
+/**
+ * GCP polling period [ms] of tasks waiting for frames read by another task.
+ */
+#define CFG_GCP_READER_POLL_MS          ( 5 )
+/**
+ * GCP payload compression flag (protocol 2.3). When enabled, chunks are compressed
+ * for peers that support it, and compressed chunks are accepted.
+ */
+#define CFG_GCP_COMPRESSION             ( 1 )
+/**
+ * GCP compression buffer size (larger chunks are sent uncompressed).
+ */
+#define CFG_GCP_COMPRESSION_BUFFER_SIZE ( 1024 )
+/**
+ * GCP compression hash table size (number of bits, 4 to 12).
+ */
+#define CFG_GCP_COMPRESSION_HASH_BITS   ( 8 )
 
 /*
  * Trace service parameters.
@@ -270,6 +374,22 @@
  * Trace maximum (line) length.
  */
 #define CFG_TRACE_MAX_LENGTH            ( 200 )
+/**
+ * Trace ring size [byte] (power of 2).
+ */
+#define CFG_TRACE_RING_SIZE             ( 2048 )
+/**
+ * Binary trace maximum number of arguments.
+ */
+#define CFG_TRACE_BINARY_MAX_ARGS       ( 4 )
+/**
+ * Maximum number of trace channels.
+ */
+#define CFG_TRACE_MAX_CHANNELS          ( 8 )
+/**
+ * Trace level ceiling: traces above this level are compiled out (see GOS_TRACE_LEVEL_*).
+ */
+#define CFG_TRACE_LEVEL_CEILING         ( 4 )
 
 /*
  * Error handling parameters.
@@ -15,7 +15,7 @@
 //! @file       gos_kernel.h
 //! @author     Ahmed Gazar
 //! @date       2025-09-10
-//! @version    1.24
+//! @version    1.25
 //!
 //! @brief      GOS kernel header.
 //! @details    The GOS kernel is the core of the GOS system. It contains the basic type
@@ -90,6 +90,7 @@
 // 1.24       2025-09-10    Ahmed Gazar     +    gos_faultType_t added
 //                                          +    gos_faultHook_t added
 //                                          +    gos_kernelRegisterFaultHook added
+// 1.25       2026-10-19    Ahmed Gazar     +    gos_taskGetDescriptorByIndex added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -1284,6 +1285,26 @@ gos_result_t gos_taskGetDataByIndex (
         gos_taskDescriptor_t* pTaskData
         );
 
+/**
+ * @brief   Returns the internal descriptor of the given task.
+ * @details Based on the task index, it returns a read-only pointer to the internal
+ *          task descriptor array element instead of copying it. This way a caller
+ *          can read only the fields it needs. The fields are only consistent with
+ *          each other if they are read in an atomic section.
+ *
+ * @param[in]  taskIndex  Index of the task to get the descriptor of.
+ * @param[out] ppTaskData Pointer to the descriptor pointer to set.
+ *
+ * @return  Result of task descriptor get.
+ *
+ * @retval  #GOS_SUCCESS Descriptor pointer set successfully.
+ * @retval  #GOS_ERROR   Invalid task index, caller is not privileged or pointer is NULL.
+ */
+gos_result_t gos_taskGetDescriptorByIndex (
+        u16_t                        taskIndex,
+        GOS_CONST gos_taskDescriptor_t** ppTaskData
+        );
+
 /**
  * @brief   Returns the number of registered tasks.
  * @details Loops through the internal task array and counts the
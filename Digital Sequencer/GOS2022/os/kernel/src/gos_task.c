@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_task.c
 //! @author     Ahmed Gazar
-//! @date       2025-06-18
-//! @version    1.4
+//! @date       2026-10-19
+//! @version    1.5
 //!
 //! @brief      GOS task source.
 //! @details    For a more detailed description of this module, please refer to @ref gos_kernel.h
@@ -30,6 +30,7 @@
 // 1.3        2025-04-06    Ahmed Gazar     *    gos_taskCheckDescriptor check logic inverted
 // 1.4        2025-06-18    Ahmed Gazar     *    gos_taskGetDataByIndex and gos_taskGetData invalid
 //                                               task ID check added
+// 1.5        2026-10-19    Ahmed Gazar     +    gos_taskGetDescriptorByIndex added
 //*************************************************************************************************
 //
 // Copyright (c) 2023 Ahmed Gazar
@@ -1180,6 +1181,38 @@ gos_result_t gos_taskGetDataByIndex (u16_t taskIndex, gos_taskDescriptor_t* pTas
     return taskGetDataResult;
 }
 
+/*
+ * Function: gos_taskGetDescriptorByIndex
+ */
+gos_result_t gos_taskGetDescriptorByIndex (u16_t taskIndex, GOS_CONST gos_taskDescriptor_t** ppTaskData)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t taskGetDescriptorResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    if (taskIndex < CFG_TASK_MAX_NUMBER &&
+        taskDescriptors[taskIndex].taskId != GOS_INVALID_TASK_ID &&
+        ppTaskData != NULL &&
+        (taskDescriptors[currentTaskIndex].taskPrivilegeLevel & GOS_TASK_PRIVILEGE_KERNEL) == GOS_TASK_PRIVILEGE_KERNEL)
+    {
+        *ppTaskData = &taskDescriptors[taskIndex];
+
+        taskGetDescriptorResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Task data does not exist.
+    }
+    GOS_ATOMIC_EXIT
+
+    return taskGetDescriptorResult;
+}
+
 /*
  * Function: gos_taskGetNumber
  */
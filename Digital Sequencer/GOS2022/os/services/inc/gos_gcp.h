@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_gcp.h
 //! @author     Ahmed Gazar
-//! @date       2024-07-18
-//! @version    3.0
+//! @date       2026-10-19
+//! @version    3.4
 //!
 //! @brief      GOS General Communication Protocol header.
 //! @details    This service implements the GCP frame and message layers.
@@ -28,6 +28,11 @@
 // 1.1        2022-12-20    Ahmed Gazar     * Function description modified
 // 2.0        2022-12-20    Ahmed Gazar     Released
 // 3.0        2024-07-18    Ahmed Gazar     Service rework
+// 3.1        2026-10-19    Ahmed Gazar     *    Windowed transfer mode described
+// 3.2        2026-10-19    Ahmed Gazar     +    Transaction IDs and asynchronous request and
+//                                               response API added
+// 3.3        2026-10-19    Ahmed Gazar     +    Compressed chunks (protocol 2.3) described
+// 3.4        2026-10-19    Ahmed Gazar     +    Vectored physical layer transmit function added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -64,6 +69,21 @@ typedef u8_t  gos_gcpChannelNumber_t;    //!< GCP channel number.
 typedef u16_t gos_gcpChannelNumber_t;    //!< GCP channel number.
 #endif
 
+/**
+ * GCP transaction ID type (1 to 127, 0 for no transaction).
+ */
+typedef u8_t  gos_gcpTransactionId_t;
+
+/**
+ * No transaction (request of a stop-and-wait peer).
+ */
+#define GOS_GCP_NO_TRANSACTION ( 0u )
+
+/**
+ * GCP response callback type (channel, transaction ID, response message ID, result).
+ */
+typedef void_t (*gos_gcpResponseCallback_t) (gos_gcpChannelNumber_t, gos_gcpTransactionId_t, u16_t, gos_result_t);
+
 /**
  * GCP physical layer transmit function type.
  */
@@ -74,6 +94,26 @@ typedef gos_result_t (*gos_gcpTransmitFunction_t) (u8_t*, u16_t);
  */
 typedef gos_result_t (*gos_gcpReceiveFunction_t) (u8_t*, u16_t);
 
+/**
+ * GCP frame segment type (part of a frame in the memory of the caller).
+ */
+typedef struct
+{
+    u8_t* pData;                         //!< Segment data.
+    u16_t size;                          //!< Segment size.
+}gos_gcpSegment_t;
+
+/**
+ * Maximum number of segments of a frame.
+ */
+#define GOS_GCP_FRAME_SEGMENTS_MAX ( 2u )
+
+/**
+ * GCP physical layer vectored transmit function type (segments, number of segments).
+ * The segments shall be sent back to back as one transmission.
+ */
+typedef gos_result_t (*gos_gcpTransmitVectorFunction_t) (gos_gcpSegment_t*, u8_t);
+
 /*
  * Function prototypes
  */
@@ -92,11 +132,16 @@ gos_result_t gos_gcpInit (
 
 /**
  * @brief   Registers the physical-layer transmit and receive driver functions.
- * @details Registers the physical-layer transmit and receive driver functions.
+ * @details Registers the physical-layer transmit and receive driver functions. If a
+ *          vectored transmit function is given, every frame (header and data) is passed
+ *          to it in one call, directly from the buffers of the frame, otherwise the header
+ *          and the data are transmitted separately.
  *
- * @param [in] channel          GCP channel.
- * @param [in] transmitFunction Transmit function to register.
- * @param [in] receiveFunction  Receive function to register.
+ * @param [in] channel                GCP channel.
+ * @param [in] transmitFunction       Transmit function to register.
+ * @param [in] transmitVectorFunction Vectored transmit function to register (optional, NULL
+ *                                    if not supported).
+ * @param [in] receiveFunction        Receive function to register.
  *
  * @return  Result of physical driver registration.
  *
@@ -104,14 +149,22 @@ gos_result_t gos_gcpInit (
  * @retval  #GOS_ERROR   Transmit or receive function is NULL.
  */
 gos_result_t gos_gcpRegisterPhysicalDriver (
-        gos_gcpChannelNumber_t    channel,
-        gos_gcpTransmitFunction_t transmitFunction,
-        gos_gcpReceiveFunction_t  receiveFunction
+        gos_gcpChannelNumber_t          channel,
+        gos_gcpTransmitFunction_t       transmitFunction,
+        gos_gcpTransmitVectorFunction_t transmitVectorFunction,
+        gos_gcpReceiveFunction_t        receiveFunction
         );
 
 /**
  * @brief   Transmits the given message via the GCP protocol.
- * @details Calls the internal message transmitter function.
+ * @details Calls the internal message transmitter function. Messages are sent as
+ *          frames tagged with a transaction ID (protocol 2.2, up to
+ *          #CFG_GCP_WINDOW_SIZE chunks in flight), so transfers of several tasks
+ *          can share the channel. With #CFG_GCP_COMPRESSION enabled, chunks are sent
+ *          compressed if the peer supports it (protocol 2.3) and they get smaller. If
+ *          the peer rejects it, the channel falls back to protocol 2.2, or to
+ *          stop-and-wait mode (protocol 2.0). If the calling task serves a request
+ *          (see #gos_gcpBindTransaction), the message is sent as its response.
  *
  * @param[in] channel         GCP channel.
  * @param[in] messageId       Message ID.
@@ -134,7 +187,9 @@ gos_result_t gos_gcpTransmitMessage (
 
 /**
  * @brief   Receives the given message via the GCP protocol.
- * @details Calls the internal receiver function.
+ * @details Waits for a request (see #gos_gcpReceiveRequest) and binds the
+ *          calling task to its transaction, so the messages sent by the task
+ *          are its responses.
  *
  * @param[in]  channel        GCP channel.
  * @param[out] pMessageId     Pointer to a variable to store the message ID.
@@ -154,4 +209,136 @@ gos_result_t gos_gcpReceiveMessage (
         u16_t                   targetSize,
         u16_t                   maxChunkSize
         );
+
+/**
+ * @brief   Receives a request via the GCP protocol.
+ * @details Waits for the next message that is not the response of a submitted
+ *          request. While no other task reads the channel, the calling task reads
+ *          and routes the frames of the channel.
+ *
+ * @param[in]  channel        GCP channel.
+ * @param[out] pMessageId     Pointer to a variable to store the message ID.
+ * @param[out] pTransactionId Pointer to a variable to store the transaction ID.
+ * @param[out] pPayloadTarget Pointer to the payload target buffer.
+ * @param[in]  targetSize     Size of the target buffer (in bytes).
+ * @param[in]  maxChunkSize   Maximum size of payload chunks (stop-and-wait mode).
+ *
+ * @return  Result of request reception.
+ *
+ * @retval  #GOS_SUCCESS Request received successfully.
+ * @retval  #GOS_ERROR   Invalid parameters, no free transaction slot, or an error
+ *                       occurred during reception or validation.
+ */
+gos_result_t gos_gcpReceiveRequest (
+        gos_gcpChannelNumber_t  channel,
+        u16_t*                  pMessageId,
+        gos_gcpTransactionId_t* pTransactionId,
+        void_t*                 pPayloadTarget,
+        u16_t                   targetSize,
+        u16_t                   maxChunkSize
+        );
+
+/**
+ * @brief   Transmits the response of the given request.
+ * @details Sends the message in the transaction of the request.
+ *
+ * @param[in] channel         GCP channel.
+ * @param[in] transactionId   Transaction ID of the request.
+ * @param[in] messageId       Message ID.
+ * @param[in] pMessagePayload Pointer to the message payload.
+ * @param[in] payloadSize     Size of the payload (in bytes).
+ * @param[in] maxChunkSize    Maximum size of payload chunks.
+ *
+ * @return  Result of response transmission.
+ *
+ * @retval  #GOS_SUCCESS Response transmitted successfully.
+ * @retval  #GOS_ERROR   An error occurred during transmission or validation.
+ */
+gos_result_t gos_gcpTransmitResponse (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpTransactionId_t  transactionId,
+        u16_t                   messageId,
+        void_t*                 pMessagePayload,
+        u16_t                   payloadSize,
+        u16_t                   maxChunkSize
+        );
+
+/**
+ * @brief   Binds the calling task to the given request.
+ * @details Messages sent by the calling task with #gos_gcpTransmitMessage on the
+ *          channel are sent as responses of the request. #GOS_GCP_NO_TRANSACTION
+ *          removes the binding.
+ *
+ * @param[in] channel       GCP channel.
+ * @param[in] transactionId Transaction ID of the request.
+ *
+ * @return  Result of binding.
+ *
+ * @retval  #GOS_SUCCESS Binding successful.
+ * @retval  #GOS_ERROR   Invalid parameters or no free binding.
+ */
+gos_result_t gos_gcpBindTransaction (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpTransactionId_t  transactionId
+        );
+
+/**
+ * @brief   Submits a request via the GCP protocol.
+ * @details Sends the request and returns without waiting for the response. The
+ *          response is received into the given buffer by the task reading the
+ *          channel and completed either by the callback (called from the reading
+ *          task, it shall not receive on the same channel) or by
+ *          #gos_gcpWaitResponse. Responses may arrive in any order. Requests without
+ *          response activity for #CFG_GCP_RESPONSE_TMO_MS are completed with error.
+ *
+ * @param[in]  channel            GCP channel.
+ * @param[in]  messageId          Message ID.
+ * @param[in]  pMessagePayload    Pointer to the message payload.
+ * @param[in]  payloadSize        Size of the payload (in bytes).
+ * @param[in]  maxChunkSize       Maximum size of payload chunks.
+ * @param[out] pResponseTarget    Pointer to the response target buffer.
+ * @param[in]  responseTargetSize Size of the response target buffer (in bytes).
+ * @param[in]  responseCallback   Completion callback (NULL: wait for the response).
+ * @param[out] pTransactionId     Pointer to a variable to store the transaction ID.
+ *
+ * @return  Result of request submission.
+ *
+ * @retval  #GOS_SUCCESS Request sent.
+ * @retval  #GOS_ERROR   Invalid parameters, no free transaction slot, or an error
+ *                       occurred during transmission.
+ */
+gos_result_t gos_gcpSubmitRequest (
+        gos_gcpChannelNumber_t    channel,
+        u16_t                     messageId,
+        void_t*                   pMessagePayload,
+        u16_t                     payloadSize,
+        u16_t                     maxChunkSize,
+        void_t*                   pResponseTarget,
+        u16_t                     responseTargetSize,
+        gos_gcpResponseCallback_t responseCallback,
+        gos_gcpTransactionId_t*   pTransactionId
+        );
+
+/**
+ * @brief   Waits for the response of a submitted request.
+ * @details Waits for the response of a request submitted without callback. On
+ *          timeout the request is cancelled.
+ *
+ * @param[in]  channel       GCP channel.
+ * @param[in]  transactionId Transaction ID of the request.
+ * @param[out] pMessageId    Pointer to a variable to store the response message ID.
+ * @param[in]  timeoutMs     Timeout [ms].
+ *
+ * @return  Result of waiting.
+ *
+ * @retval  #GOS_SUCCESS Response received successfully.
+ * @retval  #GOS_ERROR   Unknown transaction, timeout, or an error occurred during
+ *                       reception or validation.
+ */
+gos_result_t gos_gcpWaitResponse (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpTransactionId_t  transactionId,
+        u16_t*                  pMessageId,
+        u32_t                   timeoutMs
+        );
 #endif
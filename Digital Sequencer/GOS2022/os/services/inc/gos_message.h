@@ -14,25 +14,33 @@
 //*************************************************************************************************
 //! @file       gos_message.h
 //! @author     Ahmed Gazar
-//! @date       2022-11-15
-//! @version    1.2
+//! @date       2026-10-19
+//! @version    1.6
 //!
 //! @brief      GOS message service header.
 //! @details    Message service is a way of inter-task communication provided by the operating
 //!             system. With the use of messages, data can be passed between different tasks. The
 //!             data sent through the message service is only limited in size which is a
-//!             configuration parameter. Message passing is handled by the background daemon task
-//!             thus ensuring that big data transfers do not block the system. Messages are first
-//!             copied into an internal message array and whenever a waiter and a message is
-//!             matched, it gets copied into the target buffer. If a message is not received, it
-//!             will be stuck in the internal buffer and it causes the message service to halt if
-//!             the internal circular buffer gets back to the position of the stuck message.
+//!             configuration parameter. When a message is transmitted, it is matched against the
+//!             registered waiters immediately, and if a waiter is found, the message is copied
+//!             into its target buffer and the waiter task is unblocked. Messages without a waiter
+//!             are copied into an internal message array and they are delivered when a task
+//!             starts waiting for them. Waiters and buffered messages are indexed by message ID in
+//!             hash tables, and free slots are tracked in bitmaps, so the cost of transmission and
+//!             reception does not depend on the configured number of messages and waiters. If a
+//!             message is not received, it occupies a slot of the internal buffer until a task
+//!             receives it.
 //!             Reception of messages can happen with a given timeout or with an endless timeout.
 //!             Either way the caller task will go to blocked state until the message is received
 //!             or the timeout elapses, so it will not be scheduled in the meantime. Each message
 //!             contains a message ID. When receiving messages, the task can define a list of IDs
 //!             for reception as a filter. This way one task can receive more than one message but
 //!             a message can only be received by one task.
+//!             For one-to-many distribution, the service also provides a publish/subscribe mode.
+//!             Subscribers register for message IDs (topics), and a published message is copied
+//!             once into a reference-counted publication buffer. Every subscriber of the topic
+//!             receives a read-only (zero-copy) view of the same buffer, and the buffer is
+//!             released when all of the subscribers have released their views.
 //*************************************************************************************************
 // History
 // ------------------------------------------------------------------------------------------------
@@ -42,6 +50,18 @@
 // 1.1        2022-11-05    Ahmed Gazar     +    Service description modified to match with the
 //                                               FIFO implementation
 // 1.2        2022-11-15    Ahmed Gazar     +    License added
+// 1.3        2026-10-19    Ahmed Gazar     *    Service description modified to match with the
+//                                               direct message delivery
+// 1.4        2026-10-19    Ahmed Gazar     *    Service description modified to match with the
+//                                               indexed message routing
+// 1.5        2026-10-19    Ahmed Gazar     +    Publish/subscribe mode added
+//                                          +    gos_messageSubscriberCreate added
+//                                          +    gos_messageSubscribe added
+//                                          +    gos_messageUnsubscribe added
+//                                          +    gos_messagePublish added
+//                                          +    gos_messageReceivePublished added
+//                                          +    gos_messageReleasePublished added
+// 1.6        2026-10-19    Ahmed Gazar     +    gos_messageSubscriberDelete added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -119,6 +139,12 @@ typedef u8_t  gos_messageIdIndex_t;        //!< Message ID index type.
 typedef u16_t gos_messageIdIndex_t;        //!< Message ID index type.
 #endif
 
+#if CFG_MESSAGE_MAX_SUBSCRIBERS < 255
+typedef u8_t  gos_messageSubscriberId_t;   //!< Message subscriber ID type.
+#else
+typedef u16_t gos_messageSubscriberId_t;   //!< Message subscriber ID type.
+#endif
+
 /**
  * Message type.
  */
@@ -134,13 +160,12 @@ typedef struct
  */
 /**
  * @brief   Initializes the message service.
- * @details Initializes the internal message and waiter arrays and registers the
- *          message daemon task.
+ * @details Initializes the internal message and waiter arrays and the message mutex.
  *
  * @return  Result of initialization.
  *
  * @retval  #GOS_SUCCESS Initialization successful.
- * @retval  #GOS_ERROR   Message daemon task registration failed.
+ * @retval  #GOS_ERROR   Message mutex initialization failed.
  */
 gos_result_t gos_messageInit (
         void_t
@@ -156,14 +181,15 @@ gos_result_t gos_messageInit (
  *                            terminated by a 0 element!
  * @param[out] target         Pointer to the target message structure. Received data
  *                            will be placed here.
- * @param[in]  tmo            Timeout value in [ms]. The resolution of timeout is 10ms!
+ * @param[in]  tmo            Timeout value in [ms] (system ticks).
  *                            Do not use endless timeout if it is not guaranteed that
  *                            the message will be received!
  *
  * @return    Result of message reception.
  *
  * @retval  #GOS_SUCCESS Reception successful, data placed in the target structure.
- * @retval  #GOS_ERROR   Reception failed because of invalid parameters or timeout.
+ * @retval  #GOS_ERROR   Reception failed because of invalid parameters, full waiter array
+ *                       or timeout.
  */
 gos_result_t gos_messageRx (
         gos_messageId_t*     messageIdArray,
@@ -173,18 +199,151 @@ gos_result_t gos_messageRx (
 
 /**
  * @brief   Transmits a message.
- * @details Copies the message in the internal message array for the message daemon to
- *          transfer it to the recipient task.
+ * @details If a task is waiting for the message, it copies the message to the target
+ *          buffer of the waiter and unblocks the waiter task. Otherwise the message is
+ *          copied in the internal message array until a recipient task requests it.
  *
  * @param[in] message Pointer to the message structure to be transmitted.
  *
  * @return  Result of message transmission.
  *
- * @retval  #GOS_SUCCESS Message transmission initiated successfully.
+ * @retval  #GOS_SUCCESS Message delivered or buffered successfully.
  * @retval  #GOS_ERROR   Invalid message pointer or data or message array is full.
  */
 gos_result_t gos_messageTx (
         gos_message_t* message
         );
 
+/**
+ * @brief   Creates a message subscriber.
+ * @details Reserves a subscriber slot for the caller task. The subscriber can be
+ *          subscribed to one or more message IDs, and only the owner task can
+ *          receive the published messages through it.
+ *
+ * @param[out] pSubscriberId Pointer to a subscriber identifier.
+ *
+ * @return  Result of subscriber creation.
+ *
+ * @retval  #GOS_SUCCESS Subscriber created successfully.
+ * @retval  #GOS_ERROR   NULL pointer or subscriber array is full.
+ */
+gos_result_t gos_messageSubscriberCreate (
+        gos_messageSubscriberId_t* pSubscriberId
+        );
+
+/**
+ * @brief   Subscribes to the given message ID.
+ * @details Adds the subscriber to the addressee list of the given message ID. The
+ *          number of subscribers of one message ID is limited to
+ *          CFG_MESSAGE_MAX_ADDRESSEES.
+ *
+ * @param[in] subscriberId Subscriber identifier.
+ * @param[in] messageId    Message ID to subscribe to.
+ *
+ * @return  Result of subscription.
+ *
+ * @retval  #GOS_SUCCESS Subscription successful (or already subscribed).
+ * @retval  #GOS_ERROR   Invalid subscriber or message ID, topic array or addressee
+ *                       list is full.
+ */
+gos_result_t gos_messageSubscribe (
+        gos_messageSubscriberId_t subscriberId,
+        gos_messageId_t           messageId
+        );
+
+/**
+ * @brief   Unsubscribes from the given message ID.
+ * @details Removes the subscriber from the addressee list of the given message ID.
+ *          Messages already pending for the subscriber can still be received.
+ *
+ * @param[in] subscriberId Subscriber identifier.
+ * @param[in] messageId    Message ID to unsubscribe from.
+ *
+ * @return  Result of unsubscription.
+ *
+ * @retval  #GOS_SUCCESS Unsubscription successful.
+ * @retval  #GOS_ERROR   Invalid subscriber ID or subscriber is not subscribed to the
+ *                       given message ID.
+ */
+gos_result_t gos_messageUnsubscribe (
+        gos_messageSubscriberId_t subscriberId,
+        gos_messageId_t           messageId
+        );
+
+/**
+ * @brief   Deletes a message subscriber.
+ * @details Unsubscribes the subscriber from all of its message IDs and releases its
+ *          pending publications and held view. Only the owner task can delete the
+ *          subscriber. Subscribers of a deleted task are released automatically.
+ *
+ * @param[in] subscriberId Subscriber identifier.
+ *
+ * @return  Result of subscriber deletion.
+ *
+ * @retval  #GOS_SUCCESS Subscriber deleted successfully.
+ * @retval  #GOS_ERROR   Invalid subscriber ID or caller is not the owner.
+ */
+gos_result_t gos_messageSubscriberDelete (
+        gos_messageSubscriberId_t subscriberId
+        );
+
+/**
+ * @brief   Publishes a message.
+ * @details Copies the message once into a free publication buffer and places a
+ *          reference to it in the queue of every subscriber of the message ID,
+ *          unblocking the subscribers that are waiting. If the queue of a subscriber
+ *          is full, the message is dropped for that subscriber and its overrun
+ *          counter is incremented.
+ *
+ * @param[in] message Pointer to the message structure to be published.
+ *
+ * @return  Result of publishing.
+ *
+ * @retval  #GOS_SUCCESS Message published (or the message ID has no subscribers).
+ * @retval  #GOS_ERROR   Invalid message pointer or data or no free publication buffer.
+ */
+gos_result_t gos_messagePublish (
+        gos_message_t* message
+        );
+
+/**
+ * @brief   Receives a published message.
+ * @details Releases the previously received view of the subscriber (if any), and
+ *          returns a read-only view of the next pending published message. If there
+ *          is no pending message, the caller task is blocked until a message is
+ *          published or the timeout elapses. The view remains valid until
+ *          #gos_messageReleasePublished or the next call of this function.
+ *
+ * @param[in]  subscriberId Subscriber identifier.
+ * @param[out] ppMessage    Pointer to a message pointer where the view is returned.
+ * @param[in]  tmo          Timeout value in [ms] (system ticks).
+ *
+ * @return  Result of reception.
+ *
+ * @retval  #GOS_SUCCESS Reception successful, view returned.
+ * @retval  #GOS_ERROR   Invalid parameters, caller is not the owner of the subscriber,
+ *                       or timeout.
+ */
+gos_result_t gos_messageReceivePublished (
+        gos_messageSubscriberId_t      subscriberId,
+        GOS_CONST gos_message_t**      ppMessage,
+        gos_messageTimeout_t           tmo
+        );
+
+/**
+ * @brief   Releases the currently held published message view.
+ * @details Decrements the reference counter of the publication buffer and frees
+ *          the buffer when all of the subscribers have released it.
+ *
+ * @param[in] subscriberId Subscriber identifier.
+ *
+ * @return  Result of release.
+ *
+ * @retval  #GOS_SUCCESS Release successful.
+ * @retval  #GOS_ERROR   Invalid subscriber ID or no view held.
+ */
+gos_result_t gos_messageReleasePublished (
+        gos_messageSubscriberId_t subscriberId
+        );
+
 #endif
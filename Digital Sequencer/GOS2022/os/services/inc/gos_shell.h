@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_shell.h
 //! @author     Ahmed Gazar
-//! @date       2023-07-12
-//! @version    1.3
+//! @date       2026-10-19
+//! @version    1.6
 //!
 //! @brief      GOS shell service header.
 //! @details    The shell service provides an easy interface to receive and process commands in a
@@ -34,6 +34,13 @@
 // 1.2        2022-12-03    Ahmed Gazar     +    gos_shellRegisterCommands added
 // 1.3        2023-07-12    Ahmed Gazar     +    commandHandlerPrivileges added to
 //                                               gos_shellCommand_t
+// 1.4        2026-10-19    Ahmed Gazar     +    gos_shellOutputMode_t added
+//                                          +    gos_shellSetOutputMode, gos_shellGetOutputMode
+//                                               added
+// 1.5        2026-10-19    Ahmed Gazar     +    GOS_SHELL_COMMAND, GOS_SHELL_COMMAND_SECTION added
+//                                          +    gos_shellSubCommand_t added
+//                                          +    gos_shellSubCommandDispatch added
+// 1.6        2026-10-19    Ahmed Gazar     *    gos_shellFunction returns gos_result_t
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -61,13 +68,43 @@
  */
 #include <gos_kernel.h>
 
+/*
+ * Macros
+ */
+/**
+ * Linker section of the shell commands registered at link time. The section shall be
+ * placed in the read-only memory between the __gos_shell_cmd_start and __gos_shell_cmd_end
+ * symbols.
+ */
+#define GOS_SHELL_COMMAND_SECTION  ".gos_shell_cmd"
+
+/**
+ * @brief   Registers a shell command at link time.
+ * @details Places a constant command descriptor in the shell command section. The
+ *          command is added to the lookup table in #gos_shellInit, it takes no slot
+ *          in the internal command array.
+ *
+ * @param   name       Command name string literal.
+ * @param   handler    Command handler function.
+ * @param   privileges Command handler privileges.
+ */
+#define GOS_SHELL_COMMAND(name, handler, privileges)                                               \
+    GOS_STATIC GOS_CONST gos_shellCommand_t handler##Command                                      \
+        __attribute__((section(GOS_SHELL_COMMAND_SECTION), used, aligned(4))) =                    \
+    {                                                                                              \
+        .command                  = name,                                                          \
+        .commandHandler           = handler,                                                       \
+        .commandHandlerPrivileges = privileges                                                     \
+    }
+
 /*
  * Type definitions
  */
 /**
- * Shell function type.
+ * Shell function type. The result is reported as OK/ERR in machine output mode, and
+ * free-text messages shall only be sent in human output mode.
  */
-typedef void_t (*gos_shellFunction)(char_t* params);
+typedef gos_result_t (*gos_shellFunction)(char_t* params);
 
 /**
  * Shell command type.
@@ -79,6 +116,24 @@ typedef struct
     gos_taskPrivilegeLevel_t commandHandlerPrivileges;                //!< Command handler privileges.
 }gos_shellCommand_t;
 
+/**
+ * Shell output mode.
+ */
+typedef enum
+{
+    GOS_SHELL_OUTPUT_HUMAN,      //!< Prompt, echo and formatted text output.
+    GOS_SHELL_OUTPUT_MACHINE     //!< No prompt, echo or messages, CSV-like output closed by OK/ERR lines.
+}gos_shellOutputMode_t;
+
+/**
+ * Shell sub-command type.
+ */
+typedef struct
+{
+    char_t*                  name;                                    //!< Sub-command name.
+    gos_shellFunction        handler;                                 //!< Sub-command handler function.
+}gos_shellSubCommand_t;
+
 #if CFG_SHELL_MAX_COMMAND_NUMBER < 255
 typedef u8_t  gos_shellCommandIndex_t;    //!< Shell command index type.
 #else
@@ -137,6 +192,28 @@ gos_result_t gos_shellRegisterCommand (
         gos_shellCommand_t* command
         );
 
+/**
+ * @brief   This function dispatches a sub-command from a sub-command table.
+ * @details Splits the first word of the parameter list and looks it up in the
+ *          table with binary search, then calls its handler with the rest of the
+ *          parameter list. The table shall be sorted by name (in strcmp order).
+ *
+ * @param[in] pTable    Pointer to the sorted sub-command table.
+ * @param[in] tableSize Number of entries in the table.
+ * @param[in] params    Parameter list of the parent command.
+ *
+ * @return  Result of sub-command dispatching.
+ *
+ * @retval  #GOS_SUCCESS Sub-command found and executed successfully.
+ * @retval  #GOS_ERROR   Table or parameter pointer is NULL, sub-command not found,
+ *                       or sub-command failed.
+ */
+gos_result_t gos_shellSubCommandDispatch (
+        GOS_CONST gos_shellSubCommand_t* pTable,
+        u16_t                            tableSize,
+        char_t*                          params
+        );
+
 /**
  * @brief   Suspends the shell daemon task.
  * @details Suspends the shell daemon task.
@@ -186,4 +263,32 @@ gos_result_t gos_shellEchoOn (
 gos_result_t gos_shellEchoOff (
         void_t
         );
+
+/**
+ * @brief   Sets the shell output mode.
+ * @details In machine mode the prompt, the echo and the human-readable messages
+ *          are suppressed, the built-in commands respond in comma-separated form,
+ *          and every executed command is closed by an OK line (handler succeeded)
+ *          or an ERR line (unknown command or handler failed).
+ *
+ * @param[in] mode Output mode to set.
+ *
+ * @return  Result of setting the output mode.
+ *
+ * @retval  #GOS_SUCCESS Output mode set successfully.
+ * @retval  #GOS_ERROR   Invalid output mode.
+ */
+gos_result_t gos_shellSetOutputMode (
+        gos_shellOutputMode_t mode
+        );
+
+/**
+ * @brief   Returns the shell output mode.
+ * @details Returns the shell output mode.
+ *
+ * @return  Current output mode.
+ */
+gos_shellOutputMode_t gos_shellGetOutputMode (
+        void_t
+        );
 #endif
@@ -14,17 +14,25 @@
 //*************************************************************************************************
 //! @file       gos_signal.h
 //! @author     Ahmed Gazar
-//! @date       2022-11-15
-//! @version    1.1
+//! @date       2026-10-19
+//! @version    1.4
 //!
 //! @brief      GOS signal service header.
 //! @details    Signal service is a way of inter-task or inter-process communication provided by
 //!             the operating system. Signals can be created, subscribed to and invoked. When a
 //!             signal is invoked, it is placed into an invoke queue and the signal daemon task
 //!             will handle the invoke requests in the background. Thus signals are not instantly
-//!             invoked. When a signal is invoked, all the subscribed functions get called. A
-//!             signal can be invoked without any subscribers (in this case no function will be
-//!             called).
+//!             invoked. Every invocation is queued with its own sender ID (invocations are not
+//!             merged), and the queue is processed in invocation order. The invoke queue can be
+//!             used from interrupt context as well. When a signal is invoked, all the subscribed
+//!             functions get called. A signal can be invoked without any subscribers (in this
+//!             case no function will be called).
+//!             Each subscriber selects its dispatch mode: the handler is either called inline
+//!             by the signal daemon, posted to the subscriber task (which calls the handler from
+//!             its own context via #gos_signalProcessPending), or executed by a worker task of
+//!             the signal worker pool at the priority declared by the subscriber. This way a
+//!             slow handler does not delay the other signals. Execution time statistics are
+//!             collected for every handler.
 //*************************************************************************************************
 // History
 // ------------------------------------------------------------------------------------------------
@@ -32,6 +40,16 @@
 // ------------------------------------------------------------------------------------------------
 // 1.0        2022-10-23    Ahmed Gazar     Initial version created
 // 1.1        2022-11-15    Ahmed Gazar     +    License added
+// 1.2        2026-10-19    Ahmed Gazar     +    gos_signalQueueStatistics_t added
+//                                          +    gos_signalGetQueueStatistics added
+// 1.3        2026-10-19    Ahmed Gazar     +    gos_signalDispatchMode_t added
+//                                          +    gos_signalDispatchConfig_t added
+//                                          +    gos_signalHandlerStatistics_t added
+//                                          +    gos_signalSubscribeDispatch added
+//                                          +    gos_signalProcessPending added
+//                                          +    gos_signalGetHandlerStatistics added
+// 1.4        2026-10-19    Ahmed Gazar     +    Sender filter mask added to dispatch configuration
+//                                          +    GOS_SIGNAL_SENDER_MASK added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -58,6 +76,15 @@
  * Includes
  */
 #include <gos_kernel.h>
+#include <gos_trigger.h>
+
+/*
+ * Macros
+ */
+/**
+ * Sender filter mask bit of the given sender ID (sender IDs below 32 can be filtered).
+ */
+#define GOS_SIGNAL_SENDER_MASK(senderId) ( 1uL << (senderId) )
 
 /*
  * Type definitions
@@ -87,6 +114,50 @@ typedef u16_t    gos_signalHandlerIndex_t;
 //! Signal handler function type.
 typedef void_t (*gos_signalHandler_t)(gos_signalSenderId_t);
 
+/**
+ * Signal handler dispatch mode enumerator.
+ */
+typedef enum
+{
+    GOS_SIGNAL_DISPATCH_INLINE,            //!< Handler is called by the signal daemon.
+    GOS_SIGNAL_DISPATCH_TASK,              //!< Handler is called by the subscriber task.
+    GOS_SIGNAL_DISPATCH_WORKER             //!< Handler is called by a signal worker task.
+}gos_signalDispatchMode_t;
+
+/**
+ * Signal handler dispatch configuration type.
+ */
+typedef struct
+{
+    gos_signalDispatchMode_t dispatchMode;   //!< Dispatch mode.
+    gos_taskPrio_t           workerPriority; //!< Worker priority (worker mode only).
+    gos_trigger_t*           pNotifyTrigger; //!< Trigger incremented on post (task mode only, optional).
+    u32_t                    senderMask;     //!< Accepted sender IDs (#GOS_SIGNAL_SENDER_MASK), 0 for all.
+}gos_signalDispatchConfig_t;
+
+/**
+ * Signal handler statistics type.
+ */
+typedef struct
+{
+    u32_t callCounter;                     //!< Number of handler calls.
+    u32_t droppedCounter;                  //!< Number of calls lost because of full queue.
+    u32_t lastRunTimeUs;                   //!< Last execution time [us].
+    u32_t maxRunTimeUs;                    //!< Maximum execution time [us].
+    u64_t totalRunTimeUs;                  //!< Total execution time [us].
+}gos_signalHandlerStatistics_t;
+
+/**
+ * Signal invoke queue statistics type.
+ */
+typedef struct
+{
+    u16_t queueLength;                     //!< Invoke queue length.
+    u16_t queueUsage;                      //!< Current number of queued invocations.
+    u16_t queueMaxUsage;                   //!< Maximum number of queued invocations.
+    u32_t overflowCounter;                 //!< Number of invocations lost because of full queue.
+}gos_signalQueueStatistics_t;
+
 /*
  * Function prototypes
  */
@@ -121,7 +192,7 @@ gos_result_t gos_signalCreate (
 /**
  * @brief   Subscribes to the given signal.
  * @details Finds the next free slot in the signal handler array and registers the
- *          signal handler there.
+ *          signal handler there. The handler is called inline by the signal daemon.
  *
  * @param[in] signalId                Signal identifier.
  * @param[in] signalHandler           Signal handler function pointer.
@@ -139,10 +210,40 @@ gos_result_t gos_signalSubscribe (
         gos_taskPrivilegeLevel_t signalHandlerPrivileges
         );
 
+/**
+ * @brief   Subscribes to the given signal with the given dispatch configuration.
+ * @details Finds the next free slot in the signal handler array and registers the
+ *          signal handler there with the given dispatch mode. In task mode the
+ *          caller task becomes the owner of the subscription, and the handler is
+ *          called when the owner task calls #gos_signalProcessPending. If a sender
+ *          mask is configured, invocations from other senders are not dispatched to
+ *          the handler at all.
+ *
+ * @param[in] signalId                Signal identifier.
+ * @param[in] signalHandler           Signal handler function pointer.
+ * @param[in] signalHandlerPrivileges Signal handler privilege level (inline and worker
+ *                                    modes).
+ * @param[in] pDispatchConfig         Pointer to the dispatch configuration (NULL for
+ *                                    inline mode).
+ *
+ * @return  Success of signal subscription.
+ *
+ * @retval  #GOS_SUCCESS Subscription successful.
+ * @retval  #GOS_ERROR   Invalid signal ID, signal handler NULL pointer, handler array
+ *                       full, or worker mode requested without signal workers.
+ */
+gos_result_t gos_signalSubscribeDispatch (
+        gos_signalId_t              signalId,
+        gos_signalHandler_t         signalHandler,
+        gos_taskPrivilegeLevel_t    signalHandlerPrivileges,
+        gos_signalDispatchConfig_t* pDispatchConfig
+        );
+
 /**
  * @brief   Invokes the given signal.
  * @details Places the given signal in the invoke queue (for the signal daemon to
- *          actually invoke the signal in the background).
+ *          actually invoke the signal in the background). Can be called from
+ *          interrupt context.
  *
  * @param[in] signalId Signal identifier.
  * @param[in] senderId Sender identifier (or data to pass).
@@ -150,11 +251,63 @@ gos_result_t gos_signalSubscribe (
  * @return  Success of signal invoking.
  *
  * @retval  #GOS_SUCCESS Invoking successful.
- * @retval  #GOS_ERROR   Invalid signal ID or signal unused.
+ * @retval  #GOS_ERROR   Invalid signal ID, signal unused, or invoke queue full.
  */
 gos_result_t gos_signalInvoke (
         gos_signalId_t       signalId,
         gos_signalSenderId_t senderId
         );
 
+/**
+ * @brief   Returns the invoke queue statistics.
+ * @details Copies the current usage, the maximum usage, and the overflow counter
+ *          of the invoke queue to the given structure (to help sizing
+ *          CFG_SIGNAL_INVOKE_QUEUE_LENGTH).
+ *
+ * @param[out] pStatistics Pointer to the statistics structure.
+ *
+ * @return  Result of statistics getting.
+ *
+ * @retval  #GOS_SUCCESS Statistics returned.
+ * @retval  #GOS_ERROR   NULL pointer.
+ */
+gos_result_t gos_signalGetQueueStatistics (
+        gos_signalQueueStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Calls the pending task mode handlers of the caller task.
+ * @details Loops through the task mode subscriptions owned by the caller task and
+ *          calls the handlers for every posted invocation (in the context of the
+ *          caller task).
+ *
+ * @return  Result of processing.
+ *
+ * @retval  #GOS_SUCCESS At least one handler has been called.
+ * @retval  #GOS_ERROR   No pending invocation for the caller task.
+ */
+gos_result_t gos_signalProcessPending (
+        void_t
+        );
+
+/**
+ * @brief   Returns the statistics of the given signal handler.
+ * @details Copies the call counter and execution time statistics of the given
+ *          subscription to the given structure.
+ *
+ * @param[in]  signalId      Signal identifier.
+ * @param[in]  signalHandler Signal handler function pointer.
+ * @param[out] pStatistics   Pointer to the statistics structure.
+ *
+ * @return  Result of statistics getting.
+ *
+ * @retval  #GOS_SUCCESS Statistics returned.
+ * @retval  #GOS_ERROR   Invalid signal ID, handler not subscribed, or NULL pointer.
+ */
+gos_result_t gos_signalGetHandlerStatistics (
+        gos_signalId_t                 signalId,
+        gos_signalHandler_t            signalHandler,
+        gos_signalHandlerStatistics_t* pStatistics
+        );
+
 #endif
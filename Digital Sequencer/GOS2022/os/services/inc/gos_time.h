@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_time.h
 //! @author     Ahmed Gazar
-//! @date       2023-11-06
-//! @version    1.6
+//! @date       2026-10-19
+//! @version    1.8
 //!
 //! @brief      GOS time service header.
 //! @details    Time service provides an easy interface to manipulate time structures, track the
@@ -40,6 +40,11 @@
 // 1.6        2023-11-06    Ahmed Gazar     +    Milliseconds added to gos_time_t
 //                                          +    gos_timeIncreaseSystemTime added
 //                                          +    gos_timeAddMilliseconds added
+// 1.7        2026-10-19    Ahmed Gazar     +    Monotonic microsecond clock API added
+//                                          *    gos_timeIncreaseSystemTime only advances the
+//                                               monotonic clock
+// 1.8        2026-10-19    Ahmed Gazar     +    GOS_TIME_UNIT_MASK added
+//                                          +    gos_timeSubscribe added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -66,6 +71,15 @@
  * Includes
  */
 #include <gos_kernel.h>
+#include <gos_signal.h>
+
+/*
+ * Macros
+ */
+/**
+ * Unit mask bit of the given elapsed sender ID (for #gos_timeSubscribe).
+ */
+#define GOS_TIME_UNIT_MASK(unit) ( GOS_SIGNAL_SENDER_MASK(unit) )
 
 /*
  * Type definitions
@@ -146,7 +160,8 @@ gos_result_t gos_timeInit (
 
 /**
  * @brief   This function gets the system time.
- * @details This function copies the system time value to the given time variable.
+ * @details This function brings the system time up to date based on the monotonic clock
+ *          and copies it to the given time variable.
  *
  * @param[out] pTime Pointer to a time variable to store the system time value in.
  *
@@ -175,6 +190,64 @@ gos_result_t gos_timeSet (
         gos_time_t* pTime
         );
 
+/**
+ * @brief   This function subscribes to the given elapsed time units.
+ * @details Subscribes the handler to the time signal with a sender filter, so the
+ *          handler is only dispatched when one of the selected units has elapsed.
+ *          The handler receives the elapsed sender ID of the unit.
+ *
+ * @param[in] unitMask                Mask of the units (#GOS_TIME_UNIT_MASK).
+ * @param[in] signalHandler           Signal handler function pointer.
+ * @param[in] signalHandlerPrivileges Signal handler privilege level.
+ * @param[in] pDispatchConfig         Pointer to the dispatch configuration (NULL for
+ *                                    inline mode).
+ *
+ * @return  Result of subscription.
+ *
+ * @retval  #GOS_SUCCESS Subscription successful.
+ * @retval  #GOS_ERROR   Empty unit mask or signal subscription error.
+ */
+gos_result_t gos_timeSubscribe (
+        u32_t                       unitMask,
+        gos_signalHandler_t         signalHandler,
+        gos_taskPrivilegeLevel_t    signalHandlerPrivileges,
+        gos_signalDispatchConfig_t* pDispatchConfig
+        );
+
+/**
+ * @brief   This function gets the monotonic time in microseconds.
+ * @details Combines the system tick count with the sub-tick value of the microsecond
+ *          system timer. The returned value never decreases and is not affected by
+ *          setting the system time. Callable from interrupt context.
+ *
+ * @return  Elapsed microseconds since startup.
+ */
+u64_t gos_timeGetMonotonicUs (
+        void_t
+        );
+
+/**
+ * @brief   This function gets the monotonic time in milliseconds.
+ * @details Returns the number of system ticks elapsed since startup.
+ *
+ * @return  Elapsed milliseconds since startup.
+ */
+u64_t gos_timeGetMonotonicMs (
+        void_t
+        );
+
+/**
+ * @brief   This function gets the elapsed time since the given time stamp.
+ * @details Subtracts the given monotonic time stamp from the current monotonic time.
+ *
+ * @param[in] startUs Start time stamp returned by #gos_timeGetMonotonicUs.
+ *
+ * @return  Elapsed microseconds since the time stamp.
+ */
+u64_t gos_timeGetElapsedUs (
+        u64_t startUs
+        );
+
 /**
  * @brief   This function compares two time structures.
  * @details This function compares two time structures.
@@ -195,15 +268,16 @@ gos_result_t gos_timeCompare (
         );
 
 /**
- * @brief   This function increases the system time and runtime with the given value of milliseconds.
- * @details This function increases the system time and runtime with the given value of milliseconds.
+ * @brief   This function advances the monotonic clock with the given value of milliseconds.
+ * @details This function is called from the system tick interrupt. It only advances the
+ *          monotonic clock and samples the system timer; the system time and run-time
+ *          are derived from the monotonic clock when they are read.
  *
- * @param[in] milliseconds Number of milliseconds to add to system time.
+ * @param[in] milliseconds Number of milliseconds to add to the monotonic clock.
  *
  * @return  Result of system time increasing.
  *
  * @retval  #GOS_SUCCESS Increasing successful.
- * @retval  #GOS_ERROR   System time or runtime increasing failed.
  */
 gos_result_t gos_timeIncreaseSystemTime (
         u16_t milliseconds
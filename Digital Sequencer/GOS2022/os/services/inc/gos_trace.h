@@ -14,12 +14,20 @@
 //*************************************************************************************************
 //! @file       gos_trace.h
 //! @author     Ahmed Gazar
-//! @date       2023-01-13
-//! @version    2.1
+//! @date       2026-10-19
+//! @version    2.8
 //!
 //! @brief      GOS trace service header.
 //! @details    Trace service is a simple interface to send out strings via the configured trace
-//!             periphery.
+//!             periphery. Traces are copied to a byte ring in a short atomic section (no mutex,
+//!             usable from ISRs) that the trace daemon drains in contiguous chunks. Besides text
+//!             tracing, a binary trace mode is provided: the caller only
+//!             stores a compact record (format string ID, timestamp and raw 32-bit arguments),
+//!             formatting is done on the host based on the format strings in the ELF file.
+//!             Modules can register trace channels with a runtime level (settable from the
+//!             shell), and trace through #GOS_TRACE_LOG: a trace is only formatted if its level
+//!             is enabled on the channel, and levels above #CFG_TRACE_LEVEL_CEILING are
+//!             compiled out.
 //*************************************************************************************************
 // History
 // ------------------------------------------------------------------------------------------------
@@ -34,6 +42,23 @@
 //                                          *    Function descriptions updated
 // 2.0        2022-12-20    Ahmed Gazar     Released
 // 2.1        2023-01-13    Ahmed Gazar     *    Service renamed to trace
+// 2.2        2026-10-19    Ahmed Gazar     +    Binary trace mode added (GOS_TRACE_BINARY,
+//                                               gos_traceBinaryRecord_t, gos_traceTraceBinary)
+// 2.3        2026-10-19    Ahmed Gazar     +    gos_traceStatistics_t added
+//                                          +    gos_traceGetStatistics added
+//                                          -    gos_traceGetBinaryDropCounter removed
+//                                          *    Function descriptions updated (trace ring)
+// 2.4        2026-10-19    Ahmed Gazar     +    Trace levels and trace channels added
+//                                          +    GOS_TRACE_LOG, GOS_TRACE_LEVEL_ENABLED added
+//                                          +    gos_traceChannelRegister added
+//                                          +    gos_traceChannelSetLevel added
+//                                          +    gos_traceChannelGet added
+// 2.5        2026-10-19    Ahmed Gazar     *    Binary record timestamp is in microseconds
+// 2.6        2026-10-19    Ahmed Gazar     *    Trace ring description updated
+// 2.7        2026-10-19    Ahmed Gazar     *    gos_traceTraceFormatted description updated
+// 2.8        2026-10-19    Ahmed Gazar     +    GOS_TRACE_BINARY_ARG added, binary trace arguments
+//                                               converted one by one
+//                                          *    GOS_TRACE_BINARY description updated
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -93,17 +118,182 @@
  * @}
  */
 
+/**
+ * @defgroup TraceLevels Trace levels
+ * @{
+ */
+#define GOS_TRACE_LEVEL_OFF       ( 0u )        //!< Tracing disabled.
+#define GOS_TRACE_LEVEL_ERROR     ( 1u )        //!< Errors only.
+#define GOS_TRACE_LEVEL_WARNING   ( 2u )        //!< Errors and warnings.
+#define GOS_TRACE_LEVEL_INFO      ( 3u )        //!< State information.
+#define GOS_TRACE_LEVEL_DEBUG     ( 4u )        //!< All debug information.
+/**
+ * @}
+ */
+
+/**
+ * @brief   Trace channel initializer.
+ *
+ * @param   channelName  Channel name (string literal).
+ * @param   defaultLevel Default runtime level of the channel.
+ */
+#define GOS_TRACE_CHANNEL_INIT(channelName, defaultLevel)  { .name = (channelName), .level = (defaultLevel) }
+
+/**
+ * @brief   Checks whether the given level is enabled on the given channel.
+ * @details Evaluates to a compile-time false if the level is above the ceiling,
+ *          otherwise to a single load-and-compare.
+ *
+ * @param   channel    Trace channel variable.
+ * @param   traceLevel Trace level.
+ */
+#define GOS_TRACE_LEVEL_ENABLED(channel, traceLevel)                                               \
+    (((traceLevel) <= CFG_TRACE_LEVEL_CEILING) && ((traceLevel) <= (channel).level))
+
+/**
+ * @brief   Traces a formatted message on the given channel with the given level.
+ * @details The message is only formatted if the level is enabled on the channel.
+ *
+ * @param   channel      Trace channel variable.
+ * @param   traceLevel   Trace level.
+ * @param   addTimeStamp Flag to indicate whether to add time-stamp or not.
+ * @param   ...          Formatter string and optional parameters.
+ */
+#define GOS_TRACE_LOG(channel, traceLevel, addTimeStamp, ...)                                     \
+    do                                                                                             \
+    {                                                                                              \
+        if (GOS_TRACE_LEVEL_ENABLED(channel, traceLevel))                                          \
+        {                                                                                          \
+            (void_t) gos_traceTraceFormatted((addTimeStamp), __VA_ARGS__);                         \
+        }                                                                                          \
+    } while (0)
+
+/**
+ * Linker section of the binary trace format strings. It shall be placed as a
+ * non-allocated (INFO) section at address 0, this way the format strings take no
+ * memory on the target and the address of a string is its format ID.
+ */
+#define GOS_TRACE_FORMAT_SECTION  ".gos_trace_fmt"
+
+/**
+ * Binary trace record synchronization byte (not a valid character in text traces).
+ */
+#define GOS_TRACE_BINARY_SYNC     ( 0xA5u )
+
+/**
+ * Binary trace record header size [byte].
+ */
+#define GOS_TRACE_BINARY_HEADER_SIZE ( 8u )
+
+/**
+ * Converts a binary trace argument to its raw 32-bit value (pointers through uintptr_t).
+ */
+#define GOS_TRACE_BINARY_ARG(arg)     ( (u32_t)(uintptr_t)(arg) )
+
+/**
+ * Number of binary trace arguments (0 to 8).
+ */
+#define GOS_TRACE_BINARY_ARG_COUNT(...)                                                            \
+    GOS_TRACE_BINARY_ARG_COUNT_N(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define GOS_TRACE_BINARY_ARG_COUNT_N(a0, a1, a2, a3, a4, a5, a6, a7, a8, count, ...) count
+
+/**
+ * Binary trace argument list: each argument is converted by #GOS_TRACE_BINARY_ARG
+ * and preceded by a comma.
+ */
+#define GOS_TRACE_BINARY_ARGS(...)                                                                 \
+    GOS_TRACE_BINARY_ARGS_SELECT(GOS_TRACE_BINARY_ARG_COUNT(__VA_ARGS__))(__VA_ARGS__)
+#define GOS_TRACE_BINARY_ARGS_SELECT(count)     GOS_TRACE_BINARY_ARGS_SELECT_N(count)
+#define GOS_TRACE_BINARY_ARGS_SELECT_N(count)   GOS_TRACE_BINARY_ARGS_ ## count
+#define GOS_TRACE_BINARY_ARGS_0(...)
+#define GOS_TRACE_BINARY_ARGS_1(arg)      , GOS_TRACE_BINARY_ARG(arg)
+#define GOS_TRACE_BINARY_ARGS_2(arg, ...) , GOS_TRACE_BINARY_ARG(arg) GOS_TRACE_BINARY_ARGS_1(__VA_ARGS__)
+#define GOS_TRACE_BINARY_ARGS_3(arg, ...) , GOS_TRACE_BINARY_ARG(arg) GOS_TRACE_BINARY_ARGS_2(__VA_ARGS__)
+#define GOS_TRACE_BINARY_ARGS_4(arg, ...) , GOS_TRACE_BINARY_ARG(arg) GOS_TRACE_BINARY_ARGS_3(__VA_ARGS__)
+#define GOS_TRACE_BINARY_ARGS_5(arg, ...) , GOS_TRACE_BINARY_ARG(arg) GOS_TRACE_BINARY_ARGS_4(__VA_ARGS__)
+#define GOS_TRACE_BINARY_ARGS_6(arg, ...) , GOS_TRACE_BINARY_ARG(arg) GOS_TRACE_BINARY_ARGS_5(__VA_ARGS__)
+#define GOS_TRACE_BINARY_ARGS_7(arg, ...) , GOS_TRACE_BINARY_ARG(arg) GOS_TRACE_BINARY_ARGS_6(__VA_ARGS__)
+#define GOS_TRACE_BINARY_ARGS_8(arg, ...) , GOS_TRACE_BINARY_ARG(arg) GOS_TRACE_BINARY_ARGS_7(__VA_ARGS__)
+
+/**
+ * @brief   Traces a message in binary mode.
+ * @details Places the format string in the format string section and stores a binary
+ *          trace record with the format ID and the arguments, each converted to its raw
+ *          32-bit value by #GOS_TRACE_BINARY_ARG. Only scalars of at most 32 bits are
+ *          transferred losslessly: wider integers are truncated and floating-point values
+ *          are converted to integers, so %f and %ll are not supported. Pointers are stored
+ *          as addresses, so %p works but %s is not supported (the host cannot dereference
+ *          target memory). The number of arguments is limited by
+ *          #CFG_TRACE_BINARY_MAX_ARGS (at most 8).
+ *
+ * @param   traceFormat Formatter string literal.
+ * @param   ...         Optional parameters.
+ */
+#define GOS_TRACE_BINARY(traceFormat, ...)                                                         \
+    do                                                                                             \
+    {                                                                                              \
+        GOS_STATIC GOS_CONST char_t traceFormatString []                                           \
+            __attribute__((section(GOS_TRACE_FORMAT_SECTION), used)) = traceFormat;                \
+        u32_t traceArguments [] = { 0u GOS_TRACE_BINARY_ARGS(__VA_ARGS__) };                       \
+        (void_t) gos_traceTraceBinary(                                                             \
+                (u16_t)(uintptr_t)traceFormatString,                                               \
+                (u8_t)((sizeof(traceArguments) / sizeof(u32_t)) - 1u),                             \
+                &traceArguments[1]);                                                               \
+    } while (0)
+
+/*
+ * Type definitions
+ */
+/**
+ * Trace level type.
+ */
+typedef u8_t gos_traceLevel_t;
+
+/**
+ * Trace channel type.
+ */
+typedef struct
+{
+    GOS_CONST char_t* name;                      //!< Channel name.
+    gos_traceLevel_t  level;                     //!< Current runtime level.
+}gos_traceChannel_t;
+
+/**
+ * Binary trace record type. Only the header and the used arguments are transmitted,
+ * so a record takes #GOS_TRACE_BINARY_HEADER_SIZE + 4 * argNumber bytes on the line
+ * (little-endian).
+ */
+typedef struct __attribute__((packed))
+{
+    u8_t  sync;                                  //!< Synchronization byte (#GOS_TRACE_BINARY_SYNC).
+    u8_t  argNumber;                             //!< Number of arguments.
+    u16_t formatId;                              //!< Format string ID (address in the format section).
+    u32_t timeStamp;                             //!< Timestamp (monotonic clock, lower 32 bits) [us].
+    u32_t arguments [CFG_TRACE_BINARY_MAX_ARGS]; //!< Raw arguments.
+}gos_traceBinaryRecord_t;
+
+/**
+ * Trace statistics type.
+ */
+typedef struct
+{
+    u32_t ringSize;                              //!< Trace ring size [byte].
+    u32_t ringUsage;                             //!< Current ring usage [byte].
+    u32_t ringMaxUsage;                          //!< Maximum ring usage [byte].
+    u32_t dropCounter;                           //!< Number of traces lost because of full ring.
+}gos_traceStatistics_t;
+
 /*
  * Function prototypes
  */
 /**
  * @brief   Initializes the trace service.
- * @details Creates a trace queue and registers the trace daemon in the kernel.
+ * @details Resets the trace ring and registers the trace daemon in the kernel.
  *
  * @return  Result of initialization.
  *
  * @retval  #GOS_SUCCESS Initialization successful.
- * @retval  #GOS_ERROR   Queue creation or task registration error.
+ * @retval  #GOS_ERROR   Trigger initialization or task registration error.
  */
 gos_result_t gos_traceInit (
         void_t
@@ -111,7 +301,8 @@ gos_result_t gos_traceInit (
 
 /**
  * @brief   Traces a given message.
- * @details Places the given message to the trace queue (for the trace daemon to print it).
+ * @details Places the given message (and the timestamp) in the trace ring (for the
+ *          trace daemon to print it). Can be called from ISRs.
  *
  * @param[in] addTimeStamp Flag to indicate whether to add time-stamp or not.
  * @param[in] traceMessage String to trace.
@@ -119,9 +310,7 @@ gos_result_t gos_traceInit (
  * @return  Result of tracing.
  *
  * @retval  #GOS_SUCCESS Tracing successful.
- * @retval  #GOS_ERROR   Queue put error.
- *
- * @remark  This function uses the queue service.
+ * @retval  #GOS_ERROR   No privilege, or ring full (trace dropped).
  */
 gos_result_t gos_traceTrace (
         bool_t  addTimeStamp,
@@ -130,8 +319,10 @@ gos_result_t gos_traceTrace (
 
 /**
  * @brief   Traces a given formatted message.
- * @details Prints the formatted message into a local buffer and places it
- *          to the trace queue (for the trace daemon to print it).
+ * @details Prints the formatted message into a static line buffer and places
+ *          it in the trace ring (for the trace daemon to print it). Tasks share
+ *          a line buffer guarded by the trace mutex, ISRs format in their own
+ *          buffer with interrupts disabled. Can be called from ISRs.
  *
  * @param[in] addTimeStamp Flag to indicate whether to add time-stamp or not.
  * @param[in] traceFormat  Formatter string.
@@ -140,7 +331,7 @@ gos_result_t gos_traceTrace (
  * @return  Result of formatted tracing.
  *
  * @retval  #GOS_SUCCESS Formatted tracing successful.
- * @retval  #GOS_ERROR   Queue put error.
+ * @retval  #GOS_ERROR   No privilege, or ring full (trace dropped).
  */
 gos_result_t gos_traceTraceFormatted (
         bool_t            addTimeStamp,
@@ -166,4 +357,91 @@ gos_result_t gos_traceTraceFormattedUnsafe (
         ...
         );
 
+/**
+ * @brief   Traces a binary record.
+ * @details Stores a binary trace record in the trace ring (without formatting and
+ *          without locking a mutex, so it can be called from ISRs). Use #GOS_TRACE_BINARY instead of
+ *          calling this function directly.
+ *
+ * @param[in] formatId  Format string ID.
+ * @param[in] argNumber Number of arguments.
+ * @param[in] pArgs     Pointer to the argument array.
+ *
+ * @return  Result of binary tracing.
+ *
+ * @retval  #GOS_SUCCESS Record stored.
+ * @retval  #GOS_ERROR   No privilege, too many arguments, or ring full (record dropped).
+ */
+gos_result_t gos_traceTraceBinary (
+        u16_t  formatId,
+        u8_t   argNumber,
+        u32_t* pArgs
+        );
+
+/**
+ * @brief   Returns the trace statistics.
+ * @details Returns the size and usage of the trace ring and the number of dropped traces.
+ *
+ * @param[out] pStatistics Pointer to the statistics structure.
+ *
+ * @return  Result of getting.
+ *
+ * @retval  #GOS_SUCCESS Statistics returned.
+ * @retval  #GOS_ERROR   NULL pointer parameter.
+ */
+gos_result_t gos_traceGetStatistics (
+        gos_traceStatistics_t* pStatistics
+        );
+
+/**
+ * @brief   Registers a trace channel.
+ * @details Places the channel in the channel registry, so its level can be
+ *          changed at runtime by name.
+ *
+ * @param[in] pChannel Pointer to the trace channel (shall be static).
+ *
+ * @return  Result of registration.
+ *
+ * @retval  #GOS_SUCCESS Channel registered.
+ * @retval  #GOS_ERROR   NULL pointer, or registry full.
+ */
+gos_result_t gos_traceChannelRegister (
+        gos_traceChannel_t* pChannel
+        );
+
+/**
+ * @brief   Sets the runtime level of a trace channel.
+ * @details Finds the channel by name and sets its level. The name "all" selects
+ *          every registered channel.
+ *
+ * @param[in] channelName Channel name.
+ * @param[in] level       Desired level.
+ *
+ * @return  Result of level setting.
+ *
+ * @retval  #GOS_SUCCESS Level set.
+ * @retval  #GOS_ERROR   Channel not found, invalid level, or NULL pointer.
+ */
+gos_result_t gos_traceChannelSetLevel (
+        GOS_CONST char_t* channelName,
+        gos_traceLevel_t  level
+        );
+
+/**
+ * @brief   Returns the registered trace channel with the given index.
+ * @details Can be used to list the registered channels.
+ *
+ * @param[in]  index     Registry index.
+ * @param[out] ppChannel Pointer to store the channel pointer in.
+ *
+ * @return  Result of getting.
+ *
+ * @retval  #GOS_SUCCESS Channel returned.
+ * @retval  #GOS_ERROR   Index out of range, or NULL pointer.
+ */
+gos_result_t gos_traceChannelGet (
+        u8_t                 index,
+        gos_traceChannel_t** ppChannel
+        );
+
 #endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_gcp.c
 //! @author     Ahmed Gazar
-//! @date       2025-04-06
-//! @version    3.1
+//! @date       2026-10-19
+//! @version    3.5
 //!
 //! @brief      GOS General Communication Protocol handler service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_gcp.h
@@ -36,6 +36,14 @@
 // 3.0        2024-07-18    Ahmed Gazar     Service rework
 // 3.1        2025-04-06    Ahmed Gazar     *    GOS_CONCAT_RESULT used for init
 //                                          *    Max. chunk handling added
+// 3.2        2026-10-19    Ahmed Gazar     +    Windowed transfer mode (protocol 2.1) added
+//                                          +    Payload size check added to reception
+// 3.3        2026-10-19    Ahmed Gazar     +    Multiplexed frame layer (protocol 2.2) added with
+//                                               transaction IDs, replaces protocol 2.1
+//                                          +    Asynchronous request and response API added
+//                                          *    TX mutexes lock single frames
+// 3.4        2026-10-19    Ahmed Gazar     +    Compressed chunk frames (protocol 2.3) added
+// 3.5        2026-10-19    Ahmed Gazar     +    Vectored frame transmission added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -62,6 +70,7 @@
 #include <gos_crc_driver.h>
 #include <gos_gcp.h>
 #include <gos_mutex.h>
+#include <gos_trigger.h>
 #include <string.h>
 
 /*
@@ -72,50 +81,239 @@
  */
 #define GCP_PROTOCOL_VERSION_MAJOR    ( 2 )
 
+/**
+ * GCP protocol version low byte of the stop-and-wait mode.
+ */
+#define GCP_PROTOCOL_MINOR_BASIC      ( 0 )
+
+/**
+ * GCP protocol version low byte of the multiplexed mode.
+ */
+#define GCP_PROTOCOL_MINOR_MULTIPLEXED ( 2 )
+
+/**
+ * GCP protocol version low byte of the multiplexed mode with compressed chunks.
+ */
+#define GCP_PROTOCOL_MINOR_COMPRESSED ( 3 )
+
 /**
  * GCP protocol version low byte.
  */
-#define GCP_PROTOCOL_VERSION_MINOR    ( 0 )
+#if CFG_GCP_COMPRESSION == 1
+#define GCP_PROTOCOL_VERSION_MINOR    ( GCP_PROTOCOL_MINOR_COMPRESSED )
+#else
+#define GCP_PROTOCOL_VERSION_MINOR    ( GCP_PROTOCOL_MINOR_MULTIPLEXED )
+#endif
+
+/**
+ * Maximum window size (limited by the selective acknowledge mask).
+ */
+#define GCP_WINDOW_MAX                ( 32u )
+
+/**
+ * Last chunk of the round flag (message ID field of chunk frames).
+ */
+#define GCP_CHUNK_LAST_FLAG           ( 0x8000u )
+
+/**
+ * Chunk sequence mask (message ID field of chunk frames).
+ */
+#define GCP_CHUNK_SEQUENCE_MASK       ( 0x7FFFu )
+
+/**
+ * Response direction flag (transaction ID field).
+ */
+#define GCP_TRANSACTION_RESPONSE_FLAG ( 0x80u )
+
+/**
+ * Transaction ID mask (transaction ID field).
+ */
+#define GCP_TRANSACTION_ID_MASK       ( 0x7Fu )
+
+/**
+ * Size of the buffer used to drop the data of chunks without a transfer.
+ */
+#define GCP_DISCARD_BUFFER_SIZE       ( 16u )
+
+/**
+ * Size of the raw chunk size field preceding the compressed data.
+ */
+#define GCP_LZ_SIZE_FIELD             ( 2u )
+
+/**
+ * Minimum chunk size to try compression on.
+ */
+#define GCP_LZ_MIN_CHUNK_SIZE         ( 16u )
+
+/**
+ * Maximum length of a literal run (token 0x00-0x7F: 1-128 literals follow).
+ */
+#define GCP_LZ_LITERAL_MAX            ( 128u )
+
+/**
+ * Match token flag (token 1LLLLOOO OOOOOOOO: length - 3, offset - 1).
+ */
+#define GCP_LZ_MATCH_FLAG             ( 0x80u )
+
+/**
+ * Minimum match length.
+ */
+#define GCP_LZ_MATCH_MIN              ( 3u )
+
+/**
+ * Maximum match length.
+ */
+#define GCP_LZ_MATCH_MAX              ( 18u )
+
+/**
+ * Maximum match offset (window size).
+ */
+#define GCP_LZ_OFFSET_MAX             ( 2048u )
+
+/**
+ * Multiplier of the compressor hash function.
+ */
+#define GCP_LZ_HASH_MULTIPLIER        ( 2654435761u )
+
+#if CFG_GCP_WINDOW_SIZE < 1 || CFG_GCP_WINDOW_SIZE > 32
+#error "gos_gcp.c: CFG_GCP_WINDOW_SIZE shall be between 1 and 32."
+#endif
+
+#if CFG_GCP_MAX_TRANSACTIONS < 1 || CFG_GCP_MAX_TRANSACTIONS > 255
+#error "gos_gcp.c: CFG_GCP_MAX_TRANSACTIONS shall be between 1 and 255."
+#endif
+
+#if CFG_GCP_COMPRESSION == 1
+#if CFG_GCP_COMPRESSION_HASH_BITS < 4 || CFG_GCP_COMPRESSION_HASH_BITS > 12
+#error "gos_gcp.c: CFG_GCP_COMPRESSION_HASH_BITS shall be between 4 and 12."
+#endif
+
+#if CFG_GCP_COMPRESSION_BUFFER_SIZE < GCP_LZ_MIN_CHUNK_SIZE || CFG_GCP_COMPRESSION_BUFFER_SIZE > 0xFFFF
+#error "gos_gcp.c: CFG_GCP_COMPRESSION_BUFFER_SIZE shall be between 16 and 65535."
+#endif
+#endif
 
 /*
  * Type definitions
  */
 /**
- * GCP acknowledge type.
+ * GCP acknowledge (frame) type.
  */
 typedef enum
 {
-    GCP_ACK_REQ           = 0, //!< Request.
+    GCP_ACK_REQ           = 0, //!< Request (message header).
     GCP_ACK_OK            = 1, //!< OK.
     GCP_ACK_CRC_ERROR     = 2, //!< CRC error.
-    GCP_ACK_RESEND        = 3, //!< Re-send request.
+    GCP_ACK_RESEND        = 3, //!< Re-send request (receiver busy).
     GCP_ACK_SIZE_ERROR    = 4, //!< Size error.
     GCP_ACK_PV_ERROR      = 5, //!< Protocol version error.
     GCP_ACK_INVALID       = 6, //!< Invalid message.
+    GCP_ACK_REQ_PROBE     = 7, //!< Request with acknowledge before data (protocol 2.2).
+    GCP_FRAME_CHUNK       = 8, //!< Payload chunk (protocol 2.2).
+    GCP_FRAME_CHUNK_LZ    = 9, //!< Compressed payload chunk (protocol 2.3).
 }gos_gcpAck_t;
 
 /**
- * GCP frame header type.
+ * GCP frame header type. In protocol 2.2 every frame starts with this header:
+ * - message header: ack type is request, data size and CRC describe the whole payload,
+ * - chunk frame: message ID is the chunk sequence (bit 15: last chunk of the round),
+ *   data size and CRC describe the chunk data following the header,
+ * - acknowledge: data size is the number of chunks received in sequence, data CRC is
+ *   the selective acknowledge mask (bit i set: chunk [data size + i] received).
+ * In protocol 2.3 the data of a compressed chunk frame is the raw chunk size (2 bytes,
+ * little endian) and the compressed chunk, the data CRC describes the raw chunk.
  */
 typedef struct
 {
     u8_t  protocolMajor;   //!< Protocol version major.
     u8_t  protocolMinor;   //!< Protocol version minor.
     u8_t  ackType;         //!< Acknowledge type.
-    u8_t  dummy;           //!< Dummy byte (padding).
+    u8_t  transactionId;   //!< Transaction ID (bit 7: response), 0 in protocol 2.0.
     u16_t messageId;       //!< Message ID.
     u16_t dataSize;        //!< Data size.
     u32_t dataCrc;         //!< Data CRC.
     u32_t headerCrc;       //!< Header CRC.
 }gos_gcpHeaderFrame_t;
 
+/**
+ * GCP peer mode type.
+ */
+typedef enum
+{
+    GCP_PEER_UNKNOWN,      //!< Not known yet, messages are probed.
+    GCP_PEER_MULTIPLEXED,  //!< Peer supports protocol 2.2.
+    GCP_PEER_COMPRESSED,   //!< Peer supports protocol 2.3.
+    GCP_PEER_BASIC         //!< Peer only supports the stop-and-wait mode.
+}gos_gcpPeerMode_t;
+
+/**
+ * GCP transaction slot type.
+ */
+typedef enum
+{
+    GCP_SLOT_FREE,         //!< Slot is free.
+    GCP_SLOT_TX,           //!< Outgoing transfer (collects the acknowledges).
+    GCP_SLOT_REQUEST,      //!< Incoming request.
+    GCP_SLOT_RESPONSE      //!< Incoming response to a submitted request.
+}gos_gcpSlotType_t;
+
+/**
+ * GCP transaction slot. Frames read from a channel are routed to the slots by
+ * their transaction ID.
+ */
+typedef struct
+{
+    gos_gcpSlotType_t         type;          //!< Slot type.
+    gos_gcpChannelNumber_t    channel;       //!< Channel of the transfer.
+    u8_t                      transactionId; //!< Transaction ID field of the frames.
+    bool_t                    bound;         //!< Message header received (RX slots).
+    bool_t                    probing;       //!< Probe sent (TX slots).
+    bool_t                    ready;         //!< Transfer finished or acknowledge received.
+    gos_result_t              result;        //!< Result of the transfer.
+    gos_gcpHeaderFrame_t      header;        //!< Message header (RX) or last acknowledge (TX).
+    u8_t*                     pTarget;       //!< Payload target buffer (RX).
+    u16_t                     targetSize;    //!< Size of the payload target buffer.
+    u16_t                     maxChunkSize;  //!< Chunk size of the stop-and-wait mode (RX).
+    u16_t                     chunkSize;     //!< Chunk size of the sender (RX).
+    u16_t                     baseChunk;     //!< Number of chunks received in sequence (RX).
+    u32_t                     ackMask;       //!< Selective acknowledge mask (RX).
+    u32_t                     lastActivity;  //!< System ticks of the last activity.
+    gos_gcpResponseCallback_t callback;      //!< Completion callback (submitted requests).
+    gos_trigger_t             trigger;       //!< Trigger to wake up the owner task.
+}gos_gcpTransaction_t;
+
+/**
+ * GCP channel state type.
+ */
+typedef struct
+{
+    gos_gcpPeerMode_t peerMode;          //!< Protocol mode of the peer.
+    u8_t              nextTransactionId; //!< Next transaction ID to allocate.
+    u8_t              rxHoldCounter;     //!< Number of tasks waiting for exclusive reception.
+    u8_t              lastTransactionId; //!< Transaction ID of the last completed reception.
+    u8_t              lastAck;           //!< Final acknowledge of the last completed reception.
+    u16_t             lastChunks;        //!< Chunks of the last completed reception.
+    u32_t             lastTicks;         //!< System ticks of the last completed reception.
+}gos_gcpChannelState_t;
+
+/**
+ * GCP transaction binding type (task serving an incoming request).
+ */
+typedef struct
+{
+    gos_tid_t              taskId;        //!< Bound task.
+    gos_gcpChannelNumber_t channel;       //!< Channel of the request.
+    u8_t                   transactionId; //!< Transaction ID of the request.
+}gos_gcpBinding_t;
+
 /**
  * GCP channel functions type.
  */
 typedef struct
 {
-    gos_gcpTransmitFunction_t gcpTransmitFunction; //!< GCP transmit function.
-    gos_gcpReceiveFunction_t  gcpReceiveFunction;  //!< GCP receive function.
+    gos_gcpTransmitFunction_t       gcpTransmitFunction;       //!< GCP transmit function.
+    gos_gcpTransmitVectorFunction_t gcpTransmitVectorFunction; //!< GCP vectored transmit function.
+    gos_gcpReceiveFunction_t        gcpReceiveFunction;        //!< GCP receive function.
 }gos_gcpChannelFunctions_t;
 
 /*
@@ -127,34 +325,181 @@ typedef struct
 GOS_STATIC gos_gcpChannelFunctions_t channelFunctions [CFG_GCP_CHANNELS_MAX_NUMBER];
 
 /**
- * GCP RX mutex array.
+ * GCP RX mutex array (held by the task reading the frames of the channel).
  */
 GOS_STATIC gos_mutex_t gcpRxMutexes [CFG_GCP_CHANNELS_MAX_NUMBER];
 
 /**
- * GCP TX mutex array.
+ * GCP TX mutex array (held for one frame).
  */
 GOS_STATIC gos_mutex_t gcpTxMutexes [CFG_GCP_CHANNELS_MAX_NUMBER];
 
+/**
+ * Channel states.
+ */
+GOS_STATIC gos_gcpChannelState_t channelStates [CFG_GCP_CHANNELS_MAX_NUMBER];
+
+/**
+ * Transaction slots.
+ */
+GOS_STATIC gos_gcpTransaction_t  transactions [CFG_GCP_MAX_TRANSACTIONS];
+
+/**
+ * Transaction bindings.
+ */
+GOS_STATIC gos_gcpBinding_t      bindings [CFG_GCP_MAX_TRANSACTIONS];
+
+#if CFG_GCP_COMPRESSION == 1
+/**
+ * Compressor mutex (held while a compressed chunk is built and transmitted).
+ */
+GOS_STATIC gos_mutex_t gcpCompressionMutex;
+
+/**
+ * Compressed chunk buffer.
+ */
+GOS_STATIC u8_t        gcpCompressionBuffer [CFG_GCP_COMPRESSION_BUFFER_SIZE];
+
+/**
+ * Compressor hash table (last position + 1 of each 3-byte hash).
+ */
+GOS_STATIC u16_t       gcpCompressionHash [1u << CFG_GCP_COMPRESSION_HASH_BITS];
+#endif
+
 /*
  * Function prototypes
  */
-GOS_STATIC GOS_INLINE gos_result_t gos_gcpTransmitMessageInternal (
+GOS_STATIC gos_result_t gos_gcpTransmitInternal (
         gos_gcpChannelNumber_t  channel,
+        u8_t                    transactionId,
         u16_t                   messageId,
         void_t*                 pMessagePayload,
         u16_t                   payloadSize,
         u16_t                   maxChunkSize
         );
 
-GOS_STATIC GOS_INLINE gos_result_t gos_gcpReceiveMessageInternal (
+GOS_STATIC gos_result_t gos_gcpTransmitMultiplexed (
         gos_gcpChannelNumber_t  channel,
-        u16_t*                  pMessageId,
-        void_t*                 pPayloadTarget,
+        u8_t                    transactionId,
+        u16_t                   messageId,
+        u8_t*                   pMessagePayload,
+        u16_t                   payloadSize,
+        u16_t                   maxChunkSize
+        );
+
+GOS_STATIC gos_result_t gos_gcpTransmitBasic (
+        gos_gcpChannelNumber_t  channel,
+        u16_t                   messageId,
+        u8_t*                   pMessagePayload,
+        u16_t                   payloadSize,
+        u16_t                   maxChunkSize
+        );
+
+GOS_STATIC gos_result_t gos_gcpReadFrame (
+        gos_gcpChannelNumber_t  channel
+        );
+
+GOS_STATIC void_t gos_gcpHandleMessageHeader (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpHeaderFrame_t*   pHeader
+        );
+
+GOS_STATIC gos_result_t gos_gcpHandleChunk (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpHeaderFrame_t*   pHeader
+        );
+
+GOS_STATIC void_t gos_gcpHandleAck (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpHeaderFrame_t*   pHeader
+        );
+
+GOS_STATIC void_t gos_gcpReceiveBasic (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpHeaderFrame_t*   pHeader
+        );
+
+GOS_STATIC gos_result_t gos_gcpWaitSlot (
+        gos_gcpTransaction_t*   pSlot,
+        u32_t                   timeoutMs
+        );
+
+GOS_STATIC gos_gcpTransaction_t* gos_gcpAllocateSlot (
+        gos_gcpSlotType_t       type,
+        gos_gcpChannelNumber_t  channel,
+        u8_t                    transactionId,
+        u8_t*                   pTarget,
         u16_t                   targetSize,
         u16_t                   maxChunkSize
         );
 
+GOS_STATIC gos_gcpTransaction_t* gos_gcpFindSlot (
+        gos_gcpSlotType_t       type,
+        gos_gcpChannelNumber_t  channel,
+        u8_t                    transactionId,
+        bool_t                  bound
+        );
+
+GOS_STATIC void_t gos_gcpCompleteSlot (
+        gos_gcpTransaction_t*   pSlot,
+        gos_result_t            result
+        );
+
+GOS_STATIC void_t gos_gcpReleaseSlot (
+        gos_gcpTransaction_t*   pSlot,
+        bool_t                  lockReception
+        );
+
+GOS_STATIC void_t gos_gcpExpireSlots (
+        gos_gcpChannelNumber_t  channel
+        );
+
+GOS_STATIC u8_t gos_gcpGetNewTransactionId (
+        gos_gcpChannelNumber_t  channel
+        );
+
+GOS_STATIC u8_t gos_gcpGetBoundTransactionId (
+        gos_gcpChannelNumber_t  channel
+        );
+
+GOS_STATIC gos_result_t gos_gcpTransmitFrame (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpHeaderFrame_t*   pHeader,
+        u8_t*                   pData,
+        u16_t                   dataSize
+        );
+
+GOS_STATIC gos_result_t gos_gcpTransmitChunk (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpHeaderFrame_t*   pHeader,
+        u8_t*                   pData
+        );
+
+GOS_STATIC gos_result_t gos_gcpSendAck (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpHeaderFrame_t*   pFrame,
+        gos_gcpAck_t            ackType,
+        u16_t                   chunksInSequence,
+        u32_t                   ackMask
+        );
+
+GOS_STATIC void_t gos_gcpDiscard (
+        gos_gcpChannelNumber_t  channel,
+        u16_t                   size
+        );
+
+GOS_STATIC void_t gos_gcpResync (
+        gos_gcpChannelNumber_t  channel
+        );
+
+GOS_STATIC gos_result_t gos_gcpLockReception (
+        gos_gcpChannelNumber_t  channel
+        );
+
+GOS_STATIC void_t gos_gcpUnlockReception (
+        gos_gcpChannelNumber_t  channel
+        );
+
 GOS_STATIC gos_result_t gos_gcpValidateHeader (
         gos_gcpHeaderFrame_t*   pHeader,
         gos_gcpAck_t*           pAck
@@ -166,6 +511,22 @@ GOS_STATIC gos_result_t gos_gcpValidateData (
         gos_gcpAck_t*           pAck
         );
 
+#if CFG_GCP_COMPRESSION == 1
+GOS_STATIC u16_t gos_gcpCompressChunk (
+        u8_t*                   pSource,
+        u16_t                   sourceSize,
+        u8_t*                   pTarget,
+        u16_t                   targetSize
+        );
+#endif
+
+GOS_STATIC gos_result_t gos_gcpDecompressChunk (
+        gos_gcpHeaderFrame_t*   pHeader,
+        u8_t*                   pChunk,
+        u16_t                   chunkLength,
+        u16_t                   dataSize
+        );
+
 /*
  * Function: gos_gcpInit
  */
@@ -176,6 +537,7 @@ gos_result_t gos_gcpInit (void_t)
      */
     gos_result_t gcpInitResult = GOS_SUCCESS;
     u16_t        mutexIdx      = 0u;
+    u16_t        slotIdx       = 0u;
 
     /*
      * Function code.
@@ -184,6 +546,20 @@ gos_result_t gos_gcpInit (void_t)
     {
         GOS_CONCAT_RESULT(gcpInitResult, gos_mutexInit(&gcpRxMutexes[mutexIdx]));
         GOS_CONCAT_RESULT(gcpInitResult, gos_mutexInit(&gcpTxMutexes[mutexIdx]));
+
+        channelStates[mutexIdx].peerMode          = GCP_PEER_UNKNOWN;
+        channelStates[mutexIdx].nextTransactionId = 1u;
+    }
+
+#if CFG_GCP_COMPRESSION == 1
+    GOS_CONCAT_RESULT(gcpInitResult, gos_mutexInit(&gcpCompressionMutex));
+#endif
+
+    for (slotIdx = 0u; slotIdx < CFG_GCP_MAX_TRANSACTIONS; slotIdx++)
+    {
+        transactions[slotIdx].type = GCP_SLOT_FREE;
+        bindings[slotIdx].taskId   = GOS_INVALID_TASK_ID;
+        GOS_CONCAT_RESULT(gcpInitResult, gos_triggerInit(&transactions[slotIdx].trigger));
     }
 
     return gcpInitResult;
@@ -193,9 +569,10 @@ gos_result_t gos_gcpInit (void_t)
  * Function: gos_gcpRegisterPhysicalDriver
  */
 gos_result_t gos_gcpRegisterPhysicalDriver (
-        gos_gcpChannelNumber_t    channelNumber,
-        gos_gcpTransmitFunction_t transmitFunction,
-        gos_gcpReceiveFunction_t  receiveFunction
+        gos_gcpChannelNumber_t          channelNumber,
+        gos_gcpTransmitFunction_t       transmitFunction,
+        gos_gcpTransmitVectorFunction_t transmitVectorFunction,
+        gos_gcpReceiveFunction_t        receiveFunction
         )
 {
     /*
@@ -208,9 +585,10 @@ gos_result_t gos_gcpRegisterPhysicalDriver (
      */
     if (channelNumber < CFG_GCP_CHANNELS_MAX_NUMBER && transmitFunction != NULL && receiveFunction != NULL)
     {
-        channelFunctions[channelNumber].gcpReceiveFunction  = receiveFunction;
-        channelFunctions[channelNumber].gcpTransmitFunction = transmitFunction;
-        registerPhysicalDriverResult                        = GOS_SUCCESS;
+        channelFunctions[channelNumber].gcpReceiveFunction        = receiveFunction;
+        channelFunctions[channelNumber].gcpTransmitFunction       = transmitFunction;
+        channelFunctions[channelNumber].gcpTransmitVectorFunction = transmitVectorFunction;
+        registerPhysicalDriverResult                              = GOS_SUCCESS;
     }
     else
     {
@@ -235,21 +613,32 @@ gos_result_t gos_gcpTransmitMessage (
      * Local variables.
      */
     gos_result_t transmitMessageResult = GOS_ERROR;
+    u8_t         transactionId         = GOS_GCP_NO_TRANSACTION;
 
     /*
      * Function code.
      */
-    if (gos_mutexLock(&gcpTxMutexes[channel], GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    if (channel < CFG_GCP_CHANNELS_MAX_NUMBER)
     {
-        transmitMessageResult = gos_gcpTransmitMessageInternal(channel, messageId, pMessagePayload, payloadSize, maxChunkSize);
+        transactionId = gos_gcpGetBoundTransactionId(channel);
+
+        if (transactionId != GOS_GCP_NO_TRANSACTION)
+        {
+            // Response to the request served by the calling task.
+            transactionId |= GCP_TRANSACTION_RESPONSE_FLAG;
+        }
+        else
+        {
+            transactionId = gos_gcpGetNewTransactionId(channel);
+        }
+
+        transmitMessageResult = gos_gcpTransmitInternal(channel, transactionId, messageId, pMessagePayload, payloadSize, maxChunkSize);
     }
     else
     {
-        // Mutex error.
+        // Invalid channel.
     }
 
-    (void_t) gos_mutexUnlock(&gcpTxMutexes[channel]);
-
     return transmitMessageResult;
 }
 
@@ -267,298 +656,2022 @@ gos_result_t gos_gcpReceiveMessage (
     /*
      * Local variables.
      */
-    gos_result_t receiveMessageResult = GOS_ERROR;
+    gos_result_t           receiveMessageResult = GOS_ERROR;
+    gos_gcpTransactionId_t transactionId        = GOS_GCP_NO_TRANSACTION;
 
     /*
      * Function code.
      */
-    if (gos_mutexLock(&gcpRxMutexes[channel], GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    receiveMessageResult = gos_gcpReceiveRequest(channel, pMessageId, &transactionId, pPayloadTarget, targetSize, maxChunkSize);
+
+    if (receiveMessageResult == GOS_SUCCESS)
     {
-        receiveMessageResult = gos_gcpReceiveMessageInternal(channel, pMessageId, pPayloadTarget, targetSize, maxChunkSize);
+        // Messages sent by the calling task answer this request.
+        (void_t) gos_gcpBindTransaction(channel, transactionId);
     }
     else
     {
-        // Nothing to do.
+        // Reception error.
     }
 
-    gos_mutexUnlock(&gcpRxMutexes[channel]);
-
     return receiveMessageResult;
 }
 
-/**
- * @brief   Internal transmitter function (re-entrant).
- * @details Transmits a message over GCP (header request, payload, and
- *          then receives a response header).
- *
- * @param[in] channel         GCP channel number.
- * @param[in] messageId       ID of the message.
- * @param[in] pMessagePayload Pointer to the payload buffer.
- * @param[in] payloadSize     Size of the payload (number of bytes).
- * @param[in] maxChunkSize    Maximum chunk size (in bytes).
- *
- * @return  Result of message transmission.
- *
- * @retval  #GOS_SUCCESS Transmission successful.
- * @retval  #GOS_ERROR   One of the function parameters are invalid or
- *                       there was a transmission or reception error.
+/*
+ * Function: gos_gcpReceiveRequest
  */
-GOS_STATIC GOS_INLINE gos_result_t gos_gcpTransmitMessageInternal (
+gos_result_t gos_gcpReceiveRequest (
         gos_gcpChannelNumber_t  channel,
-        u16_t                   messageId,
-        void_t*                 pMessagePayload,
-        u16_t                   payloadSize,
+        u16_t*                  pMessageId,
+        gos_gcpTransactionId_t* pTransactionId,
+        void_t*                 pPayloadTarget,
+        u16_t                   targetSize,
         u16_t                   maxChunkSize
-)
+        )
 {
     /*
      * Local variables.
      */
-    gos_result_t         transmitMessageResult = GOS_ERROR;
-    gos_gcpHeaderFrame_t requestHeaderFrame    = {0};
-    gos_gcpHeaderFrame_t responseHeaderFrame   = {0};
-    gos_gcpAck_t         headerAck             = (gos_gcpAck_t)0u;
-    u8_t                 dataChunks            = 0u;
-    u8_t                 chunkIndex            = 0u;
-    u16_t                tempSize              = 0u;
+    gos_result_t          receiveRequestResult = GOS_ERROR;
+    gos_gcpTransaction_t* pSlot                = NULL;
 
     /*
      * Function code.
      */
-    if ((pMessagePayload                              != NULL                        ||
-        (pMessagePayload                              == NULL                        &&
-        payloadSize                                   == 0u))                        &&
-        channel                                       <  CFG_GCP_CHANNELS_MAX_NUMBER &&
-        channelFunctions[channel].gcpTransmitFunction != NULL)
+    if (pMessageId                                   != NULL                        &&
+        pTransactionId                               != NULL                        &&
+        pPayloadTarget                               != NULL                        &&
+        maxChunkSize                                 != 0u                          &&
+        channel                                      <  CFG_GCP_CHANNELS_MAX_NUMBER &&
+        channelFunctions[channel].gcpReceiveFunction != NULL)
+    {
+        pSlot = gos_gcpAllocateSlot(GCP_SLOT_REQUEST, channel, GOS_GCP_NO_TRANSACTION, (u8_t*)pPayloadTarget, targetSize, maxChunkSize);
+    }
+    else
     {
-        // Fill out header frame.
-        requestHeaderFrame.ackType       = GCP_ACK_REQ;
-        requestHeaderFrame.protocolMajor = GCP_PROTOCOL_VERSION_MAJOR;
-        requestHeaderFrame.protocolMinor = GCP_PROTOCOL_VERSION_MINOR;
-        requestHeaderFrame.dataSize      = payloadSize;
-        requestHeaderFrame.messageId     = messageId;
-        requestHeaderFrame.dataCrc       = gos_crcDriverGetCrc((u8_t*)pMessagePayload, payloadSize);
-        requestHeaderFrame.headerCrc     = gos_crcDriverGetCrc((u8_t*)&requestHeaderFrame, (u32_t)(sizeof(requestHeaderFrame) - sizeof(requestHeaderFrame.headerCrc)));
+        // Nothing to do.
+    }
 
-        if (channelFunctions[channel].gcpTransmitFunction((u8_t*)&requestHeaderFrame, (u16_t)sizeof(requestHeaderFrame)) == GOS_SUCCESS)
+    if (pSlot != NULL)
+    {
+        while (gos_gcpWaitSlot(pSlot, CFG_GCP_ACK_TMO_MS) != GOS_SUCCESS)
         {
-            if (requestHeaderFrame.dataSize == 0u)
+            if (pSlot->bound == GOS_TRUE && (gos_kernelGetSysTicks() - pSlot->lastActivity) > CFG_GCP_RESPONSE_TMO_MS)
             {
-                if (channelFunctions[channel].gcpReceiveFunction((u8_t*)&responseHeaderFrame, (u16_t)sizeof(responseHeaderFrame)) == GOS_SUCCESS &&
-                    gos_gcpValidateHeader(&responseHeaderFrame, &headerAck) == GOS_SUCCESS &&
-                    responseHeaderFrame.ackType == GCP_ACK_OK    )
+                // Sender disappeared, wait for the next request.
+                if (gos_gcpLockReception(channel) == GOS_SUCCESS)
                 {
-                    // Transmission successful.
-                    transmitMessageResult = GOS_SUCCESS;
+                    if (pSlot->ready == GOS_FALSE)
+                    {
+                        pSlot->bound = GOS_FALSE;
+                    }
+                    else
+                    {
+                        // Completed in the meantime.
+                    }
+                    gos_gcpUnlockReception(channel);
                 }
                 else
                 {
-                    // Error.
+                    // Mutex error.
                 }
             }
             else
             {
-                dataChunks = requestHeaderFrame.dataSize / maxChunkSize;
+                // Keep waiting.
+            }
+        }
 
-                if (requestHeaderFrame.dataSize % maxChunkSize != 0)
-                {
-                    dataChunks++;
-                }
-                else
-                {
-                    // Chunk number is exact.
-                }
+        *pMessageId          = pSlot->header.messageId;
+        *pTransactionId      = ((pSlot->transactionId & GCP_TRANSACTION_RESPONSE_FLAG) == 0u) ? pSlot->transactionId : GOS_GCP_NO_TRANSACTION;
+        receiveRequestResult = pSlot->result;
 
-                for (chunkIndex = 0u; chunkIndex < dataChunks; chunkIndex++)
-                {
-                    if ((chunkIndex + 1) * maxChunkSize > requestHeaderFrame.dataSize)
-                    {
-                        tempSize = requestHeaderFrame.dataSize - chunkIndex * maxChunkSize;
-                    }
-                    else
-                    {
-                        tempSize = maxChunkSize;
-                    }
+        gos_gcpReleaseSlot(pSlot, GOS_FALSE);
+    }
+    else
+    {
+        // Invalid parameters or no free slot.
+    }
 
-                    if (channelFunctions[channel].gcpTransmitFunction((u8_t*)(pMessagePayload + chunkIndex * maxChunkSize), tempSize) == GOS_SUCCESS &&
-                        channelFunctions[channel].gcpReceiveFunction((u8_t*)&responseHeaderFrame, (u16_t)sizeof(responseHeaderFrame)) == GOS_SUCCESS &&
-                        gos_gcpValidateHeader(&responseHeaderFrame, &headerAck) == GOS_SUCCESS &&
-                        responseHeaderFrame.ackType == GCP_ACK_OK    )
-                    {
-                        // Transmission successful.
-                        // Set temporary success.
-                        transmitMessageResult = GOS_SUCCESS;
-                    }
-                    else
-                    {
-                        // Error.
-                        transmitMessageResult = GOS_ERROR;
-                        break;
-                    }
+    return receiveRequestResult;
+}
+
+/*
+ * Function: gos_gcpTransmitResponse
+ */
+gos_result_t gos_gcpTransmitResponse (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpTransactionId_t  transactionId,
+        u16_t                   messageId,
+        void_t*                 pMessagePayload,
+        u16_t                   payloadSize,
+        u16_t                   maxChunkSize
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t transmitResponseResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (channel < CFG_GCP_CHANNELS_MAX_NUMBER && (transactionId & GCP_TRANSACTION_RESPONSE_FLAG) == 0u)
+    {
+        if (transactionId != GOS_GCP_NO_TRANSACTION)
+        {
+            transactionId |= GCP_TRANSACTION_RESPONSE_FLAG;
+        }
+        else
+        {
+            // Request of a stop-and-wait peer.
+            transactionId = gos_gcpGetNewTransactionId(channel);
+        }
+
+        transmitResponseResult = gos_gcpTransmitInternal(channel, transactionId, messageId, pMessagePayload, payloadSize, maxChunkSize);
+    }
+    else
+    {
+        // Invalid parameters.
+    }
+
+    return transmitResponseResult;
+}
+
+/*
+ * Function: gos_gcpBindTransaction
+ */
+gos_result_t gos_gcpBindTransaction (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpTransactionId_t  transactionId
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t      bindResult   = GOS_ERROR;
+    gos_tid_t         currentId    = GOS_INVALID_TASK_ID;
+    gos_gcpBinding_t* pBinding     = NULL;
+    gos_gcpBinding_t* pFreeBinding = NULL;
+    u16_t             bindingIdx   = 0u;
+
+    /*
+     * Function code.
+     */
+    if (channel < CFG_GCP_CHANNELS_MAX_NUMBER &&
+        (transactionId & GCP_TRANSACTION_RESPONSE_FLAG) == 0u &&
+        gos_taskGetCurrentId(&currentId) == GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        for (bindingIdx = 0u; bindingIdx < CFG_GCP_MAX_TRANSACTIONS; bindingIdx++)
+        {
+            if (bindings[bindingIdx].taskId == currentId && bindings[bindingIdx].channel == channel)
+            {
+                pBinding = &bindings[bindingIdx];
+                break;
+            }
+            else if (bindings[bindingIdx].taskId == GOS_INVALID_TASK_ID && pFreeBinding == NULL)
+            {
+                pFreeBinding = &bindings[bindingIdx];
+            }
+            else
+            {
+                // Continue.
+            }
+        }
+
+        if (pBinding == NULL && transactionId != GOS_GCP_NO_TRANSACTION)
+        {
+            pBinding = pFreeBinding;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        if (pBinding != NULL)
+        {
+            pBinding->taskId        = (transactionId != GOS_GCP_NO_TRANSACTION) ? currentId : GOS_INVALID_TASK_ID;
+            pBinding->channel       = channel;
+            pBinding->transactionId = transactionId;
+            bindResult              = GOS_SUCCESS;
+        }
+        else if (transactionId == GOS_GCP_NO_TRANSACTION)
+        {
+            // Nothing was bound.
+            bindResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // No free binding.
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Invalid parameters.
+    }
+
+    return bindResult;
+}
+
+/*
+ * Function: gos_gcpSubmitRequest
+ */
+gos_result_t gos_gcpSubmitRequest (
+        gos_gcpChannelNumber_t    channel,
+        u16_t                     messageId,
+        void_t*                   pMessagePayload,
+        u16_t                     payloadSize,
+        u16_t                     maxChunkSize,
+        void_t*                   pResponseTarget,
+        u16_t                     responseTargetSize,
+        gos_gcpResponseCallback_t responseCallback,
+        gos_gcpTransactionId_t*   pTransactionId
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t          submitResult  = GOS_ERROR;
+    gos_gcpTransaction_t* pSlot         = NULL;
+    u8_t                  transactionId = GOS_GCP_NO_TRANSACTION;
+
+    /*
+     * Function code.
+     */
+    if (channel          <  CFG_GCP_CHANNELS_MAX_NUMBER &&
+        pResponseTarget  != NULL                        &&
+        maxChunkSize     != 0u                          &&
+        (responseCallback != NULL || pTransactionId != NULL))
+    {
+        // The response slot exists before the request leaves, so an early
+        // response is routed.
+        transactionId = gos_gcpGetNewTransactionId(channel);
+        pSlot         = gos_gcpAllocateSlot(GCP_SLOT_RESPONSE, channel, transactionId | GCP_TRANSACTION_RESPONSE_FLAG,
+                                            (u8_t*)pResponseTarget, responseTargetSize, maxChunkSize);
+    }
+    else
+    {
+        // Invalid parameters.
+    }
+
+    if (pSlot != NULL)
+    {
+        pSlot->callback = responseCallback;
+        submitResult    = gos_gcpTransmitInternal(channel, transactionId, messageId, pMessagePayload, payloadSize, maxChunkSize);
+
+        if (submitResult == GOS_SUCCESS)
+        {
+            if (pTransactionId != NULL)
+            {
+                *pTransactionId = transactionId;
+            }
+            else
+            {
+                // Completion is reported by the callback.
+            }
+        }
+        else
+        {
+            gos_gcpReleaseSlot(pSlot, GOS_TRUE);
+        }
+    }
+    else
+    {
+        // Invalid parameters or no free slot.
+    }
+
+    return submitResult;
+}
+
+/*
+ * Function: gos_gcpWaitResponse
+ */
+gos_result_t gos_gcpWaitResponse (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpTransactionId_t  transactionId,
+        u16_t*                  pMessageId,
+        u32_t                   timeoutMs
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t          waitResult = GOS_ERROR;
+    gos_gcpTransaction_t* pSlot      = NULL;
+    u16_t                 slotIdx    = 0u;
+
+    /*
+     * Function code.
+     */
+    if (channel < CFG_GCP_CHANNELS_MAX_NUMBER && pMessageId != NULL && transactionId != GOS_GCP_NO_TRANSACTION)
+    {
+        GOS_ATOMIC_ENTER
+        for (slotIdx = 0u; slotIdx < CFG_GCP_MAX_TRANSACTIONS; slotIdx++)
+        {
+            if (transactions[slotIdx].type          == GCP_SLOT_RESPONSE &&
+                transactions[slotIdx].channel       == channel           &&
+                transactions[slotIdx].transactionId == (transactionId | GCP_TRANSACTION_RESPONSE_FLAG))
+            {
+                pSlot = &transactions[slotIdx];
+                break;
+            }
+            else
+            {
+                // Continue.
+            }
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Invalid parameters.
+    }
+
+    if (pSlot != NULL && pSlot->callback == NULL)
+    {
+        if (gos_gcpWaitSlot(pSlot, timeoutMs) == GOS_SUCCESS)
+        {
+            *pMessageId = pSlot->header.messageId;
+            waitResult  = pSlot->result;
+            gos_gcpReleaseSlot(pSlot, GOS_FALSE);
+        }
+        else
+        {
+            // Timeout, the request is cancelled.
+            gos_gcpReleaseSlot(pSlot, GOS_TRUE);
+        }
+    }
+    else
+    {
+        // Unknown transaction or completed by callback.
+    }
+
+    return waitResult;
+}
+
+/**
+ * @brief   Internal transmitter function.
+ * @details Transmits a message in multiplexed mode, or in stop-and-wait mode if the
+ *          peer only supports that (or turns out to support only that).
+ *
+ * @param[in] channel         GCP channel number.
+ * @param[in] transactionId   Transaction ID field of the frames.
+ * @param[in] messageId       ID of the message.
+ * @param[in] pMessagePayload Pointer to the payload buffer.
+ * @param[in] payloadSize     Size of the payload (number of bytes).
+ * @param[in] maxChunkSize    Maximum chunk size (in bytes).
+ *
+ * @return  Result of message transmission.
+ *
+ * @retval  #GOS_SUCCESS Transmission successful.
+ * @retval  #GOS_ERROR   One of the function parameters are invalid or
+ *                       there was a transmission or reception error.
+ */
+GOS_STATIC gos_result_t gos_gcpTransmitInternal (
+        gos_gcpChannelNumber_t  channel,
+        u8_t                    transactionId,
+        u16_t                   messageId,
+        void_t*                 pMessagePayload,
+        u16_t                   payloadSize,
+        u16_t                   maxChunkSize
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t transmitResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if ((pMessagePayload                              != NULL                        ||
+        (pMessagePayload                              == NULL                        &&
+        payloadSize                                   == 0u))                        &&
+        (maxChunkSize                                 != 0u                          ||
+        payloadSize                                   == 0u)                         &&
+        channel                                       <  CFG_GCP_CHANNELS_MAX_NUMBER &&
+        channelFunctions[channel].gcpTransmitFunction != NULL                        &&
+        channelFunctions[channel].gcpReceiveFunction  != NULL)
+    {
+        if (channelStates[channel].peerMode != GCP_PEER_BASIC)
+        {
+            transmitResult = gos_gcpTransmitMultiplexed(channel, transactionId, messageId, (u8_t*)pMessagePayload, payloadSize, maxChunkSize);
+        }
+        else
+        {
+            // Stop-and-wait peer.
+        }
+
+        if (transmitResult != GOS_SUCCESS && channelStates[channel].peerMode == GCP_PEER_BASIC &&
+            gos_gcpLockReception(channel) == GOS_SUCCESS)
+        {
+            // The stop-and-wait mode owns the channel for the whole message.
+            if (gos_mutexLock(&gcpTxMutexes[channel], GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+            {
+                transmitResult = gos_gcpTransmitBasic(channel, messageId, (u8_t*)pMessagePayload, payloadSize, maxChunkSize);
+            }
+            else
+            {
+                // Mutex error.
+            }
+
+            (void_t) gos_mutexUnlock(&gcpTxMutexes[channel]);
+            gos_gcpUnlockReception(channel);
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return transmitResult;
+}
+
+/**
+ * @brief   Multiplexed transmitter function.
+ * @details Sends the message header, then the missing chunks of the window as separate
+ *          chunk frames, and waits for the acknowledge of each round (routed to the
+ *          transmit slot by the task reading the channel). Rounds without an acknowledge
+ *          are re-sent. While the peer mode is not known, the message header is sent as
+ *          a probe and the data only follows its acknowledge. A protocol version error
+ *          of a stop-and-wait peer switches the channel to stop-and-wait mode, the one of
+ *          a protocol 2.2 peer restarts the message without compression.
+ *
+ * @param[in] channel         GCP channel number.
+ * @param[in] transactionId   Transaction ID field of the frames.
+ * @param[in] messageId       ID of the message.
+ * @param[in] pMessagePayload Pointer to the payload buffer.
+ * @param[in] payloadSize     Size of the payload (number of bytes).
+ * @param[in] maxChunkSize    Maximum chunk size (in bytes).
+ *
+ * @return  Result of multiplexed transmission.
+ *
+ * @retval  #GOS_SUCCESS All chunks acknowledged.
+ * @retval  #GOS_ERROR   No free slot, rejected message, transmission error, or too
+ *                       many rounds without progress.
+ */
+GOS_STATIC gos_result_t gos_gcpTransmitMultiplexed (
+        gos_gcpChannelNumber_t  channel,
+        u8_t                    transactionId,
+        u16_t                   messageId,
+        u8_t*                   pMessagePayload,
+        u16_t                   payloadSize,
+        u16_t                   maxChunkSize
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t          transmitResult = GOS_ERROR;
+    gos_gcpTransaction_t* pSlot          = NULL;
+    gos_gcpHeaderFrame_t  messageHeader  = {0};
+    gos_gcpHeaderFrame_t  chunkHeader    = {0};
+    gos_gcpHeaderFrame_t  ackHeader      = {0};
+    u16_t                 chunkSize      = 0u;
+    u16_t                 dataChunks     = 0u;
+    u16_t                 baseChunk      = 0u;
+    u16_t                 sequence       = 0u;
+    u32_t                 ackMask        = 0u;
+    u8_t                  windowIndex    = 0u;
+    u8_t                  lastIndex      = 0u;
+    u8_t                  retryCounter   = 0u;
+    bool_t                headerAcked    = GOS_FALSE;
+    bool_t                sendHeader     = GOS_TRUE;
+    bool_t                finished       = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    chunkSize  = (payloadSize < maxChunkSize) ? payloadSize : maxChunkSize;
+    dataChunks = (chunkSize == 0u) ? 0u : (u16_t)(((u32_t)payloadSize + chunkSize - 1u) / chunkSize);
+    pSlot      = gos_gcpAllocateSlot(GCP_SLOT_TX, channel, transactionId, NULL, 0u, 0u);
+
+    if (pSlot != NULL)
+    {
+        messageHeader.protocolMajor = GCP_PROTOCOL_VERSION_MAJOR;
+        messageHeader.protocolMinor = (channelStates[channel].peerMode == GCP_PEER_MULTIPLEXED) ? GCP_PROTOCOL_MINOR_MULTIPLEXED : GCP_PROTOCOL_VERSION_MINOR;
+        messageHeader.ackType       = (channelStates[channel].peerMode == GCP_PEER_UNKNOWN) ? GCP_ACK_REQ_PROBE : GCP_ACK_REQ;
+        messageHeader.transactionId = transactionId;
+        messageHeader.messageId     = messageId;
+        messageHeader.dataSize      = payloadSize;
+        messageHeader.dataCrc       = gos_crcDriverGetCrc(pMessagePayload, payloadSize);
+        pSlot->probing              = (messageHeader.ackType == GCP_ACK_REQ_PROBE) ? GOS_TRUE : GOS_FALSE;
+        transmitResult              = GOS_SUCCESS;
+    }
+    else
+    {
+        // No free slot.
+    }
+
+    while (transmitResult == GOS_SUCCESS && finished == GOS_FALSE)
+    {
+        GOS_ATOMIC_ENTER
+        pSlot->ready = GOS_FALSE;
+        GOS_ATOMIC_EXIT
+
+        if (sendHeader == GOS_TRUE)
+        {
+            transmitResult = gos_gcpTransmitFrame(channel, &messageHeader, NULL, 0u);
+        }
+        else
+        {
+            // Header already acknowledged.
+        }
+
+        if (transmitResult == GOS_SUCCESS && (headerAcked == GOS_TRUE || pSlot->probing == GOS_FALSE) && baseChunk < dataChunks)
+        {
+            // The last missing chunk of the window closes the round.
+            lastIndex = 0u;
+
+            for (windowIndex = 0u; windowIndex < CFG_GCP_WINDOW_SIZE && (baseChunk + windowIndex) < dataChunks; windowIndex++)
+            {
+                if ((ackMask & ((u32_t)1u << windowIndex)) == 0u)
+                {
+                    lastIndex = windowIndex;
+                }
+                else
+                {
+                    // Chunk already acknowledged.
                 }
             }
+
+            for (windowIndex = 0u; windowIndex <= lastIndex && transmitResult == GOS_SUCCESS; windowIndex++)
+            {
+                if ((ackMask & ((u32_t)1u << windowIndex)) == 0u)
+                {
+                    sequence = baseChunk + windowIndex;
+
+                    chunkHeader               = messageHeader;
+                    chunkHeader.ackType       = GCP_FRAME_CHUNK;
+                    chunkHeader.messageId     = (u16_t)(sequence | ((windowIndex == lastIndex) ? GCP_CHUNK_LAST_FLAG : 0u));
+                    chunkHeader.dataSize      = (u16_t)((((u32_t)sequence + 1u) * chunkSize > payloadSize) ? (payloadSize - sequence * chunkSize) : chunkSize);
+                    chunkHeader.dataCrc       = gos_crcDriverGetCrc(pMessagePayload + sequence * chunkSize, chunkHeader.dataSize);
+                    transmitResult            = gos_gcpTransmitChunk(channel, &chunkHeader, pMessagePayload + sequence * chunkSize);
+                }
+                else
+                {
+                    // Chunk already acknowledged.
+                }
+            }
+        }
+        else
+        {
+            // Waiting for the probe acknowledge.
+        }
+
+        if (transmitResult != GOS_SUCCESS)
+        {
+            // Transmit error.
+        }
+        else if (gos_gcpWaitSlot(pSlot, CFG_GCP_ACK_TMO_MS) == GOS_SUCCESS)
+        {
+            GOS_ATOMIC_ENTER
+            ackHeader = pSlot->header;
+            GOS_ATOMIC_EXIT
+
+            if (ackHeader.protocolMinor == GCP_PROTOCOL_MINOR_BASIC)
+            {
+                // Stop-and-wait peer rejected the probe.
+                channelStates[channel].peerMode = GCP_PEER_BASIC;
+                transmitResult                  = GOS_ERROR;
+            }
+            else if (ackHeader.ackType           == GCP_ACK_PV_ERROR               &&
+                     ackHeader.protocolMinor     == GCP_PROTOCOL_MINOR_MULTIPLEXED &&
+                     messageHeader.protocolMinor != GCP_PROTOCOL_MINOR_MULTIPLEXED)
+            {
+                // Protocol 2.2 peer, start over without compression.
+                channelStates[channel].peerMode = GCP_PEER_MULTIPLEXED;
+                messageHeader.protocolMinor     = GCP_PROTOCOL_MINOR_MULTIPLEXED;
+                headerAcked                     = GOS_FALSE;
+                sendHeader                      = GOS_TRUE;
+                baseChunk                       = 0u;
+                ackMask                         = 0u;
+            }
+            else if (ackHeader.ackType == GCP_ACK_OK && ackHeader.dataSize >= baseChunk && ackHeader.dataSize <= dataChunks)
+            {
+                if (headerAcked == GOS_FALSE || ackHeader.dataSize > baseChunk || (ackHeader.dataCrc & ~ackMask) != 0u)
+                {
+                    retryCounter = 0u;
+                }
+                else
+                {
+                    retryCounter++;
+                }
+
+                headerAcked    = GOS_TRUE;
+                sendHeader     = GOS_FALSE;
+                pSlot->probing = GOS_FALSE;
+                baseChunk      = ackHeader.dataSize;
+                ackMask        = ackHeader.dataCrc;
+                finished       = (baseChunk == dataChunks) ? GOS_TRUE : GOS_FALSE;
+            }
+            else if (ackHeader.ackType == GCP_ACK_RESEND)
+            {
+                // Receiver busy, start over.
+                retryCounter++;
+                headerAcked = GOS_FALSE;
+                sendHeader  = GOS_TRUE;
+                baseChunk   = 0u;
+                ackMask     = 0u;
+                (void_t) gos_taskSleep(CFG_GCP_ACK_TMO_MS);
+            }
+            else
+            {
+                // Rejected.
+                transmitResult = GOS_ERROR;
+            }
+        }
+        else
+        {
+            // Acknowledge lost, re-send the round (and the header if it was not acknowledged).
+            retryCounter++;
+            sendHeader = (headerAcked == GOS_FALSE) ? GOS_TRUE : GOS_FALSE;
+        }
+
+        if (retryCounter > CFG_GCP_MAX_RETRIES)
+        {
+            transmitResult = GOS_ERROR;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    if (pSlot != NULL)
+    {
+        gos_gcpReleaseSlot(pSlot, GOS_FALSE);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return transmitResult;
+}
+
+/**
+ * @brief   Stop-and-wait transmitter function.
+ * @details Transmits a message in protocol 2.0 (header request, payload chunks one by
+ *          one, each acknowledged by a response header). The caller holds the RX and TX
+ *          mutexes of the channel.
+ *
+ * @param[in] channel         GCP channel number.
+ * @param[in] messageId       ID of the message.
+ * @param[in] pMessagePayload Pointer to the payload buffer.
+ * @param[in] payloadSize     Size of the payload (number of bytes).
+ * @param[in] maxChunkSize    Maximum chunk size (in bytes).
+ *
+ * @return  Result of message transmission.
+ *
+ * @retval  #GOS_SUCCESS Transmission successful.
+ * @retval  #GOS_ERROR   There was a transmission or reception error.
+ */
+GOS_STATIC gos_result_t gos_gcpTransmitBasic (
+        gos_gcpChannelNumber_t  channel,
+        u16_t                   messageId,
+        u8_t*                   pMessagePayload,
+        u16_t                   payloadSize,
+        u16_t                   maxChunkSize
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t         transmitMessageResult = GOS_ERROR;
+    gos_gcpHeaderFrame_t requestHeaderFrame    = {0};
+    gos_gcpHeaderFrame_t responseHeaderFrame   = {0};
+    gos_gcpAck_t         headerAck             = (gos_gcpAck_t)0u;
+    u16_t                dataChunks            = 0u;
+    u16_t                chunkIndex            = 0u;
+    u16_t                tempSize              = 0u;
+
+    /*
+     * Function code.
+     */
+    // Fill out header frame.
+    requestHeaderFrame.ackType       = GCP_ACK_REQ;
+    requestHeaderFrame.protocolMajor = GCP_PROTOCOL_VERSION_MAJOR;
+    requestHeaderFrame.protocolMinor = GCP_PROTOCOL_MINOR_BASIC;
+    requestHeaderFrame.dataSize      = payloadSize;
+    requestHeaderFrame.messageId     = messageId;
+    requestHeaderFrame.dataCrc       = gos_crcDriverGetCrc(pMessagePayload, payloadSize);
+    requestHeaderFrame.headerCrc     = gos_crcDriverGetCrc((u8_t*)&requestHeaderFrame, (u32_t)(sizeof(requestHeaderFrame) - sizeof(requestHeaderFrame.headerCrc)));
+
+    if (channelFunctions[channel].gcpTransmitFunction((u8_t*)&requestHeaderFrame, (u16_t)sizeof(requestHeaderFrame)) == GOS_SUCCESS)
+    {
+        if (requestHeaderFrame.dataSize == 0u)
+        {
+            if (channelFunctions[channel].gcpReceiveFunction((u8_t*)&responseHeaderFrame, (u16_t)sizeof(responseHeaderFrame)) == GOS_SUCCESS &&
+                gos_gcpValidateHeader(&responseHeaderFrame, &headerAck) == GOS_SUCCESS &&
+                responseHeaderFrame.ackType == GCP_ACK_OK    )
+            {
+                // Transmission successful.
+                transmitMessageResult = GOS_SUCCESS;
+            }
+            else
+            {
+                // Error.
+            }
+        }
+        else
+        {
+            dataChunks = requestHeaderFrame.dataSize / maxChunkSize;
+
+            if (requestHeaderFrame.dataSize % maxChunkSize != 0)
+            {
+                dataChunks++;
+            }
+            else
+            {
+                // Chunk number is exact.
+            }
+
+            for (chunkIndex = 0u; chunkIndex < dataChunks; chunkIndex++)
+            {
+                if ((chunkIndex + 1) * maxChunkSize > requestHeaderFrame.dataSize)
+                {
+                    tempSize = requestHeaderFrame.dataSize - chunkIndex * maxChunkSize;
+                }
+                else
+                {
+                    tempSize = maxChunkSize;
+                }
+
+                if (channelFunctions[channel].gcpTransmitFunction((u8_t*)(pMessagePayload + chunkIndex * maxChunkSize), tempSize) == GOS_SUCCESS &&
+                    channelFunctions[channel].gcpReceiveFunction((u8_t*)&responseHeaderFrame, (u16_t)sizeof(responseHeaderFrame)) == GOS_SUCCESS &&
+                    gos_gcpValidateHeader(&responseHeaderFrame, &headerAck) == GOS_SUCCESS &&
+                    responseHeaderFrame.ackType == GCP_ACK_OK    )
+                {
+                    // Transmission successful.
+                    // Set temporary success.
+                    transmitMessageResult = GOS_SUCCESS;
+                }
+                else
+                {
+                    // Error.
+                    transmitMessageResult = GOS_ERROR;
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        // Header frame transmit error.
+    }
+
+    return transmitMessageResult;
+}
+
+/**
+ * @brief   Reads and routes one frame of the given channel.
+ * @details Message headers are bound to a free request slot (or to the response slot
+ *          of the transaction), chunk frames are stored in the bound slot and answered
+ *          at the end of each round, acknowledges are passed to the transmit slot of the
+ *          transaction. A stop-and-wait message is received completely. The caller holds
+ *          the RX mutex of the channel.
+ *
+ * @param[in] channel GCP channel number.
+ *
+ * @return  Result of frame reading.
+ *
+ * @retval  #GOS_SUCCESS Frame read and routed.
+ * @retval  #GOS_ERROR   Nothing received or invalid frame.
+ */
+GOS_STATIC gos_result_t gos_gcpReadFrame (gos_gcpChannelNumber_t channel)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t         readResult = GOS_ERROR;
+    gos_gcpHeaderFrame_t header     = {0};
+    gos_gcpAck_t         headerAck  = (gos_gcpAck_t)0u;
+
+    /*
+     * Function code.
+     */
+    gos_gcpExpireSlots(channel);
+
+    if (channelFunctions[channel].gcpReceiveFunction((u8_t*)&header, (u16_t)sizeof(header)) == GOS_SUCCESS)
+    {
+        if (gos_gcpValidateHeader(&header, &headerAck) == GOS_SUCCESS)
+        {
+            readResult = GOS_SUCCESS;
+
+            if (header.protocolMinor == GCP_PROTOCOL_MINOR_BASIC)
+            {
+                if (header.ackType == GCP_ACK_REQ)
+                {
+                    gos_gcpReceiveBasic(channel, &header);
+                }
+                else
+                {
+                    gos_gcpHandleAck(channel, &header);
+                }
+            }
+            else
+            {
+                channelStates[channel].peerMode = (header.protocolMinor == GCP_PROTOCOL_MINOR_MULTIPLEXED) ? GCP_PEER_MULTIPLEXED : GCP_PEER_COMPRESSED;
+
+                switch (header.ackType)
+                {
+                    case GCP_ACK_REQ:
+                    case GCP_ACK_REQ_PROBE:
+                    {
+                        gos_gcpHandleMessageHeader(channel, &header);
+                        break;
+                    }
+                    case GCP_FRAME_CHUNK:
+#if CFG_GCP_COMPRESSION == 1
+                    case GCP_FRAME_CHUNK_LZ:
+#endif
+                    {
+                        readResult = gos_gcpHandleChunk(channel, &header);
+                        break;
+                    }
+                    default:
+                    {
+                        gos_gcpHandleAck(channel, &header);
+                        break;
+                    }
+                }
+            }
+        }
+        else if (headerAck == GCP_ACK_CRC_ERROR)
+        {
+            // Frame boundary lost.
+            gos_gcpResync(channel);
+        }
+        else
+        {
+            // Unsupported protocol version.
+            if ((header.ackType == GCP_ACK_REQ || header.ackType == GCP_ACK_REQ_PROBE) && header.messageId != 0u)
+            {
+                (void_t) gos_gcpSendAck(channel, &header, GCP_ACK_PV_ERROR, 0u, 0u);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+    }
+    else
+    {
+        // Nothing received.
+    }
+
+    return readResult;
+}
+
+/**
+ * @brief   Handles a message header frame.
+ * @details Binds the message to the response slot of the transaction or to a free request
+ *          slot. Busy and size errors are acknowledged immediately, probes and messages
+ *          without payload are acknowledged when bound.
+ *
+ * @param[in] channel GCP channel number.
+ * @param[in] pHeader Pointer to the received message header.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_gcpHandleMessageHeader (gos_gcpChannelNumber_t channel, gos_gcpHeaderFrame_t* pHeader)
+{
+    /*
+     * Local variables.
+     */
+    gos_gcpTransaction_t* pSlot     = NULL;
+    gos_gcpAck_t          headerAck = GCP_ACK_RESEND;
+    u16_t                 ackChunks = 0u;
+    bool_t                sendAck   = GOS_TRUE;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    if (gos_gcpFindSlot(GCP_SLOT_REQUEST, channel, pHeader->transactionId, GOS_TRUE)  != NULL ||
+        gos_gcpFindSlot(GCP_SLOT_RESPONSE, channel, pHeader->transactionId, GOS_TRUE) != NULL)
+    {
+        // Header re-sent, the transfer is in progress.
+        headerAck = GCP_ACK_OK;
+        sendAck   = (pHeader->ackType == GCP_ACK_REQ_PROBE) ? GOS_TRUE : GOS_FALSE;
+    }
+    else if (pHeader->transactionId == channelStates[channel].lastTransactionId &&
+             (gos_kernelGetSysTicks() - channelStates[channel].lastTicks) <= CFG_GCP_RESPONSE_TMO_MS)
+    {
+        // Header re-sent after completion (final acknowledge lost).
+        headerAck = (gos_gcpAck_t)channelStates[channel].lastAck;
+        ackChunks = channelStates[channel].lastChunks;
+    }
+    else
+    {
+        if ((pHeader->transactionId & GCP_TRANSACTION_RESPONSE_FLAG) != 0u)
+        {
+            pSlot = gos_gcpFindSlot(GCP_SLOT_RESPONSE, channel, pHeader->transactionId, GOS_FALSE);
+        }
+        else
+        {
+            // Request.
+        }
+
+        if (pSlot == NULL)
+        {
+            // Requests and unexpected responses are passed to the receiving tasks.
+            pSlot = gos_gcpFindSlot(GCP_SLOT_REQUEST, channel, GOS_GCP_NO_TRANSACTION, GOS_FALSE);
+        }
+        else
+        {
+            // Response of a submitted request.
+        }
+
+        if (pSlot != NULL && pHeader->dataSize > pSlot->targetSize)
+        {
+            headerAck = GCP_ACK_SIZE_ERROR;
+            pSlot     = NULL;
+        }
+        else if (pSlot != NULL)
+        {
+            pSlot->bound         = GOS_TRUE;
+            pSlot->header        = *pHeader;
+            pSlot->transactionId = pHeader->transactionId;
+            pSlot->chunkSize     = 0u;
+            pSlot->baseChunk     = 0u;
+            pSlot->ackMask       = 0u;
+            pSlot->lastActivity  = gos_kernelGetSysTicks();
+            headerAck            = GCP_ACK_OK;
+            sendAck              = (pHeader->dataSize == 0u || pHeader->ackType == GCP_ACK_REQ_PROBE) ? GOS_TRUE : GOS_FALSE;
+        }
+        else
+        {
+            // No receiver is waiting, the sender shall try again.
+        }
+    }
+    GOS_ATOMIC_EXIT
+
+    if (pSlot != NULL && pHeader->dataSize == 0u)
+    {
+        // Message without payload is complete.
+        channelStates[channel].lastTransactionId = pHeader->transactionId;
+        channelStates[channel].lastAck           = GCP_ACK_OK;
+        channelStates[channel].lastChunks        = 0u;
+        channelStates[channel].lastTicks         = gos_kernelGetSysTicks();
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    if (sendAck == GOS_TRUE)
+    {
+        (void_t) gos_gcpSendAck(channel, pHeader, headerAck, ackChunks, 0u);
+    }
+    else
+    {
+        // Chunks follow.
+    }
+
+    if (pSlot != NULL && pHeader->dataSize == 0u)
+    {
+        gos_gcpCompleteSlot(pSlot, GOS_SUCCESS);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/**
+ * @brief   Handles a chunk frame.
+ * @details Stores the chunk data in the bound slot of the transaction (or drops it),
+ *          and acknowledges the round when its last chunk arrives. When all chunks are
+ *          received, the payload CRC is checked and the slot is completed. Compressed
+ *          data is received to the end of the place of the chunk and expanded in place.
+ *
+ * @param[in] channel GCP channel number.
+ * @param[in] pHeader Pointer to the received chunk header.
+ *
+ * @return  Result of chunk handling.
+ *
+ * @retval  #GOS_SUCCESS Chunk handled.
+ * @retval  #GOS_ERROR   Chunk data reception error.
+ */
+GOS_STATIC gos_result_t gos_gcpHandleChunk (gos_gcpChannelNumber_t channel, gos_gcpHeaderFrame_t* pHeader)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t          chunkResult = GOS_SUCCESS;
+    gos_gcpTransaction_t* pSlot       = NULL;
+    gos_gcpAck_t          dataAck     = GCP_ACK_OK;
+    u16_t                 sequence    = pHeader->messageId & GCP_CHUNK_SEQUENCE_MASK;
+    u16_t                 dataChunks  = 0u;
+    u16_t                 chunkLength = pHeader->dataSize;
+    u16_t                 dataSize    = pHeader->dataSize;
+    u16_t                 chunkSize   = 0u;
+    u32_t                 offset      = 0u;
+    bool_t                placed      = GOS_FALSE;
+#if CFG_GCP_COMPRESSION == 1
+    u8_t                  sizeField [GCP_LZ_SIZE_FIELD];
+#endif
+
+    /*
+     * Function code.
+     */
+#if CFG_GCP_COMPRESSION == 1
+    if (pHeader->ackType == GCP_FRAME_CHUNK_LZ)
+    {
+        if (pHeader->dataSize <= GCP_LZ_SIZE_FIELD)
+        {
+            // Inconsistent, dropped.
+            chunkLength = 0u;
+        }
+        else if (channelFunctions[channel].gcpReceiveFunction(sizeField, GCP_LZ_SIZE_FIELD) == GOS_SUCCESS)
+        {
+            chunkLength = (u16_t)(sizeField[0] | (sizeField[1] << 8u));
+            dataSize    = pHeader->dataSize - GCP_LZ_SIZE_FIELD;
+        }
+        else
+        {
+            chunkResult = GOS_ERROR;
+        }
+    }
+    else
+    {
+        // Raw chunk.
+    }
+#endif
+
+    GOS_ATOMIC_ENTER
+    pSlot = gos_gcpFindSlot(GCP_SLOT_REQUEST, channel, pHeader->transactionId, GOS_TRUE);
+
+    if (pSlot == NULL)
+    {
+        pSlot = gos_gcpFindSlot(GCP_SLOT_RESPONSE, channel, pHeader->transactionId, GOS_TRUE);
+    }
+    else
+    {
+        // Request chunk.
+    }
+    GOS_ATOMIC_EXIT
+
+    if (chunkResult == GOS_SUCCESS && pSlot != NULL)
+    {
+        // The first chunk tells the chunk size of the sender (kept when the chunk is valid).
+        chunkSize = (pSlot->chunkSize == 0u && sequence == 0u) ? chunkLength : pSlot->chunkSize;
+        offset    = (u32_t)sequence * chunkSize;
+
+        if (chunkSize                         != 0u                                   &&
+            chunkLength                       != 0u                                   &&
+            dataSize                          <= chunkLength                          &&
+            sequence                          >= pSlot->baseChunk                     &&
+            sequence                          <  pSlot->baseChunk + GCP_WINDOW_MAX    &&
+            offset + chunkLength              <= pSlot->header.dataSize               &&
+            (chunkLength == chunkSize || offset + chunkLength == pSlot->header.dataSize))
+        {
+            placed = GOS_TRUE;
+
+            if (channelFunctions[channel].gcpReceiveFunction(pSlot->pTarget + offset + chunkLength - dataSize, dataSize) != GOS_SUCCESS)
+            {
+                chunkResult = GOS_ERROR;
+            }
+            else if (gos_gcpDecompressChunk(pHeader, pSlot->pTarget + offset, chunkLength, dataSize) == GOS_SUCCESS &&
+                     gos_crcDriverGetCrc(pSlot->pTarget + offset, chunkLength) == pHeader->dataCrc)
+            {
+                pSlot->chunkSize     = chunkSize;
+                pSlot->ackMask      |= ((u32_t)1u << (sequence - pSlot->baseChunk));
+                pSlot->lastActivity  = gos_kernelGetSysTicks();
+
+                // Slide the window over the chunks received in sequence.
+                while ((pSlot->ackMask & 1u) != 0u)
+                {
+                    pSlot->ackMask >>= 1u;
+                    pSlot->baseChunk++;
+                }
+            }
+            else
+            {
+                // Chunk error, requested again by the acknowledge.
+            }
+        }
+        else
+        {
+            // Out of window or inconsistent.
+        }
+    }
+    else
+    {
+        // No bound transfer.
+    }
+
+    if (chunkResult == GOS_SUCCESS && placed == GOS_FALSE)
+    {
+        gos_gcpDiscard(channel, dataSize);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    if (chunkResult == GOS_SUCCESS && (pHeader->messageId & GCP_CHUNK_LAST_FLAG) != 0u)
+    {
+        if (pSlot != NULL && pSlot->chunkSize != 0u)
+        {
+            dataChunks = (u16_t)(((u32_t)pSlot->header.dataSize + pSlot->chunkSize - 1u) / pSlot->chunkSize);
+
+            if (pSlot->baseChunk >= dataChunks)
+            {
+                // Integrity check.
+                dataAck = (gos_gcpValidateData(&pSlot->header, pSlot->pTarget, &dataAck) == GOS_SUCCESS) ? GCP_ACK_OK : GCP_ACK_CRC_ERROR;
+
+                channelStates[channel].lastTransactionId = pHeader->transactionId;
+                channelStates[channel].lastAck           = dataAck;
+                channelStates[channel].lastChunks        = dataChunks;
+                channelStates[channel].lastTicks         = gos_kernelGetSysTicks();
+
+                (void_t) gos_gcpSendAck(channel, pHeader, dataAck, dataChunks, 0u);
+                gos_gcpCompleteSlot(pSlot, (dataAck == GCP_ACK_OK) ? GOS_SUCCESS : GOS_ERROR);
+            }
+            else
+            {
+                (void_t) gos_gcpSendAck(channel, pHeader, GCP_ACK_OK, pSlot->baseChunk, pSlot->ackMask);
+            }
+        }
+        else if (pSlot != NULL)
+        {
+            // First chunk lost, request the round again.
+            (void_t) gos_gcpSendAck(channel, pHeader, GCP_ACK_OK, 0u, 0u);
+        }
+        else if (pHeader->transactionId == channelStates[channel].lastTransactionId)
+        {
+            // Final acknowledge lost, repeat it.
+            (void_t) gos_gcpSendAck(channel, pHeader, (gos_gcpAck_t)channelStates[channel].lastAck, channelStates[channel].lastChunks, 0u);
+        }
+        else
+        {
+            // Unknown transfer.
+        }
+    }
+    else
+    {
+        // Round not finished yet.
+    }
+
+    return chunkResult;
+}
+
+/**
+ * @brief   Handles an acknowledge frame.
+ * @details Passes the acknowledge to the transmit slot of the transaction. Protocol 2.0
+ *          acknowledges carry no transaction, they answer the probe on the channel.
+ *
+ * @param[in] channel GCP channel number.
+ * @param[in] pHeader Pointer to the received acknowledge.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_gcpHandleAck (gos_gcpChannelNumber_t channel, gos_gcpHeaderFrame_t* pHeader)
+{
+    /*
+     * Local variables.
+     */
+    gos_gcpTransaction_t* pSlot   = NULL;
+    u16_t                 slotIdx = 0u;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    for (slotIdx = 0u; slotIdx < CFG_GCP_MAX_TRANSACTIONS; slotIdx++)
+    {
+        if (transactions[slotIdx].type    == GCP_SLOT_TX &&
+            transactions[slotIdx].channel == channel     &&
+            ((pHeader->protocolMinor != GCP_PROTOCOL_MINOR_BASIC && transactions[slotIdx].transactionId == pHeader->transactionId) ||
+            (pHeader->protocolMinor  == GCP_PROTOCOL_MINOR_BASIC && transactions[slotIdx].probing == GOS_TRUE)))
+        {
+            pSlot         = &transactions[slotIdx];
+            pSlot->header = *pHeader;
+            pSlot->ready  = GOS_TRUE;
+            break;
+        }
+        else
+        {
+            // Continue.
+        }
+    }
+    GOS_ATOMIC_EXIT
+
+    if (pSlot != NULL)
+    {
+        (void_t) gos_triggerIncrement(&pSlot->trigger);
+    }
+    else
+    {
+        // Late acknowledge.
+    }
+}
+
+/**
+ * @brief   Stop-and-wait receiver function.
+ * @details Receives a protocol 2.0 message whose header has been read (payload chunks
+ *          one by one, each acknowledged by a response header) into a waiting response or
+ *          request slot.
+ *
+ * @param[in] channel GCP channel number.
+ * @param[in] pHeader Pointer to the received message header.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_gcpReceiveBasic (gos_gcpChannelNumber_t channel, gos_gcpHeaderFrame_t* pHeader)
+{
+    /*
+     * Local variables.
+     */
+    gos_gcpTransaction_t* pSlot      = NULL;
+    gos_gcpAck_t          headerAck  = GCP_ACK_INVALID;
+    gos_result_t          result     = GOS_SUCCESS;
+    u16_t                 dataChunks = 0u;
+    u16_t                 chunkIndex = 0u;
+    u16_t                 tempSize   = 0u;
+
+    /*
+     * Function code.
+     */
+    channelStates[channel].peerMode = GCP_PEER_BASIC;
+
+    // A stop-and-wait peer answers one request at a time.
+    GOS_ATOMIC_ENTER
+    pSlot = gos_gcpFindSlot(GCP_SLOT_RESPONSE, channel, GOS_GCP_NO_TRANSACTION, GOS_FALSE);
+
+    if (pSlot == NULL)
+    {
+        pSlot = gos_gcpFindSlot(GCP_SLOT_REQUEST, channel, GOS_GCP_NO_TRANSACTION, GOS_FALSE);
+    }
+    else
+    {
+        // Response of a submitted request.
+    }
+
+    if (pSlot != NULL && pHeader->dataSize > pSlot->targetSize)
+    {
+        headerAck = GCP_ACK_SIZE_ERROR;
+        pSlot     = NULL;
+    }
+    else if (pSlot != NULL)
+    {
+        pSlot->bound        = GOS_TRUE;
+        pSlot->header       = *pHeader;
+        pSlot->lastActivity = gos_kernelGetSysTicks();
+    }
+    else
+    {
+        // No receiver.
+    }
+    GOS_ATOMIC_EXIT
+
+    if (pSlot == NULL)
+    {
+        // Send response.
+        if (pHeader->messageId != 0u)
+        {
+            (void_t) gos_gcpSendAck(channel, pHeader, headerAck, 0u, 0u);
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+    else if (pHeader->dataSize == 0u)
+    {
+        result = gos_gcpSendAck(channel, pHeader, GCP_ACK_OK, 0u, 0u);
+        gos_gcpCompleteSlot(pSlot, result);
+    }
+    else
+    {
+        dataChunks = pHeader->dataSize / pSlot->maxChunkSize;
+
+        if (pHeader->dataSize % pSlot->maxChunkSize != 0)
+        {
+            dataChunks++;
+        }
+        else
+        {
+            // Chunk number is exact.
+        }
+
+        for (chunkIndex = 0u; chunkIndex < dataChunks && result == GOS_SUCCESS; chunkIndex++)
+        {
+            if ((chunkIndex + 1) * pSlot->maxChunkSize > pHeader->dataSize)
+            {
+                tempSize = pHeader->dataSize - chunkIndex * pSlot->maxChunkSize;
+            }
+            else
+            {
+                tempSize = pSlot->maxChunkSize;
+            }
+
+            if (channelFunctions[channel].gcpReceiveFunction(pSlot->pTarget + chunkIndex * pSlot->maxChunkSize, tempSize) == GOS_SUCCESS)
+            {
+                // Data OK. Send response.
+                result = gos_gcpSendAck(channel, pHeader, GCP_ACK_OK, 0u, 0u);
+            }
+            else
+            {
+                result = GOS_ERROR;
+            }
+        }
+
+        // Integrity check.
+        if (result == GOS_SUCCESS && gos_gcpValidateData(pHeader, pSlot->pTarget, &headerAck) != GOS_SUCCESS)
+        {
+            result = GOS_ERROR;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        gos_gcpCompleteSlot(pSlot, result);
+    }
+}
+
+/**
+ * @brief   Waits for the given slot to become ready.
+ * @details If no other task reads the channel, the calling task reads and routes the
+ *          frames itself, otherwise it waits for the reading task to signal the slot.
+ *
+ * @param[in] pSlot     Pointer to the slot.
+ * @param[in] timeoutMs Timeout [ms].
+ *
+ * @return  Result of waiting.
+ *
+ * @retval  #GOS_SUCCESS Slot is ready.
+ * @retval  #GOS_ERROR   Timeout.
+ */
+GOS_STATIC gos_result_t gos_gcpWaitSlot (gos_gcpTransaction_t* pSlot, u32_t timeoutMs)
+{
+    /*
+     * Local variables.
+     */
+    gos_gcpChannelNumber_t channel    = pSlot->channel;
+    u32_t                  startTicks = gos_kernelGetSysTicks();
+
+    /*
+     * Function code.
+     */
+    while (pSlot->ready == GOS_FALSE && (gos_kernelGetSysTicks() - startTicks) < timeoutMs)
+    {
+        if (channelStates[channel].rxHoldCounter == 0u &&
+            gos_mutexLock(&gcpRxMutexes[channel], GOS_MUTEX_NO_TMO) == GOS_SUCCESS)
+        {
+            if (pSlot->ready == GOS_FALSE)
+            {
+                (void_t) gos_gcpReadFrame(channel);
+            }
+            else
+            {
+                // Signaled in the meantime.
+            }
+
+            (void_t) gos_mutexUnlock(&gcpRxMutexes[channel]);
+        }
+        else
+        {
+            // Another task reads the channel.
+            (void_t) gos_triggerWait(&pSlot->trigger, 1u, CFG_GCP_READER_POLL_MS);
+            (void_t) gos_triggerReset(&pSlot->trigger);
+        }
+    }
+
+    return (pSlot->ready == GOS_TRUE) ? GOS_SUCCESS : GOS_ERROR;
+}
+
+/**
+ * @brief   Allocates a transaction slot.
+ * @details Takes the first free slot and initializes it.
+ *
+ * @param[in] type          Slot type.
+ * @param[in] channel       GCP channel number.
+ * @param[in] transactionId Transaction ID field of the frames.
+ * @param[in] pTarget       Payload target buffer (RX slots).
+ * @param[in] targetSize    Size of the target buffer.
+ * @param[in] maxChunkSize  Chunk size of the stop-and-wait mode.
+ *
+ * @return  Pointer to the slot or NULL if there is no free slot.
+ */
+GOS_STATIC gos_gcpTransaction_t* gos_gcpAllocateSlot (
+        gos_gcpSlotType_t       type,
+        gos_gcpChannelNumber_t  channel,
+        u8_t                    transactionId,
+        u8_t*                   pTarget,
+        u16_t                   targetSize,
+        u16_t                   maxChunkSize
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_gcpTransaction_t* pSlot   = NULL;
+    u16_t                 slotIdx = 0u;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    for (slotIdx = 0u; slotIdx < CFG_GCP_MAX_TRANSACTIONS; slotIdx++)
+    {
+        if (transactions[slotIdx].type == GCP_SLOT_FREE)
+        {
+            pSlot                = &transactions[slotIdx];
+            pSlot->type          = type;
+            pSlot->channel       = channel;
+            pSlot->transactionId = transactionId;
+            pSlot->bound         = GOS_FALSE;
+            pSlot->probing       = GOS_FALSE;
+            pSlot->ready         = GOS_FALSE;
+            pSlot->result        = GOS_ERROR;
+            pSlot->pTarget       = pTarget;
+            pSlot->targetSize    = targetSize;
+            pSlot->maxChunkSize  = maxChunkSize;
+            pSlot->callback      = NULL;
+            pSlot->lastActivity  = gos_kernelGetSysTicks();
+            (void_t) memset((void_t*)&pSlot->header, 0, sizeof(pSlot->header));
+            break;
+        }
+        else
+        {
+            // Continue.
+        }
+    }
+    GOS_ATOMIC_EXIT
+
+    if (pSlot != NULL)
+    {
+        (void_t) gos_triggerReset(&pSlot->trigger);
+    }
+    else
+    {
+        // No free slot.
+    }
+
+    return pSlot;
+}
+
+/**
+ * @brief   Finds a receive slot.
+ * @details Bound slots are searched by transaction ID, unbound slots are returned in
+ *          allocation order (response slots by transaction ID unless it is zero). The
+ *          caller shall be in an atomic section.
+ *
+ * @param[in] type          Slot type.
+ * @param[in] channel       GCP channel number.
+ * @param[in] transactionId Transaction ID field of the frames.
+ * @param[in] bound         Bound or unbound slot is searched.
+ *
+ * @return  Pointer to the slot or NULL if not found.
+ */
+GOS_STATIC gos_gcpTransaction_t* gos_gcpFindSlot (
+        gos_gcpSlotType_t       type,
+        gos_gcpChannelNumber_t  channel,
+        u8_t                    transactionId,
+        bool_t                  bound
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_gcpTransaction_t* pSlot   = NULL;
+    u16_t                 slotIdx = 0u;
+
+    /*
+     * Function code.
+     */
+    for (slotIdx = 0u; slotIdx < CFG_GCP_MAX_TRANSACTIONS; slotIdx++)
+    {
+        if (transactions[slotIdx].type    == type    &&
+            transactions[slotIdx].channel == channel &&
+            transactions[slotIdx].bound   == bound   &&
+            transactions[slotIdx].ready   == GOS_FALSE &&
+            (transactionId == GOS_GCP_NO_TRANSACTION || transactions[slotIdx].transactionId == transactionId))
+        {
+            pSlot = &transactions[slotIdx];
+            break;
+        }
+        else
+        {
+            // Continue.
+        }
+    }
+
+    return pSlot;
+}
+
+/**
+ * @brief   Completes the given receive slot.
+ * @details Calls the completion callback and frees the slot, or signals the owner task.
+ *
+ * @param[in] pSlot  Pointer to the slot.
+ * @param[in] result Result of the transfer.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_gcpCompleteSlot (gos_gcpTransaction_t* pSlot, gos_result_t result)
+{
+    /*
+     * Local variables.
+     */
+    gos_gcpResponseCallback_t callback      = pSlot->callback;
+    gos_gcpChannelNumber_t    channel       = pSlot->channel;
+    u8_t                      transactionId = pSlot->transactionId & GCP_TRANSACTION_ID_MASK;
+    u16_t                     messageId     = pSlot->header.messageId;
+
+    /*
+     * Function code.
+     */
+    if (callback != NULL)
+    {
+        gos_gcpReleaseSlot(pSlot, GOS_FALSE);
+        callback(channel, transactionId, messageId, result);
+    }
+    else
+    {
+        GOS_ATOMIC_ENTER
+        pSlot->result = result;
+        pSlot->ready  = GOS_TRUE;
+        GOS_ATOMIC_EXIT
+
+        (void_t) gos_triggerIncrement(&pSlot->trigger);
+    }
+}
+
+/**
+ * @brief   Frees the given slot.
+ * @details Frees the slot. If the slot may still receive frames, the RX mutex of the
+ *          channel is taken first so the reading task is not writing into it.
+ *
+ * @param[in] pSlot         Pointer to the slot.
+ * @param[in] lockReception Take the RX mutex of the channel.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_gcpReleaseSlot (gos_gcpTransaction_t* pSlot, bool_t lockReception)
+{
+    /*
+     * Local variables.
+     */
+    gos_gcpChannelNumber_t channel = pSlot->channel;
+    bool_t                 locked  = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    if (lockReception == GOS_TRUE)
+    {
+        locked = (gos_gcpLockReception(channel) == GOS_SUCCESS) ? GOS_TRUE : GOS_FALSE;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    GOS_ATOMIC_ENTER
+    pSlot->type     = GCP_SLOT_FREE;
+    pSlot->bound    = GOS_FALSE;
+    pSlot->ready    = GOS_FALSE;
+    pSlot->callback = NULL;
+    GOS_ATOMIC_EXIT
+
+    if (locked == GOS_TRUE)
+    {
+        gos_gcpUnlockReception(channel);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/**
+ * @brief   Expires the submitted requests without response.
+ * @details Completes the response slots with callback with error if there was no activity
+ *          for #CFG_GCP_RESPONSE_TMO_MS.
+ *
+ * @param[in] channel GCP channel number.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_gcpExpireSlots (gos_gcpChannelNumber_t channel)
+{
+    /*
+     * Local variables.
+     */
+    u16_t slotIdx = 0u;
+
+    /*
+     * Function code.
+     */
+    for (slotIdx = 0u; slotIdx < CFG_GCP_MAX_TRANSACTIONS; slotIdx++)
+    {
+        if (transactions[slotIdx].type     == GCP_SLOT_RESPONSE &&
+            transactions[slotIdx].channel  == channel           &&
+            transactions[slotIdx].callback != NULL              &&
+            (gos_kernelGetSysTicks() - transactions[slotIdx].lastActivity) > CFG_GCP_RESPONSE_TMO_MS)
+        {
+            gos_gcpCompleteSlot(&transactions[slotIdx], GOS_ERROR);
+        }
+        else
+        {
+            // Continue.
+        }
+    }
+}
+
+/**
+ * @brief   Returns a new transaction ID.
+ * @details Transaction IDs are allocated per channel from 1 to 127.
+ *
+ * @param[in] channel GCP channel number.
+ *
+ * @return  New transaction ID.
+ */
+GOS_STATIC u8_t gos_gcpGetNewTransactionId (gos_gcpChannelNumber_t channel)
+{
+    /*
+     * Local variables.
+     */
+    u8_t transactionId = GOS_GCP_NO_TRANSACTION;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    transactionId                             = channelStates[channel].nextTransactionId;
+    channelStates[channel].nextTransactionId = (transactionId >= GCP_TRANSACTION_ID_MASK) ? 1u : (transactionId + 1u);
+    GOS_ATOMIC_EXIT
+
+    return transactionId;
+}
+
+/**
+ * @brief   Returns the transaction served by the calling task.
+ * @details Returns the transaction ID bound to the calling task on the given channel.
+ *
+ * @param[in] channel GCP channel number.
+ *
+ * @return  Bound transaction ID or #GOS_GCP_NO_TRANSACTION.
+ */
+GOS_STATIC u8_t gos_gcpGetBoundTransactionId (gos_gcpChannelNumber_t channel)
+{
+    /*
+     * Local variables.
+     */
+    u8_t      transactionId = GOS_GCP_NO_TRANSACTION;
+    gos_tid_t currentId     = GOS_INVALID_TASK_ID;
+    u16_t     bindingIdx    = 0u;
+
+    /*
+     * Function code.
+     */
+    if (gos_taskGetCurrentId(&currentId) == GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        for (bindingIdx = 0u; bindingIdx < CFG_GCP_MAX_TRANSACTIONS; bindingIdx++)
+        {
+            if (bindings[bindingIdx].taskId == currentId && bindings[bindingIdx].channel == channel)
+            {
+                transactionId = bindings[bindingIdx].transactionId;
+                break;
+            }
+            else
+            {
+                // Continue.
+            }
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return transactionId;
+}
+
+/**
+ * @brief   Transmits a frame.
+ * @details Calculates the header CRC and transmits the header and the data (if any)
+ *          while holding the TX mutex of the channel. With a vectored transmit function,
+ *          the header and the data are passed as one transmission.
+ *
+ * @param[in] channel  GCP channel number.
+ * @param[in] pHeader  Pointer to the frame header.
+ * @param[in] pData    Pointer to the frame data.
+ * @param[in] dataSize Size of the frame data.
+ *
+ * @return  Result of frame transmission.
+ *
+ * @retval  #GOS_SUCCESS Frame transmitted successfully.
+ * @retval  #GOS_ERROR   Transmit or mutex error.
+ */
+GOS_STATIC gos_result_t gos_gcpTransmitFrame (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpHeaderFrame_t*   pHeader,
+        u8_t*                   pData,
+        u16_t                   dataSize
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t     transmitResult = GOS_ERROR;
+    gos_gcpSegment_t frameSegments [GOS_GCP_FRAME_SEGMENTS_MAX];
+
+    /*
+     * Function code.
+     */
+    pHeader->headerCrc = gos_crcDriverGetCrc((u8_t*)pHeader, (u16_t)(sizeof(*pHeader) - sizeof(pHeader->headerCrc)));
+
+    frameSegments[0].pData = (u8_t*)pHeader;
+    frameSegments[0].size  = (u16_t)sizeof(*pHeader);
+    frameSegments[1].pData = pData;
+    frameSegments[1].size  = dataSize;
+
+    if (gos_mutexLock(&gcpTxMutexes[channel], GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        if (channelFunctions[channel].gcpTransmitVectorFunction != NULL)
+        {
+            // Header and data in one transmission.
+            transmitResult = channelFunctions[channel].gcpTransmitVectorFunction(frameSegments, (dataSize > 0u) ? 2u : 1u);
+        }
+        else
+        {
+            transmitResult = channelFunctions[channel].gcpTransmitFunction((u8_t*)pHeader, (u16_t)sizeof(*pHeader));
+
+            if (transmitResult == GOS_SUCCESS && dataSize > 0u)
+            {
+                transmitResult = channelFunctions[channel].gcpTransmitFunction(pData, dataSize);
+            }
+            else
+            {
+                // Header only.
+            }
+        }
+    }
+    else
+    {
+        // Mutex error.
+    }
+
+    (void_t) gos_mutexUnlock(&gcpTxMutexes[channel]);
+
+    return transmitResult;
+}
+
+/**
+ * @brief   Transmits a chunk frame.
+ * @details If the peer accepts compressed chunks and the compressor is free, the chunk
+ *          is compressed and sent as a compressed chunk frame when it gets smaller.
+ *          Otherwise the chunk is sent as it is. The header shall describe the raw chunk.
+ *
+ * @param[in] channel GCP channel number.
+ * @param[in] pHeader Pointer to the chunk header.
+ * @param[in] pData   Pointer to the chunk data.
+ *
+ * @return  Result of chunk transmission.
+ *
+ * @retval  #GOS_SUCCESS Chunk transmitted successfully.
+ * @retval  #GOS_ERROR   Transmit or mutex error.
+ */
+GOS_STATIC gos_result_t gos_gcpTransmitChunk (
+        gos_gcpChannelNumber_t  channel,
+        gos_gcpHeaderFrame_t*   pHeader,
+        u8_t*                   pData
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t transmitResult = GOS_ERROR;
+    bool_t       compressed     = GOS_FALSE;
+#if CFG_GCP_COMPRESSION == 1
+    u16_t        compressedSize = 0u;
+#endif
+
+    /*
+     * Function code.
+     */
+#if CFG_GCP_COMPRESSION == 1
+    if (pHeader->protocolMinor == GCP_PROTOCOL_MINOR_COMPRESSED &&
+        pHeader->dataSize      >= GCP_LZ_MIN_CHUNK_SIZE         &&
+        pHeader->dataSize      <= CFG_GCP_COMPRESSION_BUFFER_SIZE &&
+        gos_mutexLock(&gcpCompressionMutex, GOS_MUTEX_NO_TMO) == GOS_SUCCESS)
+    {
+        // The compressed frame shall be at least one byte shorter than the raw chunk.
+        compressedSize = gos_gcpCompressChunk(pData, pHeader->dataSize,
+                &gcpCompressionBuffer[GCP_LZ_SIZE_FIELD], pHeader->dataSize - GCP_LZ_SIZE_FIELD - 1u);
+
+        if (compressedSize > 0u)
+        {
+            gcpCompressionBuffer[0] = (u8_t)(pHeader->dataSize & 0xFFu);
+            gcpCompressionBuffer[1] = (u8_t)(pHeader->dataSize >> 8u);
+            pHeader->ackType        = GCP_FRAME_CHUNK_LZ;
+            pHeader->dataSize       = compressedSize + GCP_LZ_SIZE_FIELD;
+            transmitResult          = gos_gcpTransmitFrame(channel, pHeader, gcpCompressionBuffer, pHeader->dataSize);
+            compressed              = GOS_TRUE;
         }
         else
         {
-            // Header frame transmit error.
+            // Not compressible.
         }
+
+        (void_t) gos_mutexUnlock(&gcpCompressionMutex);
+    }
+    else
+    {
+        // Compressor busy or not applicable.
+    }
+#endif
+
+    if (compressed == GOS_FALSE)
+    {
+        transmitResult = gos_gcpTransmitFrame(channel, pHeader, pData, pHeader->dataSize);
     }
     else
     {
         // Nothing to do.
     }
 
-    return transmitMessageResult;
+    return transmitResult;
 }
 
-
 /**
- * @brief   Internal receiver function (re-entrant).
- * @details Receives a message over GCP (header, payload, and
- *          then transmits a response header).
+ * @brief   Sends an acknowledge.
+ * @details Answers the given frame with the protocol version and transaction of the frame
+ *          (an unsupported version is answered with the own version).
  *
- * @param[in]  channel        GCP channel number.
- * @param[out] pMessageId     Pointer to a variable to store the message ID.
- * @param[out] pPayloadTarget Pointer to a buffer to store the payload.
- * @param[in]  targetSize     Size of the payload buffer (in bytes).
- * @param[in]  maxChunkSize   Maximum chunk size (in bytes).
+ * @param[in] channel          GCP channel number.
+ * @param[in] pFrame           Pointer to the frame to answer.
+ * @param[in] ackType          Acknowledge type.
+ * @param[in] chunksInSequence Number of chunks received in sequence.
+ * @param[in] ackMask          Selective acknowledge mask.
  *
- * @return  Result of message reception.
+ * @return  Result of acknowledge transmission.
  *
- * @retval  #GOS_SUCCESS Reception successful.
- * @retval  #GOS_ERROR   One of the function parameters are invalid or
- *                       request header validation failed or payload
- *                       validation failed.
+ * @retval  #GOS_SUCCESS Acknowledge transmitted successfully.
+ * @retval  #GOS_ERROR   Transmit error.
  */
-GOS_STATIC GOS_INLINE gos_result_t gos_gcpReceiveMessageInternal (
+GOS_STATIC gos_result_t gos_gcpSendAck (
         gos_gcpChannelNumber_t  channel,
-        u16_t*                  pMessageId,
-        void_t*                 pPayloadTarget,
-        u16_t                   targetSize,
-        u16_t                   maxChunkSize
+        gos_gcpHeaderFrame_t*   pFrame,
+        gos_gcpAck_t            ackType,
+        u16_t                   chunksInSequence,
+        u32_t                   ackMask
         )
 {
     /*
      * Local variables.
      */
-    gos_result_t         receiveMessageResult  = GOS_ERROR;
-    gos_gcpHeaderFrame_t requestHeaderFrame    = {0};
-    gos_gcpHeaderFrame_t responseHeaderFrame   = {0};
-    gos_gcpAck_t         headerAck             = (gos_gcpAck_t)0u;
-    u8_t                 dataChunks            = 0u;
-    u8_t                 chunkIndex            = 0u;
-    u16_t                tempSize              = 0u;
+    gos_gcpHeaderFrame_t ackHeader = {0};
 
     /*
      * Function code.
      */
-    if (pMessageId                                   != NULL                        &&
-        pPayloadTarget                               != NULL                        &&
-        channel                                      <  CFG_GCP_CHANNELS_MAX_NUMBER &&
-        channelFunctions[channel].gcpReceiveFunction != NULL
-        )
-    {
-        // Prepare response header frame.
-        responseHeaderFrame.dataSize      = 0u;
-        responseHeaderFrame.dataCrc       = 0u;
-        responseHeaderFrame.protocolMajor = GCP_PROTOCOL_VERSION_MAJOR;
-        responseHeaderFrame.protocolMinor = GCP_PROTOCOL_VERSION_MINOR;
-
-        if (channelFunctions[channel].gcpReceiveFunction((u8_t*)&requestHeaderFrame, (u16_t)sizeof(requestHeaderFrame)) == GOS_SUCCESS &&
-            gos_gcpValidateHeader(&requestHeaderFrame, &headerAck) == GOS_SUCCESS)
-        {
-            if (requestHeaderFrame.dataSize == 0)
-            {
-                // OK.
-                // Data OK. Send response.
-                *pMessageId = requestHeaderFrame.messageId;
-                responseHeaderFrame.ackType = GCP_ACK_OK;
-                responseHeaderFrame.headerCrc = gos_crcDriverGetCrc((u8_t*)&responseHeaderFrame, (u16_t)(sizeof(responseHeaderFrame) - sizeof(responseHeaderFrame.headerCrc)));
-                if (channelFunctions[channel].gcpTransmitFunction((u8_t*)&responseHeaderFrame, (u16_t)sizeof(responseHeaderFrame)) == GOS_SUCCESS)
-                {
-                    // Reception successful.
-                    receiveMessageResult = GOS_SUCCESS;
-                }
-                else
-                {
-                    // Transmit error.
-                }
-            }
-            else
-            {
-                dataChunks = requestHeaderFrame.dataSize / maxChunkSize;
+    ackHeader.protocolMajor = GCP_PROTOCOL_VERSION_MAJOR;
+    ackHeader.protocolMinor = (pFrame->protocolMinor == GCP_PROTOCOL_MINOR_BASIC || pFrame->protocolMinor == GCP_PROTOCOL_MINOR_MULTIPLEXED) ?
+                              pFrame->protocolMinor : GCP_PROTOCOL_VERSION_MINOR;
+    ackHeader.ackType       = (u8_t)ackType;
+    ackHeader.transactionId = pFrame->transactionId;
+    ackHeader.messageId     = pFrame->messageId;
+    ackHeader.dataSize      = chunksInSequence;
+    ackHeader.dataCrc       = ackMask;
 
-                if (requestHeaderFrame.dataSize % maxChunkSize != 0)
-                {
-                    dataChunks++;
-                }
-                else
-                {
-                    // Chunk number is exact.
-                }
+    return gos_gcpTransmitFrame(channel, &ackHeader, NULL, 0u);
+}
 
-                for (chunkIndex = 0u; chunkIndex < dataChunks; chunkIndex++)
-                {
-                    if ((chunkIndex + 1) * maxChunkSize > requestHeaderFrame.dataSize)
-                    {
-                        tempSize = requestHeaderFrame.dataSize - chunkIndex * maxChunkSize;
-                    }
-                    else
-                    {
-                        tempSize = maxChunkSize;
-                    }
+/**
+ * @brief   Drops the given number of bytes of the channel.
+ * @details Receives the data of a chunk that has no place into a scratch buffer.
+ *
+ * @param[in] channel GCP channel number.
+ * @param[in] size    Number of bytes to drop.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_gcpDiscard (gos_gcpChannelNumber_t channel, u16_t size)
+{
+    /*
+     * Local variables.
+     */
+    u8_t  discardBuffer [GCP_DISCARD_BUFFER_SIZE];
+    u16_t pieceSize = 0u;
 
-                    if (channelFunctions[channel].gcpReceiveFunction((u8_t*)(pPayloadTarget + chunkIndex * maxChunkSize), tempSize) == GOS_SUCCESS)
-                    {
-                        // OK, send response.
-                        // Data OK. Send response.
-                        *pMessageId = requestHeaderFrame.messageId;
-                        responseHeaderFrame.ackType = GCP_ACK_OK;
-                        responseHeaderFrame.headerCrc = gos_crcDriverGetCrc((u8_t*)&responseHeaderFrame, (u16_t)(sizeof(responseHeaderFrame) - sizeof(responseHeaderFrame.headerCrc)));
-                        if (channelFunctions[channel].gcpTransmitFunction((u8_t*)&responseHeaderFrame, (u16_t)sizeof(responseHeaderFrame)) == GOS_SUCCESS)
-                        {
-                            // OK continue.
-                        }
-                        else
-                        {
-                            // Transmit error.
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
+    /*
+     * Function code.
+     */
+    while (size > 0u)
+    {
+        pieceSize = (size < GCP_DISCARD_BUFFER_SIZE) ? size : GCP_DISCARD_BUFFER_SIZE;
 
-                // Integrity check.
-                if (gos_gcpValidateData(&requestHeaderFrame, pPayloadTarget, &headerAck) == GOS_SUCCESS)
-                {
-                    receiveMessageResult = GOS_SUCCESS;
-                }
-                else
-                {
-                    // Integrity error.
-                }
-            }
+        if (channelFunctions[channel].gcpReceiveFunction(discardBuffer, pieceSize) == GOS_SUCCESS)
+        {
+            size -= pieceSize;
         }
         else
         {
-            // Send response.
-            if (requestHeaderFrame.messageId != 0u)
-            {
-                responseHeaderFrame.ackType   = (u8_t)headerAck;
-                responseHeaderFrame.headerCrc = gos_crcDriverGetCrc((u8_t*)&responseHeaderFrame, (u16_t)(sizeof(responseHeaderFrame) - sizeof(responseHeaderFrame.headerCrc)));
-                (void_t) channelFunctions[channel].gcpTransmitFunction((u8_t*)&responseHeaderFrame, (u16_t)sizeof(responseHeaderFrame));
-            }
+            break;
         }
     }
+}
+
+/**
+ * @brief   Resynchronizes the frame boundary.
+ * @details Drops the incoming bytes until the line is idle (receive timeout) or for at most
+ *          #CFG_GCP_ACK_TMO_MS. The lost frames are re-sent by the senders.
+ *
+ * @param[in] channel GCP channel number.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_gcpResync (gos_gcpChannelNumber_t channel)
+{
+    /*
+     * Local variables.
+     */
+    u8_t  dropByte   = 0u;
+    u32_t startTicks = gos_kernelGetSysTicks();
+
+    /*
+     * Function code.
+     */
+    while ((gos_kernelGetSysTicks() - startTicks) < CFG_GCP_ACK_TMO_MS &&
+           channelFunctions[channel].gcpReceiveFunction(&dropByte, 1u) == GOS_SUCCESS)
+    {
+        // Drop byte.
+    }
+}
+
+/**
+ * @brief   Takes the RX mutex of the channel for exclusive use.
+ * @details Makes the waiting tasks stop reading the channel, then locks the RX mutex.
+ *
+ * @param[in] channel GCP channel number.
+ *
+ * @return  Result of locking.
+ *
+ * @retval  #GOS_SUCCESS RX mutex locked.
+ * @retval  #GOS_ERROR   Mutex error.
+ */
+GOS_STATIC gos_result_t gos_gcpLockReception (gos_gcpChannelNumber_t channel)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t lockResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    channelStates[channel].rxHoldCounter++;
+    GOS_ATOMIC_EXIT
+
+    lockResult = gos_mutexLock(&gcpRxMutexes[channel], GOS_MUTEX_ENDLESS_TMO);
+
+    if (lockResult != GOS_SUCCESS)
+    {
+        gos_gcpUnlockReception(channel);
+    }
     else
     {
         // Nothing to do.
     }
 
-    return receiveMessageResult;
+    return lockResult;
+}
+
+/**
+ * @brief   Releases the RX mutex of the channel taken for exclusive use.
+ * @details Unlocks the RX mutex and lets the waiting tasks read the channel again.
+ *
+ * @param[in] channel GCP channel number.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_gcpUnlockReception (gos_gcpChannelNumber_t channel)
+{
+    /*
+     * Function code.
+     */
+    (void_t) gos_mutexUnlock(&gcpRxMutexes[channel]);
+
+    GOS_ATOMIC_ENTER
+    channelStates[channel].rxHoldCounter--;
+    GOS_ATOMIC_EXIT
 }
 
 /**
@@ -589,9 +2702,11 @@ GOS_STATIC gos_result_t gos_gcpValidateHeader (gos_gcpHeaderFrame_t* pHeader, go
         // Check header CRC.
         if (gos_crcDriverGetCrc((u8_t*)pHeader, (u16_t)(sizeof(*pHeader) - sizeof(pHeader->headerCrc))) == pHeader->headerCrc)
         {
-            // Validate protocol version
+            // Validate protocol version (stop-and-wait, multiplexed and own modes are accepted).
             if (pHeader->protocolMajor == GCP_PROTOCOL_VERSION_MAJOR &&
-                pHeader->protocolMinor == GCP_PROTOCOL_VERSION_MINOR)
+                (pHeader->protocolMinor == GCP_PROTOCOL_MINOR_BASIC       ||
+                 pHeader->protocolMinor == GCP_PROTOCOL_MINOR_MULTIPLEXED ||
+                 pHeader->protocolMinor == GCP_PROTOCOL_VERSION_MINOR))
             {
                 validateSuccess = GOS_SUCCESS;
             }
@@ -659,3 +2774,262 @@ GOS_STATIC gos_result_t gos_gcpValidateData (gos_gcpHeaderFrame_t* pHeader, void
 
     return validateSuccess;
 }
+
+#if CFG_GCP_COMPRESSION == 1
+/**
+ * @brief   Compresses a chunk.
+ * @details Greedy LZ77 compression with a hash table of 3-byte sequences and a window of
+ *          #GCP_LZ_OFFSET_MAX bytes. The output consists of literal run tokens (token
+ *          0x00-0x7F, followed by 1-128 literals) and match tokens (2 bytes, match length
+ *          and offset), followed by the rest of the chunk as it is. The receiver expands
+ *          the chunk in place, with the compressed data stored at the end of the chunk, so
+ *          the tokens are cut where the output is the most ahead of the input: there the
+ *          output reaches the input and the rest of the chunk is already in place.
+ *
+ * @param[in]  pSource    Pointer to the raw chunk.
+ * @param[in]  sourceSize Size of the raw chunk.
+ * @param[out] pTarget    Pointer to the target buffer.
+ * @param[in]  targetSize Size of the target buffer.
+ *
+ * @return  Size of the compressed data, 0 if it does not fit the target buffer.
+ */
+GOS_STATIC u16_t gos_gcpCompressChunk (
+        u8_t*                   pSource,
+        u16_t                   sourceSize,
+        u8_t*                   pTarget,
+        u16_t                   targetSize
+        )
+{
+    /*
+     * Local variables.
+     */
+    u16_t  compressedSize = 0u;
+    u16_t  sourceIndex    = 0u;
+    u16_t  literalIndex   = 0u;
+    u16_t  targetIndex    = 0u;
+    u16_t  matchLength    = 0u;
+    u16_t  matchOffset    = 0u;
+    u16_t  candidate      = 0u;
+    u16_t  lead           = 0u;
+    u16_t  cutSource      = 0u;
+    u16_t  cutTarget      = 0u;
+    u32_t  hashIndex      = 0u;
+    bool_t overflow       = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    (void_t) memset((void_t*)gcpCompressionHash, 0, sizeof(gcpCompressionHash));
+
+    while (overflow == GOS_FALSE && literalIndex < sourceSize)
+    {
+        matchLength = 0u;
+
+        if (sourceIndex + GCP_LZ_MATCH_MIN <= sourceSize)
+        {
+            hashIndex = (((u32_t)pSource[sourceIndex] | ((u32_t)pSource[sourceIndex + 1u] << 8u) |
+                        ((u32_t)pSource[sourceIndex + 2u] << 16u)) * GCP_LZ_HASH_MULTIPLIER) >> (32u - CFG_GCP_COMPRESSION_HASH_BITS);
+            candidate = gcpCompressionHash[hashIndex];
+            gcpCompressionHash[hashIndex] = sourceIndex + 1u;
+
+            if (candidate != 0u && candidate <= sourceIndex && (sourceIndex - candidate + 1u) <= GCP_LZ_OFFSET_MAX)
+            {
+                matchOffset = sourceIndex - candidate + 1u;
+
+                while (matchLength < GCP_LZ_MATCH_MAX && sourceIndex + matchLength < sourceSize &&
+                       pSource[sourceIndex + matchLength - matchOffset] == pSource[sourceIndex + matchLength])
+                {
+                    matchLength++;
+                }
+            }
+            else
+            {
+                // No candidate.
+            }
+        }
+        else
+        {
+            // End of the chunk.
+        }
+
+        if (matchLength < GCP_LZ_MATCH_MIN && sourceIndex < sourceSize && (u16_t)(sourceIndex - literalIndex) < GCP_LZ_LITERAL_MAX)
+        {
+            sourceIndex++;
+        }
+        else
+        {
+            // Flush the literal run.
+            if (sourceIndex > literalIndex && targetIndex + 1u + (sourceIndex - literalIndex) <= targetSize)
+            {
+                pTarget[targetIndex++] = (u8_t)(sourceIndex - literalIndex - 1u);
+                (void_t) memcpy((void_t*)&pTarget[targetIndex], (void_t*)&pSource[literalIndex], sourceIndex - literalIndex);
+                targetIndex += sourceIndex - literalIndex;
+                literalIndex = sourceIndex;
+            }
+            else if (sourceIndex > literalIndex)
+            {
+                overflow = GOS_TRUE;
+            }
+            else
+            {
+                // No literals.
+            }
+
+            if (overflow == GOS_FALSE && matchLength >= GCP_LZ_MATCH_MIN)
+            {
+                if (targetIndex + 2u <= targetSize)
+                {
+                    pTarget[targetIndex++] = (u8_t)(GCP_LZ_MATCH_FLAG | ((matchLength - GCP_LZ_MATCH_MIN) << 3u) | ((matchOffset - 1u) >> 8u));
+                    pTarget[targetIndex++] = (u8_t)((matchOffset - 1u) & 0xFFu);
+                    sourceIndex  += matchLength;
+                    literalIndex  = sourceIndex;
+
+                    // Only matches gain on the input, the first maximum is the cut point.
+                    if (sourceIndex > targetIndex && (u16_t)(sourceIndex - targetIndex) > lead)
+                    {
+                        lead      = sourceIndex - targetIndex;
+                        cutSource = sourceIndex;
+                        cutTarget = targetIndex;
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+                }
+                else
+                {
+                    overflow = GOS_TRUE;
+                }
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+    }
+
+    if (lead > 0u && (u32_t)cutTarget + sourceSize - cutSource <= targetSize)
+    {
+        (void_t) memcpy((void_t*)&pTarget[cutTarget], (void_t*)&pSource[cutSource], sourceSize - cutSource);
+        compressedSize = cutTarget + sourceSize - cutSource;
+    }
+    else
+    {
+        // Not compressible.
+    }
+
+    return compressedSize;
+}
+#endif
+
+/**
+ * @brief   Expands a chunk in place.
+ * @details Raw chunks are left as they are. The compressed data of a compressed chunk is
+ *          stored at the end of the chunk place, and the chunk is expanded towards its start
+ *          until the output reaches the input (the rest of the chunk is already in place).
+ *          Tokens that would read outside the data or overwrite unread input are rejected.
+ *
+ * @param[in]     pHeader     Pointer to the chunk header.
+ * @param[in,out] pChunk      Pointer to the chunk place.
+ * @param[in]     chunkLength Raw chunk length.
+ * @param[in]     dataSize    Size of the received data (at the end of the chunk place).
+ *
+ * @return  Result of expansion.
+ *
+ * @retval  #GOS_SUCCESS Raw chunk or compressed chunk expanded successfully.
+ * @retval  #GOS_ERROR   Corrupted compressed data or unsupported frame.
+ */
+GOS_STATIC gos_result_t gos_gcpDecompressChunk (
+        gos_gcpHeaderFrame_t*   pHeader,
+        u8_t*                   pChunk,
+        u16_t                   chunkLength,
+        u16_t                   dataSize
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t decompressResult = GOS_ERROR;
+#if CFG_GCP_COMPRESSION == 1
+    u16_t        inputIndex       = chunkLength - dataSize;
+    u16_t        outputIndex      = 0u;
+    u16_t        copyLength       = 0u;
+    u16_t        matchOffset      = 0u;
+    u8_t         token            = 0u;
+#endif
+
+    /*
+     * Function code.
+     */
+    if (pHeader->ackType == GCP_FRAME_CHUNK)
+    {
+        decompressResult = GOS_SUCCESS;
+    }
+#if CFG_GCP_COMPRESSION == 1
+    else if (pHeader->ackType == GCP_FRAME_CHUNK_LZ)
+    {
+        decompressResult = GOS_SUCCESS;
+
+        while (decompressResult == GOS_SUCCESS && outputIndex < inputIndex && inputIndex < chunkLength)
+        {
+            token = pChunk[inputIndex++];
+
+            if ((token & GCP_LZ_MATCH_FLAG) == 0u)
+            {
+                copyLength = (u16_t)token + 1u;
+
+                if (copyLength <= chunkLength - inputIndex)
+                {
+                    // The output never passes the input, the copy can run forward.
+                    for (; copyLength > 0u; copyLength--)
+                    {
+                        pChunk[outputIndex++] = pChunk[inputIndex++];
+                    }
+                }
+                else
+                {
+                    decompressResult = GOS_ERROR;
+                }
+            }
+            else if (inputIndex < chunkLength)
+            {
+                copyLength  = (u16_t)((token >> 3u) & 0x0Fu) + GCP_LZ_MATCH_MIN;
+                matchOffset = (u16_t)((((u16_t)token & 0x07u) << 8u) | pChunk[inputIndex++]) + 1u;
+
+                if (matchOffset <= outputIndex && outputIndex + copyLength <= inputIndex)
+                {
+                    // Byte-wise copy, the match may overlap its own output.
+                    for (; copyLength > 0u; copyLength--)
+                    {
+                        pChunk[outputIndex] = pChunk[outputIndex - matchOffset];
+                        outputIndex++;
+                    }
+                }
+                else
+                {
+                    decompressResult = GOS_ERROR;
+                }
+            }
+            else
+            {
+                decompressResult = GOS_ERROR;
+            }
+        }
+
+        if (outputIndex != inputIndex)
+        {
+            decompressResult = GOS_ERROR;
+        }
+        else
+        {
+            // Chunk expanded.
+        }
+    }
+#endif
+    else
+    {
+        // Unsupported frame.
+    }
+
+    return decompressResult;
+}
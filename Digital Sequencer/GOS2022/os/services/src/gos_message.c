@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_message.c
 //! @author     Ahmed Gazar
-//! @date       2025-04-06
-//! @version    1.10
+//! @date       2026-10-19
+//! @version    1.15
 //!
 //! @brief      GOS message service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_message.h
@@ -43,6 +43,26 @@
 // 1.8        2023-09-14    Ahmed Gazar     +    Mutex initialization result processing added
 // 1.9        2023-11-01    Ahmed Gazar     +    Mutex unlock return value void casts added
 // 1.10       2025-04-06    Ahmed Gazar     *    Initializer result logic inverted
+// 1.11       2026-10-19    Ahmed Gazar     -    Message daemon task removed
+//                                          *    Messages are handed over to the matching waiter
+//                                               directly in gos_messageTx, only unmatched
+//                                               messages are buffered
+//                                          *    Reception timeout handled by the kernel block
+//                                               timeout
+// 1.12       2026-10-19    Ahmed Gazar     +    Hash-indexed message ID routing tables added for
+//                                               waiters and buffered messages
+//                                          +    Free-slot bitmaps added for message and waiter
+//                                               slots
+//                                          -    Circular next-slot search removed
+// 1.13       2026-10-19    Ahmed Gazar     +    Publish/subscribe mode with reference-counted
+//                                               publication buffers added
+// 1.14       2026-10-19    Ahmed Gazar     *    Waiter served check and blocking in gos_messageRx
+//                                               done in one atomic section (lost wakeup fix)
+// 1.15       2026-10-19    Ahmed Gazar     +    gos_messageSubscriberDelete added
+//                                          +    Subscribers and waiters of deleted tasks released
+//                                          *    Pending check and blocking in
+//                                               gos_messageReceivePublished done in one atomic
+//                                               section (lost wakeup fix)
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -68,15 +88,91 @@
  */
 #include <gos_message.h>
 #include <gos_mutex.h>
+#include <gos_signal.h>
 #include <string.h>
 
 /*
  * Macros
  */
 /**
- * Message daemon poll time in [ms].
+ * Number of waiter routing entries (one per waiter and waited ID).
  */
-#define GOS_MESSAGE_DAEMON_POLL_TIME_MS    ( 50u )
+#define GOS_MESSAGE_WAITER_ROUTES          ( CFG_MESSAGE_MAX_WAITERS * CFG_MESSAGE_MAX_WAITER_IDS )
+
+/*
+ * Routing table sizes (power of two, at least twice the number of entries
+ * to keep the probe sequences short).
+ */
+#if   GOS_MESSAGE_WAITER_ROUTES <= 8
+#define GOS_MESSAGE_WAITER_TABLE_SIZE      ( 16u )
+#elif GOS_MESSAGE_WAITER_ROUTES <= 16
+#define GOS_MESSAGE_WAITER_TABLE_SIZE      ( 32u )
+#elif GOS_MESSAGE_WAITER_ROUTES <= 32
+#define GOS_MESSAGE_WAITER_TABLE_SIZE      ( 64u )
+#elif GOS_MESSAGE_WAITER_ROUTES <= 64
+#define GOS_MESSAGE_WAITER_TABLE_SIZE      ( 128u )
+#elif GOS_MESSAGE_WAITER_ROUTES <= 128
+#define GOS_MESSAGE_WAITER_TABLE_SIZE      ( 256u )
+#elif GOS_MESSAGE_WAITER_ROUTES <= 256
+#define GOS_MESSAGE_WAITER_TABLE_SIZE      ( 512u )
+#elif GOS_MESSAGE_WAITER_ROUTES <= 512
+#define GOS_MESSAGE_WAITER_TABLE_SIZE      ( 1024u )
+#else
+#error "gos_message: too many waiter routes, decrease CFG_MESSAGE_MAX_WAITERS or CFG_MESSAGE_MAX_WAITER_IDS!"
+#endif
+
+#if   CFG_MESSAGE_MAX_NUMBER <= 8
+#define GOS_MESSAGE_BUFFER_TABLE_SIZE      ( 16u )
+#elif CFG_MESSAGE_MAX_NUMBER <= 16
+#define GOS_MESSAGE_BUFFER_TABLE_SIZE      ( 32u )
+#elif CFG_MESSAGE_MAX_NUMBER <= 32
+#define GOS_MESSAGE_BUFFER_TABLE_SIZE      ( 64u )
+#elif CFG_MESSAGE_MAX_NUMBER <= 64
+#define GOS_MESSAGE_BUFFER_TABLE_SIZE      ( 128u )
+#elif CFG_MESSAGE_MAX_NUMBER <= 128
+#define GOS_MESSAGE_BUFFER_TABLE_SIZE      ( 256u )
+#elif CFG_MESSAGE_MAX_NUMBER <= 256
+#define GOS_MESSAGE_BUFFER_TABLE_SIZE      ( 512u )
+#else
+#error "gos_message: CFG_MESSAGE_MAX_NUMBER is too big!"
+#endif
+
+#if   CFG_MESSAGE_MAX_TOPICS <= 8
+#define GOS_MESSAGE_TOPIC_TABLE_SIZE       ( 16u )
+#elif CFG_MESSAGE_MAX_TOPICS <= 16
+#define GOS_MESSAGE_TOPIC_TABLE_SIZE       ( 32u )
+#elif CFG_MESSAGE_MAX_TOPICS <= 32
+#define GOS_MESSAGE_TOPIC_TABLE_SIZE       ( 64u )
+#elif CFG_MESSAGE_MAX_TOPICS <= 64
+#define GOS_MESSAGE_TOPIC_TABLE_SIZE       ( 128u )
+#else
+#error "gos_message: CFG_MESSAGE_MAX_TOPICS is too big!"
+#endif
+
+/**
+ * Number of words in the message slot bitmap.
+ */
+#define GOS_MESSAGE_BITMAP_WORDS           ( (CFG_MESSAGE_MAX_NUMBER + 31) / 32 )
+
+/**
+ * Number of words in the waiter slot bitmap.
+ */
+#define GOS_MESSAGE_WAITER_BITMAP_WORDS    ( (CFG_MESSAGE_MAX_WAITERS + 31) / 32 )
+
+/**
+ * Number of words in the topic slot bitmap.
+ */
+#define GOS_MESSAGE_TOPIC_BITMAP_WORDS     ( (CFG_MESSAGE_MAX_TOPICS + 31) / 32 )
+
+/**
+ * Number of words in the publication slot bitmap.
+ */
+#define GOS_MESSAGE_PUBLICATION_BITMAP_WORDS ( (CFG_MESSAGE_MAX_PUBLICATIONS + 31) / 32 )
+
+/**
+ * Invalid slot index.
+ */
+#define GOS_MESSAGE_INVALID_SLOT           ( UINT16_MAX )
 
 /*
  * Type definitions
@@ -87,40 +183,121 @@
 typedef struct
 {
     gos_tid_t            waiterTaskId;                                //!< Waiter task ID.
-    gos_messageTimeout_t waitTmo;                                     //!< Wait timeout value.
-    gos_messageTimeout_t waitTmoCounter;                              //!< Wait timeout counter.
     gos_messageId_t      messageIdArray [CFG_MESSAGE_MAX_WAITER_IDS]; //!< Message ID array.
     gos_message_t*       target;                                      //!< Target buffer.
     bool_t               waiterServed;                                //!< Waiter served flag.
 }gos_messageWaiterDesc_t;
 
+/**
+ * Routing table entry type (message ID to slot index).
+ */
+typedef struct
+{
+    gos_messageId_t messageId;                                        //!< Message ID.
+    u16_t           slotIndex;                                        //!< Waiter or message slot index.
+}gos_messageRoute_t;
+
+/**
+ * Message subscriber descriptor type.
+ */
+typedef struct
+{
+    gos_tid_t ownerTaskId;                                           //!< Owner task ID.
+    u16_t     pendingArray [CFG_MESSAGE_SUBSCRIBER_QUEUE];           //!< Pending publication indexes.
+    u16_t     pendingHead;                                           //!< Index of the oldest pending publication.
+    u16_t     pendingNumber;                                         //!< Number of pending publications.
+    u16_t     heldPublication;                                       //!< Publication currently viewed by the owner.
+    bool_t    waiting;                                               //!< Owner waiting flag.
+    u32_t     overrunCounter;                                        //!< Number of dropped publications.
+}gos_messageSubscriberDesc_t;
+
+/**
+ * Message topic descriptor type.
+ */
+typedef struct
+{
+    gos_messageId_t           messageId;                             //!< Message ID.
+    gos_messageSubscriberId_t addressees [CFG_MESSAGE_MAX_ADDRESSEES]; //!< Subscribers of the message ID.
+    u16_t                     addresseeNumber;                       //!< Number of subscribers.
+}gos_messageTopicDesc_t;
+
 /*
  * Static variables
  */
 /**
- * Internal message array.
+ * Internal message array (for messages without a waiter).
  */
 GOS_STATIC gos_message_t            messageArray       [CFG_MESSAGE_MAX_NUMBER];
 
+/**
+ * Sequence numbers of the buffered messages (to keep FIFO order between different IDs).
+ */
+GOS_STATIC u32_t                    messageSequence    [CFG_MESSAGE_MAX_NUMBER];
+
 /**
  * Internal message waiter array.
  */
 GOS_STATIC gos_messageWaiterDesc_t  messageWaiterArray [CFG_MESSAGE_MAX_WAITERS];
 
 /**
- * Message daemon task ID.
+ * Message ID to waiter routing table.
+ */
+GOS_STATIC gos_messageRoute_t       waiterRouteTable   [GOS_MESSAGE_WAITER_TABLE_SIZE];
+
+/**
+ * Message ID to buffered message routing table.
+ */
+GOS_STATIC gos_messageRoute_t       bufferRouteTable   [GOS_MESSAGE_BUFFER_TABLE_SIZE];
+
+/**
+ * Used message slot bitmap.
+ */
+GOS_STATIC u32_t                    messageSlotBitmap  [GOS_MESSAGE_BITMAP_WORDS];
+
+/**
+ * Used waiter slot bitmap.
+ */
+GOS_STATIC u32_t                    waiterSlotBitmap   [GOS_MESSAGE_WAITER_BITMAP_WORDS];
+
+/**
+ * Message subscriber array.
+ */
+GOS_STATIC gos_messageSubscriberDesc_t messageSubscriberArray [CFG_MESSAGE_MAX_SUBSCRIBERS];
+
+/**
+ * Message topic array.
+ */
+GOS_STATIC gos_messageTopicDesc_t   messageTopicArray  [CFG_MESSAGE_MAX_TOPICS];
+
+/**
+ * Message ID to topic routing table.
+ */
+GOS_STATIC gos_messageRoute_t       topicRouteTable    [GOS_MESSAGE_TOPIC_TABLE_SIZE];
+
+/**
+ * Used topic slot bitmap.
+ */
+GOS_STATIC u32_t                    topicSlotBitmap    [GOS_MESSAGE_TOPIC_BITMAP_WORDS];
+
+/**
+ * Publication buffer array.
+ */
+GOS_STATIC gos_message_t            publicationArray   [CFG_MESSAGE_MAX_PUBLICATIONS];
+
+/**
+ * Reference counters of the publication buffers.
  */
-GOS_STATIC gos_tid_t                messageDaemonTaskId;
+GOS_STATIC u16_t                    publicationRefCounter [CFG_MESSAGE_MAX_PUBLICATIONS];
 
 /**
- * Index of the next message slot (for circular buffer).
+ * Used publication slot bitmap.
  */
-GOS_STATIC gos_messageIndex_t       nextMessageIndex;
+GOS_STATIC u32_t                    publicationSlotBitmap [GOS_MESSAGE_PUBLICATION_BITMAP_WORDS];
 
 /**
- * Index of the next waiter slot (for circular buffer).
+ * Next message sequence number.
  */
-GOS_STATIC gos_messageWaiterIndex_t nextWaiterIndex;
+GOS_STATIC u32_t                    nextMessageSequence;
 
 /**
  * Message mutex to protect the internal arrays as shared resources.
@@ -130,19 +307,18 @@ GOS_STATIC gos_mutex_t              messageMutex;
 /*
  * Function prototypes
  */
-GOS_STATIC void_t gos_messageDaemonTask (void_t);
-
-/**
- * Message daemon task descriptor.
- */
-GOS_STATIC gos_taskDescriptor_t messageDaemonTaskDesc =
-{
-    .taskFunction        = gos_messageDaemonTask,
-    .taskName            = "gos_message_daemon",
-    .taskPriority        = CFG_TASK_MESSAGE_DAEMON_PRIO,
-    .taskStackSize       = CFG_TASK_MESSAGE_DAEMON_STACK,
-    .taskPrivilegeLevel  = GOS_TASK_PRIVILEGE_KERNEL
-};
+GOS_STATIC void_t gos_messageCopy        (gos_message_t* target, gos_message_t* source);
+GOS_STATIC u16_t  gos_messageSlotAlloc   (u32_t* pBitmap, u16_t words, u16_t slotNumber);
+GOS_STATIC void_t gos_messageSlotFree    (u32_t* pBitmap, u16_t slotIndex);
+GOS_STATIC u16_t  gos_messageRouteHash   (gos_messageId_t messageId, u16_t tableSize);
+GOS_STATIC void_t gos_messageRouteAdd    (gos_messageRoute_t* pTable, u16_t tableSize, gos_messageId_t messageId, u16_t slotIndex);
+GOS_STATIC u16_t  gos_messageRouteFind   (gos_messageRoute_t* pTable, u16_t tableSize, gos_messageId_t messageId);
+GOS_STATIC void_t gos_messageRouteRemove (gos_messageRoute_t* pTable, u16_t tableSize, gos_messageId_t messageId, u16_t slotIndex);
+GOS_STATIC void_t gos_messageWaiterUnroute (gos_messageWaiterIndex_t waiterIndex);
+GOS_STATIC void_t gos_messagePublicationRelease (u16_t publicationIndex);
+GOS_STATIC bool_t gos_messageTopicRemoveAddressee (u16_t topicIndex, gos_messageSubscriberId_t subscriberId);
+GOS_STATIC void_t gos_messageSubscriberFree (gos_messageSubscriberId_t subscriberId);
+GOS_STATIC void_t gos_messageTaskDeleteHandler (gos_signalSenderId_t senderId);
 
 /*
  * Function: gos_messageInit
@@ -155,12 +331,12 @@ gos_result_t gos_messageInit (void_t)
     gos_result_t             messageInitResult  = GOS_ERROR;
     gos_messageIndex_t       messageIndex       = 0u;
     gos_messageWaiterIndex_t messageWaiterIndex = 0u;
+    u16_t                    routeIndex         = 0u;
 
     /*
      * Function code.
      */
-    nextMessageIndex = 0u;
-    nextWaiterIndex  = 0u;
+    nextMessageSequence = 0u;
 
     for (messageIndex = 0u; messageIndex < CFG_MESSAGE_MAX_NUMBER; messageIndex++)
     {
@@ -171,11 +347,37 @@ gos_result_t gos_messageInit (void_t)
     for (messageWaiterIndex = 0u; messageWaiterIndex < CFG_MESSAGE_MAX_WAITERS; messageWaiterIndex++)
     {
         messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+        messageWaiterArray[messageWaiterIndex].waiterServed = GOS_FALSE;
+    }
+
+    for (routeIndex = 0u; routeIndex < GOS_MESSAGE_WAITER_TABLE_SIZE; routeIndex++)
+    {
+        waiterRouteTable[routeIndex].messageId = GOS_MESSAGE_INVALID_ID;
+    }
+
+    for (routeIndex = 0u; routeIndex < GOS_MESSAGE_BUFFER_TABLE_SIZE; routeIndex++)
+    {
+        bufferRouteTable[routeIndex].messageId = GOS_MESSAGE_INVALID_ID;
+    }
+
+    for (routeIndex = 0u; routeIndex < GOS_MESSAGE_TOPIC_TABLE_SIZE; routeIndex++)
+    {
+        topicRouteTable[routeIndex].messageId = GOS_MESSAGE_INVALID_ID;
+    }
+
+    for (routeIndex = 0u; routeIndex < CFG_MESSAGE_MAX_SUBSCRIBERS; routeIndex++)
+    {
+        messageSubscriberArray[routeIndex].ownerTaskId = GOS_INVALID_TASK_ID;
     }
 
-    // Initialize message mutex, and register message daemon task.
-    if (gos_mutexInit(&messageMutex) == GOS_SUCCESS &&
-        gos_taskRegister(&messageDaemonTaskDesc, &messageDaemonTaskId) == GOS_SUCCESS)
+    (void_t*) memset((void_t*)messageSlotBitmap, 0, sizeof(messageSlotBitmap));
+    (void_t*) memset((void_t*)waiterSlotBitmap, 0, sizeof(waiterSlotBitmap));
+    (void_t*) memset((void_t*)topicSlotBitmap, 0, sizeof(topicSlotBitmap));
+    (void_t*) memset((void_t*)publicationSlotBitmap, 0, sizeof(publicationSlotBitmap));
+
+    // Initialize message mutex and release the resources of deleted tasks.
+    if (gos_mutexInit(&messageMutex)                                == GOS_SUCCESS &&
+        gos_taskSubscribeDeleteSignal(gos_messageTaskDeleteHandler) == GOS_SUCCESS)
     {
         messageInitResult = GOS_SUCCESS;
     }
@@ -201,97 +403,140 @@ GOS_INLINE gos_result_t gos_messageRx (
      */
     gos_result_t             messageRxResult    = GOS_ERROR;
     gos_tid_t                currentTaskId      = GOS_INVALID_TASK_ID;
-    gos_messageWaiterIndex_t messageWaiterIndex = 0u;
-    gos_messageWaiterIndex_t index              = 0u;
+    u16_t                    messageWaiterIndex = GOS_MESSAGE_INVALID_SLOT;
+    u16_t                    messageIndex       = GOS_MESSAGE_INVALID_SLOT;
+    u16_t                    candidateIndex     = GOS_MESSAGE_INVALID_SLOT;
     gos_messageIdIndex_t     messageIdIndex     = 0u;
-    gos_taskPrivilegeLevel_t privileges         = 0u;
+    gos_blockMaxTick_t       blockTicks         = GOS_TASK_MAX_BLOCK_TIME_MS;
 
     /*
      * Function code.
      */
     if (target                                              != NULL &&
         messageIdArray                                      != NULL &&
+        gos_taskGetCurrentId(&currentTaskId)                == GOS_SUCCESS &&
         gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
     {
-        if (messageWaiterArray[nextWaiterIndex].waiterTaskId == GOS_INVALID_TASK_ID &&
-            gos_taskGetCurrentId(&currentTaskId)       == GOS_SUCCESS)
+        // Check the buffered messages first: take the oldest one of the requested IDs.
+        for (messageIdIndex = 0u; messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS && messageIdArray[messageIdIndex] != 0u; messageIdIndex++)
         {
-            // Add waiter to array.
-            messageWaiterArray[nextWaiterIndex].waiterTaskId   = currentTaskId;
-            messageWaiterArray[nextWaiterIndex].waitTmo        = tmo;
-            messageWaiterArray[nextWaiterIndex].waitTmoCounter = 0u;
-            messageWaiterArray[nextWaiterIndex].target         = target;
-            messageWaiterArray[nextWaiterIndex].waiterServed   = GOS_FALSE;
-
-            (void_t*) memset(messageWaiterArray[nextWaiterIndex].messageIdArray, 0, CFG_MESSAGE_MAX_WAITER_IDS * sizeof(gos_messageId_t));
+            candidateIndex = gos_messageRouteFind(bufferRouteTable, GOS_MESSAGE_BUFFER_TABLE_SIZE, messageIdArray[messageIdIndex]);
 
-            for (messageIdIndex = 0u; messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS; messageIdIndex++)
+            if (candidateIndex != GOS_MESSAGE_INVALID_SLOT &&
+                (messageIndex == GOS_MESSAGE_INVALID_SLOT ||
+                 (s32_t)(messageSequence[candidateIndex] - messageSequence[messageIndex]) < 0))
             {
-                if (messageIdArray[messageIdIndex] == 0u)
-                {
-                    break;
-                }
-                else
-                {
-                    messageWaiterArray[nextWaiterIndex].messageIdArray[messageIdIndex] = messageIdArray[messageIdIndex];
-                }
+                messageIndex = candidateIndex;
             }
+            else
+            {
+                // Nothing to do.
+            }
+        }
 
-            messageWaiterIndex = nextWaiterIndex;
+        if (messageIndex != GOS_MESSAGE_INVALID_SLOT)
+        {
+            // Message received from buffer.
+            gos_messageCopy(target, &messageArray[messageIndex]);
+            gos_messageRouteRemove(bufferRouteTable, GOS_MESSAGE_BUFFER_TABLE_SIZE, messageArray[messageIndex].messageId, messageIndex);
+            gos_messageSlotFree(messageSlotBitmap, messageIndex);
+            messageArray[messageIndex].messageId = GOS_MESSAGE_INVALID_ID;
+            messageRxResult = GOS_SUCCESS;
+        }
+        else if ((messageWaiterIndex = gos_messageSlotAlloc(waiterSlotBitmap, GOS_MESSAGE_WAITER_BITMAP_WORDS, CFG_MESSAGE_MAX_WAITERS)) !=
+                 GOS_MESSAGE_INVALID_SLOT)
+        {
+            // Add waiter to array and route its IDs to it.
+            messageWaiterArray[messageWaiterIndex].waiterTaskId = currentTaskId;
+            messageWaiterArray[messageWaiterIndex].target       = target;
+            messageWaiterArray[messageWaiterIndex].waiterServed = GOS_FALSE;
 
-            for (index = 0u; index < CFG_MESSAGE_MAX_WAITERS; index++)
-            {
-                if (++nextWaiterIndex == CFG_MESSAGE_MAX_WAITERS)
-                {
-                    nextWaiterIndex = 0u;
-                }
-                else
-                {
-                    // Nothing to do.
-                }
+            (void_t*) memset(messageWaiterArray[messageWaiterIndex].messageIdArray, 0, CFG_MESSAGE_MAX_WAITER_IDS * sizeof(gos_messageId_t));
 
-                if (messageWaiterArray[nextWaiterIndex].waiterTaskId == GOS_INVALID_TASK_ID)
+            for (messageIdIndex = 0u; messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS; messageIdIndex++)
+            {
+                if (messageIdArray[messageIdIndex] == 0u)
                 {
                     break;
                 }
                 else
                 {
-                    // Nothing to do.
+                    messageWaiterArray[messageWaiterIndex].messageIdArray[messageIdIndex] = messageIdArray[messageIdIndex];
+                    gos_messageRouteAdd(waiterRouteTable, GOS_MESSAGE_WAITER_TABLE_SIZE, messageIdArray[messageIdIndex], messageWaiterIndex);
                 }
             }
 
             // Unlock message mutex.
             (void_t) gos_mutexUnlock(&messageMutex);
 
-            // Block task (to be unblocked by daemon).
-            (void_t) gos_taskGetPrivileges(currentTaskId, &privileges);
+            // Block task until the message is handed over by the transmitter
+            // or the timeout elapses.
+            if (tmo != GOS_MESSAGE_ENDLESS_TMO)
+            {
+                blockTicks = (gos_blockMaxTick_t)tmo;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            // The check and the state change are done with scheduling disabled, so
+            // a transmitter cannot serve (and unblock) the waiter in between. The
+            // task is switched out when scheduling is enabled again.
+            GOS_ATOMIC_ENTER
 
-            if ((privileges & GOS_PRIV_TASK_MANIPULATE) != GOS_PRIV_TASK_MANIPULATE)
+            if (messageWaiterArray[messageWaiterIndex].waiterServed != GOS_TRUE)
             {
-                (void_t) gos_taskAddPrivilege(currentTaskId, GOS_PRIV_TASK_MANIPULATE);
-                (void_t) gos_taskBlock(currentTaskId, GOS_TASK_MAX_BLOCK_TIME_MS);
-                (void_t) gos_taskRemovePrivilege(currentTaskId, GOS_PRIV_TASK_MANIPULATE);
+                (void_t) gos_taskBlock(currentTaskId, blockTicks);
             }
             else
             {
-                (void_t) gos_taskBlock(currentTaskId, GOS_TASK_MAX_BLOCK_TIME_MS);
+                // Message already received.
             }
 
-            // Task unblocked, check TMO.
-            if (messageWaiterArray[messageWaiterIndex].waiterServed == GOS_TRUE)
+            GOS_ATOMIC_EXIT
+
+            if (messageWaiterArray[messageWaiterIndex].waiterServed != GOS_TRUE)
             {
-                // Message received successfully.
-                messageRxResult = GOS_SUCCESS;
+                // Leave the CPU if the task is still blocked.
+                (void_t) gos_taskYield();
             }
             else
             {
-                // Remove waiter.
-                messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+                // Nothing to do.
             }
 
-            // Reset flag.
-            messageWaiterArray[messageWaiterIndex].waiterServed = GOS_FALSE;
+            // Task unblocked, check result and remove waiter.
+            if (gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+            {
+                if (messageWaiterArray[messageWaiterIndex].waiterServed == GOS_TRUE)
+                {
+                    // Message received successfully (routes removed by transmitter).
+                    messageRxResult = GOS_SUCCESS;
+                }
+                else
+                {
+                    // Timeout.
+                    gos_messageWaiterUnroute(messageWaiterIndex);
+                }
+
+                messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+                messageWaiterArray[messageWaiterIndex].waiterServed = GOS_FALSE;
+                gos_messageSlotFree(waiterSlotBitmap, messageWaiterIndex);
+            }
+            else
+            {
+                // Nothing to do.
+            }
         }
+        else
+        {
+            // Waiter array is full.
+        }
+    }
+    else
+    {
+        // Nothing to do.
     }
 
     // Unlock message mutex.
@@ -310,8 +555,9 @@ GOS_INLINE gos_result_t gos_messageTx (
     /*
      * Local variables.
      */
-    gos_result_t       messageTxResult = GOS_ERROR;
-    gos_messageIndex_t msgIndex        = 0u;
+    gos_result_t messageTxResult    = GOS_ERROR;
+    u16_t        messageIndex       = GOS_MESSAGE_INVALID_SLOT;
+    u16_t        messageWaiterIndex = GOS_MESSAGE_INVALID_SLOT;
 
     /**
      * Function code.
@@ -321,36 +567,39 @@ GOS_INLINE gos_result_t gos_messageTx (
         message->messageSize                                <  CFG_MESSAGE_MAX_LENGTH &&
         gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
     {
-        if (messageArray[nextMessageIndex].messageId == GOS_MESSAGE_INVALID_ID)
+        messageWaiterIndex = gos_messageRouteFind(waiterRouteTable, GOS_MESSAGE_WAITER_TABLE_SIZE, message->messageId);
+
+        if (messageWaiterIndex != GOS_MESSAGE_INVALID_SLOT)
         {
-            (void_t*) memcpy((void_t*)&messageArray[nextMessageIndex], (void_t*)message, sizeof(*message));
+            // Hand the message over to the waiter directly.
+            gos_messageCopy(messageWaiterArray[messageWaiterIndex].target, message);
+            gos_messageWaiterUnroute(messageWaiterIndex);
+            messageWaiterArray[messageWaiterIndex].waiterServed = GOS_TRUE;
 
-            messageTxResult = GOS_SUCCESS;
+            // Unblock waiter (the transmitter does not need task manipulation privilege).
+            GOS_ATOMIC_ENTER
+            GOS_ISR_ENTER
 
-            for (msgIndex = 0u; msgIndex < CFG_MESSAGE_MAX_NUMBER; msgIndex++)
-            {
-                if (++nextMessageIndex == CFG_MESSAGE_MAX_NUMBER)
-                {
-                    nextMessageIndex = 0u;
-                }
-                else
-                {
-                    // Nothing to do.
-                }
+            (void_t) gos_taskUnblock(messageWaiterArray[messageWaiterIndex].waiterTaskId);
 
-                if (messageArray[nextMessageIndex].messageId == GOS_MESSAGE_INVALID_ID)
-                {
-                    break;
-                }
-                else
-                {
-                    // Nothing to do.
-                }
-            }
+            GOS_ISR_EXIT
+            GOS_ATOMIC_EXIT
+
+            messageTxResult = GOS_SUCCESS;
+        }
+        else if ((messageIndex = gos_messageSlotAlloc(messageSlotBitmap, GOS_MESSAGE_BITMAP_WORDS, CFG_MESSAGE_MAX_NUMBER)) !=
+                 GOS_MESSAGE_INVALID_SLOT)
+        {
+            // No waiter for the message, store it in the internal buffer.
+            gos_messageCopy(&messageArray[messageIndex], message);
+            messageSequence[messageIndex] = nextMessageSequence++;
+            gos_messageRouteAdd(bufferRouteTable, GOS_MESSAGE_BUFFER_TABLE_SIZE, message->messageId, messageIndex);
+
+            messageTxResult = GOS_SUCCESS;
         }
         else
         {
-            // Nothing to do.
+            // Message buffer is full.
         }
     }
     else
@@ -364,101 +613,954 @@ GOS_INLINE gos_result_t gos_messageTx (
     return messageTxResult;
 }
 
-/**
- * @brief   Message daemon task.
- * @details This task is responsible for message transfer between tasks. It loops
- *          through the internal message array and the waiter task array and if a
- *          message and a waiter matches, it copies the message to the target
- *          buffer and unblocks the previously blocked task.
- *
- * @return    -
+/*
+ * Function: gos_messageSubscriberCreate
  */
-GOS_STATIC void_t gos_messageDaemonTask (void_t)
+gos_result_t gos_messageSubscriberCreate (
+        gos_messageSubscriberId_t* pSubscriberId
+        )
 {
     /*
      * Local variables.
      */
-    gos_messageIndex_t       messageIndex       = 0u;
-    gos_messageWaiterIndex_t messageWaiterIndex = 0u;
-    gos_messageIdIndex_t     messageIdIndex     = 0u;
+    gos_result_t              subscriberCreateResult = GOS_ERROR;
+    gos_messageSubscriberId_t subscriberIndex        = 0u;
+    gos_tid_t                 currentTaskId          = GOS_INVALID_TASK_ID;
 
     /*
      * Function code.
      */
-    for (;;)
+    if (pSubscriberId                                       != NULL &&
+        gos_taskGetCurrentId(&currentTaskId)                == GOS_SUCCESS &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
     {
-        if (gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+        // Find the next unused subscriber and reserve it.
+        for (subscriberIndex = 0u; subscriberIndex < CFG_MESSAGE_MAX_SUBSCRIBERS; subscriberIndex++)
         {
-            for (messageWaiterIndex = 0u; messageWaiterIndex < CFG_MESSAGE_MAX_WAITERS; messageWaiterIndex++)
+            if (messageSubscriberArray[subscriberIndex].ownerTaskId == GOS_INVALID_TASK_ID)
             {
-                if (messageWaiterArray[messageWaiterIndex].waiterTaskId != GOS_INVALID_TASK_ID)
-                {
-                    for (messageIdIndex = 0u; messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS; messageIdIndex++)
-                    {
-                        for (messageIndex = 0u; messageIndex < CFG_MESSAGE_MAX_NUMBER; messageIndex++)
-                        {
-                            if (messageWaiterArray[messageWaiterIndex].messageIdArray[messageIdIndex] ==
-                                messageArray[messageIndex].messageId)
-                            {
-                                (void_t*) memcpy(messageWaiterArray[messageWaiterIndex].target->messageBytes,
-                                      (void_t*)messageArray[messageIndex].messageBytes,
-                                      messageArray[messageIndex].messageSize);
-                                messageWaiterArray[messageWaiterIndex].target->messageSize  = messageArray[messageIndex].messageSize;
-                                messageWaiterArray[messageWaiterIndex].target->messageId    = messageArray[messageIndex].messageId;
-
-                                (void_t) gos_taskUnblock(messageWaiterArray[messageWaiterIndex].waiterTaskId);
-
-                                messageArray[messageIndex].messageId = GOS_MESSAGE_INVALID_ID;
-                                messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
-                                messageWaiterArray[messageWaiterIndex].waiterServed = GOS_TRUE;
-
-                                messageIndex       = CFG_MESSAGE_MAX_NUMBER;
-                                messageIdIndex     = CFG_MESSAGE_MAX_WAITER_IDS;
-                                messageWaiterIndex = CFG_MESSAGE_MAX_WAITERS;
-                            }
-                            else
-                            {
-                                // Nothing to do.
-                            }
-                        }
-                    }
+                messageSubscriberArray[subscriberIndex].ownerTaskId     = currentTaskId;
+                messageSubscriberArray[subscriberIndex].pendingHead     = 0u;
+                messageSubscriberArray[subscriberIndex].pendingNumber   = 0u;
+                messageSubscriberArray[subscriberIndex].heldPublication = GOS_MESSAGE_INVALID_SLOT;
+                messageSubscriberArray[subscriberIndex].waiting         = GOS_FALSE;
+                messageSubscriberArray[subscriberIndex].overrunCounter  = 0u;
+
+                *pSubscriberId         = subscriberIndex;
+                subscriberCreateResult = GOS_SUCCESS;
+                break;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    // Unlock message mutex.
+    (void_t) gos_mutexUnlock(&messageMutex);
+
+    return subscriberCreateResult;
+}
+
+/*
+ * Function: gos_messageSubscribe
+ */
+gos_result_t gos_messageSubscribe (
+        gos_messageSubscriberId_t subscriberId,
+        gos_messageId_t           messageId
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t subscribeResult = GOS_ERROR;
+    u16_t        topicIndex      = GOS_MESSAGE_INVALID_SLOT;
+    u16_t        addresseeIndex  = 0u;
+
+    /*
+     * Function code.
+     */
+    if (subscriberId                                        <  CFG_MESSAGE_MAX_SUBSCRIBERS &&
+        messageId                                           != GOS_MESSAGE_INVALID_ID &&
+        messageId                                           != 0u &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        if (messageSubscriberArray[subscriberId].ownerTaskId != GOS_INVALID_TASK_ID)
+        {
+            topicIndex = gos_messageRouteFind(topicRouteTable, GOS_MESSAGE_TOPIC_TABLE_SIZE, messageId);
+
+            if (topicIndex == GOS_MESSAGE_INVALID_SLOT &&
+                (topicIndex = gos_messageSlotAlloc(topicSlotBitmap, GOS_MESSAGE_TOPIC_BITMAP_WORDS, CFG_MESSAGE_MAX_TOPICS)) !=
+                GOS_MESSAGE_INVALID_SLOT)
+            {
+                // New topic.
+                messageTopicArray[topicIndex].messageId       = messageId;
+                messageTopicArray[topicIndex].addresseeNumber = 0u;
+                gos_messageRouteAdd(topicRouteTable, GOS_MESSAGE_TOPIC_TABLE_SIZE, messageId, topicIndex);
+            }
+            else
+            {
+                // Existing topic or topic array is full.
+            }
 
-                    if (messageWaiterArray[messageWaiterIndex].waiterServed == GOS_FALSE &&
-                        messageWaiterArray[messageWaiterIndex].waitTmo != GOS_MESSAGE_ENDLESS_TMO)
+            if (topicIndex != GOS_MESSAGE_INVALID_SLOT)
+            {
+                for (addresseeIndex = 0u; addresseeIndex < messageTopicArray[topicIndex].addresseeNumber; addresseeIndex++)
+                {
+                    if (messageTopicArray[topicIndex].addressees[addresseeIndex] == subscriberId)
                     {
-                        messageWaiterArray[messageWaiterIndex].waitTmoCounter++;
-
-                        if ((messageWaiterArray[messageWaiterIndex].waitTmoCounter * GOS_MESSAGE_DAEMON_POLL_TIME_MS) >
-                             messageWaiterArray[messageWaiterIndex].waitTmo)
-                        {
-                            // Timeout. Delete waiter, unblock task.
-                            (void_t) gos_taskUnblock(messageWaiterArray[messageWaiterIndex].waiterTaskId);
-                            messageWaiterArray[messageWaiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
-                        }
-                        else
-                        {
-                            // Nothing to do.
-                        }
+                        // Already subscribed.
+                        subscribeResult = GOS_SUCCESS;
+                        break;
                     }
                     else
                     {
                         // Nothing to do.
                     }
                 }
+
+                if (subscribeResult != GOS_SUCCESS &&
+                    messageTopicArray[topicIndex].addresseeNumber < CFG_MESSAGE_MAX_ADDRESSEES)
+                {
+                    messageTopicArray[topicIndex].addressees[messageTopicArray[topicIndex].addresseeNumber++] = subscriberId;
+                    subscribeResult = GOS_SUCCESS;
+                }
                 else
                 {
                     // Nothing to do.
                 }
             }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        else
+        {
+            // Subscriber not in use.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
 
-            // Unlock message mutex.
-            (void_t) gos_mutexUnlock(&messageMutex);
+    // Unlock message mutex.
+    (void_t) gos_mutexUnlock(&messageMutex);
+
+    return subscribeResult;
+}
+
+/*
+ * Function: gos_messageUnsubscribe
+ */
+gos_result_t gos_messageUnsubscribe (
+        gos_messageSubscriberId_t subscriberId,
+        gos_messageId_t           messageId
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t unsubscribeResult = GOS_ERROR;
+    u16_t        topicIndex        = GOS_MESSAGE_INVALID_SLOT;
+
+    /*
+     * Function code.
+     */
+    if (subscriberId                                        <  CFG_MESSAGE_MAX_SUBSCRIBERS &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        topicIndex = gos_messageRouteFind(topicRouteTable, GOS_MESSAGE_TOPIC_TABLE_SIZE, messageId);
+
+        if (topicIndex != GOS_MESSAGE_INVALID_SLOT &&
+            gos_messageTopicRemoveAddressee(topicIndex, subscriberId) == GOS_TRUE)
+        {
+            unsubscribeResult = GOS_SUCCESS;
         }
         else
         {
             // Nothing to do.
         }
-
-        (void_t) gos_taskSleep(GOS_MESSAGE_DAEMON_POLL_TIME_MS);
     }
+    else
+    {
+        // Nothing to do.
+    }
+
+    // Unlock message mutex.
+    (void_t) gos_mutexUnlock(&messageMutex);
+
+    return unsubscribeResult;
+}
+
+/*
+ * Function: gos_messageSubscriberDelete
+ */
+gos_result_t gos_messageSubscriberDelete (
+        gos_messageSubscriberId_t subscriberId
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t subscriberDeleteResult = GOS_ERROR;
+    gos_tid_t    currentTaskId          = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    if (subscriberId                                        <  CFG_MESSAGE_MAX_SUBSCRIBERS &&
+        gos_taskGetCurrentId(&currentTaskId)                == GOS_SUCCESS &&
+        messageSubscriberArray[subscriberId].ownerTaskId    == currentTaskId &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        gos_messageSubscriberFree(subscriberId);
+        subscriberDeleteResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    // Unlock message mutex.
+    (void_t) gos_mutexUnlock(&messageMutex);
+
+    return subscriberDeleteResult;
+}
+
+/*
+ * Function: gos_messagePublish
+ */
+GOS_INLINE gos_result_t gos_messagePublish (
+        gos_message_t* message
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t                 publishResult    = GOS_ERROR;
+    u16_t                        topicIndex       = GOS_MESSAGE_INVALID_SLOT;
+    u16_t                        publicationIndex = GOS_MESSAGE_INVALID_SLOT;
+    u16_t                        addresseeIndex   = 0u;
+    gos_messageSubscriberDesc_t* pSubscriber      = NULL;
+
+    /*
+     * Function code.
+     */
+    if (message                                             != NULL &&
+        message->messageId                                  != GOS_MESSAGE_INVALID_ID &&
+        message->messageSize                                <  CFG_MESSAGE_MAX_LENGTH &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        topicIndex = gos_messageRouteFind(topicRouteTable, GOS_MESSAGE_TOPIC_TABLE_SIZE, message->messageId);
+
+        if (topicIndex == GOS_MESSAGE_INVALID_SLOT)
+        {
+            // Nobody is subscribed to the message.
+            publishResult = GOS_SUCCESS;
+        }
+        else if ((publicationIndex = gos_messageSlotAlloc(publicationSlotBitmap, GOS_MESSAGE_PUBLICATION_BITMAP_WORDS, CFG_MESSAGE_MAX_PUBLICATIONS)) !=
+                 GOS_MESSAGE_INVALID_SLOT)
+        {
+            // Copy message once.
+            gos_messageCopy(&publicationArray[publicationIndex], message);
+            publicationRefCounter[publicationIndex] = 0u;
+
+            // Place a reference in the queue of every addressee.
+            for (addresseeIndex = 0u; addresseeIndex < messageTopicArray[topicIndex].addresseeNumber; addresseeIndex++)
+            {
+                pSubscriber = &messageSubscriberArray[messageTopicArray[topicIndex].addressees[addresseeIndex]];
+
+                if (pSubscriber->pendingNumber < CFG_MESSAGE_SUBSCRIBER_QUEUE)
+                {
+                    pSubscriber->pendingArray[(pSubscriber->pendingHead + pSubscriber->pendingNumber) % CFG_MESSAGE_SUBSCRIBER_QUEUE] = publicationIndex;
+                    pSubscriber->pendingNumber++;
+                    publicationRefCounter[publicationIndex]++;
+
+                    if (pSubscriber->waiting == GOS_TRUE)
+                    {
+                        pSubscriber->waiting = GOS_FALSE;
+
+                        // Unblock subscriber (the publisher does not need task manipulation privilege).
+                        GOS_ATOMIC_ENTER
+                        GOS_ISR_ENTER
+
+                        (void_t) gos_taskUnblock(pSubscriber->ownerTaskId);
+
+                        GOS_ISR_EXIT
+                        GOS_ATOMIC_EXIT
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+                }
+                else
+                {
+                    // Subscriber queue is full, drop message for this subscriber.
+                    pSubscriber->overrunCounter++;
+                }
+            }
+
+            if (publicationRefCounter[publicationIndex] == 0u)
+            {
+                gos_messageSlotFree(publicationSlotBitmap, publicationIndex);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            publishResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // No free publication buffer.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    // Unlock message mutex.
+    (void_t) gos_mutexUnlock(&messageMutex);
+
+    return publishResult;
+}
+
+/*
+ * Function: gos_messageReceivePublished
+ */
+GOS_INLINE gos_result_t gos_messageReceivePublished (
+        gos_messageSubscriberId_t      subscriberId,
+        GOS_CONST gos_message_t**      ppMessage,
+        gos_messageTimeout_t           tmo
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t                 receiveResult = GOS_ERROR;
+    gos_tid_t                    currentTaskId = GOS_INVALID_TASK_ID;
+    gos_blockMaxTick_t           blockTicks    = GOS_TASK_MAX_BLOCK_TIME_MS;
+    gos_messageSubscriberDesc_t* pSubscriber   = NULL;
+
+    /*
+     * Function code.
+     */
+    if (subscriberId                                        <  CFG_MESSAGE_MAX_SUBSCRIBERS &&
+        ppMessage                                           != NULL &&
+        gos_taskGetCurrentId(&currentTaskId)                == GOS_SUCCESS &&
+        messageSubscriberArray[subscriberId].ownerTaskId    == currentTaskId &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        pSubscriber = &messageSubscriberArray[subscriberId];
+
+        // Release the previous view.
+        if (pSubscriber->heldPublication != GOS_MESSAGE_INVALID_SLOT)
+        {
+            gos_messagePublicationRelease(pSubscriber->heldPublication);
+            pSubscriber->heldPublication = GOS_MESSAGE_INVALID_SLOT;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        if (pSubscriber->pendingNumber == 0u)
+        {
+            // Wait for a publication.
+            pSubscriber->waiting = GOS_TRUE;
+
+            // Unlock message mutex.
+            (void_t) gos_mutexUnlock(&messageMutex);
+
+            if (tmo != GOS_MESSAGE_ENDLESS_TMO)
+            {
+                blockTicks = (gos_blockMaxTick_t)tmo;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            // Checked and blocked with scheduling disabled, so a publication
+            // cannot unblock the subscriber in between.
+            GOS_ATOMIC_ENTER
+
+            if (pSubscriber->pendingNumber == 0u)
+            {
+                (void_t) gos_taskBlock(currentTaskId, blockTicks);
+            }
+            else
+            {
+                // Message already published.
+            }
+
+            GOS_ATOMIC_EXIT
+
+            if (pSubscriber->pendingNumber == 0u)
+            {
+                // Leave the CPU if the task is still blocked.
+                (void_t) gos_taskYield();
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            if (gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+            {
+                pSubscriber->waiting = GOS_FALSE;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        else
+        {
+            // Nothing to do.
+        }
+
+        if (pSubscriber->pendingNumber > 0u)
+        {
+            pSubscriber->heldPublication = pSubscriber->pendingArray[pSubscriber->pendingHead];
+            pSubscriber->pendingHead     = (pSubscriber->pendingHead + 1u) % CFG_MESSAGE_SUBSCRIBER_QUEUE;
+            pSubscriber->pendingNumber--;
+
+            *ppMessage    = &publicationArray[pSubscriber->heldPublication];
+            receiveResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Timeout.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    // Unlock message mutex.
+    (void_t) gos_mutexUnlock(&messageMutex);
+
+    return receiveResult;
+}
+
+/*
+ * Function: gos_messageReleasePublished
+ */
+GOS_INLINE gos_result_t gos_messageReleasePublished (
+        gos_messageSubscriberId_t subscriberId
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t releaseResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (subscriberId                                        <  CFG_MESSAGE_MAX_SUBSCRIBERS &&
+        gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        if (messageSubscriberArray[subscriberId].heldPublication != GOS_MESSAGE_INVALID_SLOT)
+        {
+            gos_messagePublicationRelease(messageSubscriberArray[subscriberId].heldPublication);
+            messageSubscriberArray[subscriberId].heldPublication = GOS_MESSAGE_INVALID_SLOT;
+            releaseResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // No view held.
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    // Unlock message mutex.
+    (void_t) gos_mutexUnlock(&messageMutex);
+
+    return releaseResult;
+}
+
+/**
+ * @brief   Copies a message.
+ * @details Copies the ID, size, and the used bytes of the source message to the target.
+ *
+ * @param[out] target Target message.
+ * @param[in]  source Source message.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageCopy (gos_message_t* target, gos_message_t* source)
+{
+    /*
+     * Function code.
+     */
+    (void_t*) memcpy((void_t*)target->messageBytes, (void_t*)source->messageBytes, source->messageSize);
+    target->messageSize = source->messageSize;
+    target->messageId   = source->messageId;
+}
+
+/**
+ * @brief   Allocates a slot from the given bitmap.
+ * @details Finds the first word with a free bit and marks the lowest free bit as used.
+ *
+ * @param[in] pBitmap    Pointer to the slot bitmap.
+ * @param[in] words      Number of words in the bitmap.
+ * @param[in] slotNumber Number of valid slots.
+ *
+ * @return  Index of the allocated slot or #GOS_MESSAGE_INVALID_SLOT if all slots are used.
+ */
+GOS_STATIC u16_t gos_messageSlotAlloc (u32_t* pBitmap, u16_t words, u16_t slotNumber)
+{
+    /*
+     * Local variables.
+     */
+    u16_t slotIndex = GOS_MESSAGE_INVALID_SLOT;
+    u16_t wordIndex = 0u;
+    u16_t bitIndex  = 0u;
+
+    /*
+     * Function code.
+     */
+    for (wordIndex = 0u; wordIndex < words; wordIndex++)
+    {
+        if (pBitmap[wordIndex] != 0xFFFFFFFFu)
+        {
+            bitIndex = (u16_t)__builtin_ctz(~pBitmap[wordIndex]);
+
+            if ((u16_t)(wordIndex * 32u + bitIndex) < slotNumber)
+            {
+                pBitmap[wordIndex] |= (1u << bitIndex);
+                slotIndex = (u16_t)(wordIndex * 32u + bitIndex);
+            }
+            else
+            {
+                // Only unused bits in the last word.
+            }
+
+            break;
+        }
+        else
+        {
+            // Word is full.
+        }
+    }
+
+    return slotIndex;
+}
+
+/**
+ * @brief   Frees a slot in the given bitmap.
+ * @details Clears the bit belonging to the given slot.
+ *
+ * @param[in] pBitmap   Pointer to the slot bitmap.
+ * @param[in] slotIndex Index of the slot to free.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageSlotFree (u32_t* pBitmap, u16_t slotIndex)
+{
+    /*
+     * Function code.
+     */
+    pBitmap[slotIndex / 32u] &= ~(1u << (slotIndex % 32u));
+}
+
+/**
+ * @brief   Calculates the home position of a message ID in a routing table.
+ * @details Uses multiplicative (Fibonacci) hashing.
+ *
+ * @param[in] messageId Message ID.
+ * @param[in] tableSize Size of the routing table (power of two).
+ *
+ * @return  Home position of the message ID.
+ */
+GOS_STATIC u16_t gos_messageRouteHash (gos_messageId_t messageId, u16_t tableSize)
+{
+    /*
+     * Function code.
+     */
+    return (u16_t)((((u32_t)messageId * 2654435761u) >> 16) & (tableSize - 1u));
+}
+
+/**
+ * @brief   Adds a route to the given routing table.
+ * @details Linear probing from the home position of the ID. Entries with the
+ *          same ID keep their insertion order along the probe sequence.
+ *
+ * @param[in] pTable    Pointer to the routing table.
+ * @param[in] tableSize Size of the routing table (power of two).
+ * @param[in] messageId Message ID.
+ * @param[in] slotIndex Waiter or message slot index.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageRouteAdd (gos_messageRoute_t* pTable, u16_t tableSize, gos_messageId_t messageId, u16_t slotIndex)
+{
+    /*
+     * Local variables.
+     */
+    u16_t routeIndex = gos_messageRouteHash(messageId, tableSize);
+
+    /*
+     * Function code.
+     */
+    // The table is always at most half full, so there is always a free entry.
+    while (pTable[routeIndex].messageId != GOS_MESSAGE_INVALID_ID)
+    {
+        routeIndex = (routeIndex + 1u) & (tableSize - 1u);
+    }
+
+    pTable[routeIndex].messageId = messageId;
+    pTable[routeIndex].slotIndex = slotIndex;
+}
+
+/**
+ * @brief   Finds the first route of the given ID.
+ * @details Probes from the home position of the ID until an empty entry.
+ *
+ * @param[in] pTable    Pointer to the routing table.
+ * @param[in] tableSize Size of the routing table (power of two).
+ * @param[in] messageId Message ID.
+ *
+ * @return  Slot index of the first route or #GOS_MESSAGE_INVALID_SLOT if not found.
+ */
+GOS_STATIC u16_t gos_messageRouteFind (gos_messageRoute_t* pTable, u16_t tableSize, gos_messageId_t messageId)
+{
+    /*
+     * Local variables.
+     */
+    u16_t routeIndex = gos_messageRouteHash(messageId, tableSize);
+    u16_t slotIndex  = GOS_MESSAGE_INVALID_SLOT;
+
+    /*
+     * Function code.
+     */
+    while (pTable[routeIndex].messageId != GOS_MESSAGE_INVALID_ID)
+    {
+        if (pTable[routeIndex].messageId == messageId)
+        {
+            slotIndex = pTable[routeIndex].slotIndex;
+            break;
+        }
+        else
+        {
+            routeIndex = (routeIndex + 1u) & (tableSize - 1u);
+        }
+    }
+
+    return slotIndex;
+}
+
+/**
+ * @brief   Removes a route from the given routing table.
+ * @details Finds the entry with the given ID and slot index, and closes the gap
+ *          by shifting the following entries of the probe sequence backwards
+ *          (so no tombstones are needed).
+ *
+ * @param[in] pTable    Pointer to the routing table.
+ * @param[in] tableSize Size of the routing table (power of two).
+ * @param[in] messageId Message ID.
+ * @param[in] slotIndex Waiter or message slot index.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageRouteRemove (gos_messageRoute_t* pTable, u16_t tableSize, gos_messageId_t messageId, u16_t slotIndex)
+{
+    /*
+     * Local variables.
+     */
+    u16_t mask       = tableSize - 1u;
+    u16_t routeIndex = gos_messageRouteHash(messageId, tableSize);
+    u16_t nextIndex  = 0u;
+    u16_t homeIndex  = 0u;
+
+    /*
+     * Function code.
+     */
+    while (pTable[routeIndex].messageId != GOS_MESSAGE_INVALID_ID &&
+           (pTable[routeIndex].messageId != messageId || pTable[routeIndex].slotIndex != slotIndex))
+    {
+        routeIndex = (routeIndex + 1u) & mask;
+    }
+
+    if (pTable[routeIndex].messageId != GOS_MESSAGE_INVALID_ID)
+    {
+        nextIndex = routeIndex;
+
+        for (;;)
+        {
+            nextIndex = (nextIndex + 1u) & mask;
+
+            if (pTable[nextIndex].messageId == GOS_MESSAGE_INVALID_ID)
+            {
+                break;
+            }
+            else
+            {
+                homeIndex = gos_messageRouteHash(pTable[nextIndex].messageId, tableSize);
+
+                // Move the entry back if its home position is not between the gap
+                // and its current position (cyclically).
+                if (((nextIndex - homeIndex) & mask) >= ((nextIndex - routeIndex) & mask))
+                {
+                    pTable[routeIndex] = pTable[nextIndex];
+                    routeIndex = nextIndex;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+        }
+
+        pTable[routeIndex].messageId = GOS_MESSAGE_INVALID_ID;
+    }
+    else
+    {
+        // Route not found.
+    }
+}
+
+/**
+ * @brief   Removes all routes of the given waiter.
+ * @details Loops through the message ID array of the waiter until the terminating
+ *          zero element and removes the related routes.
+ *
+ * @param[in] waiterIndex Index of the waiter in the waiter array.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageWaiterUnroute (gos_messageWaiterIndex_t waiterIndex)
+{
+    /*
+     * Local variables.
+     */
+    gos_messageIdIndex_t messageIdIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    for (messageIdIndex = 0u; messageIdIndex < CFG_MESSAGE_MAX_WAITER_IDS; messageIdIndex++)
+    {
+        if (messageWaiterArray[waiterIndex].messageIdArray[messageIdIndex] == 0u)
+        {
+            break;
+        }
+        else
+        {
+            gos_messageRouteRemove(waiterRouteTable, GOS_MESSAGE_WAITER_TABLE_SIZE,
+                    messageWaiterArray[waiterIndex].messageIdArray[messageIdIndex], waiterIndex);
+        }
+    }
+}
+
+/**
+ * @brief   Releases one reference of a publication buffer.
+ * @details Decrements the reference counter and frees the buffer when it reaches zero.
+ *
+ * @param[in] publicationIndex Index of the publication buffer.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messagePublicationRelease (u16_t publicationIndex)
+{
+    /*
+     * Function code.
+     */
+    if (publicationRefCounter[publicationIndex] > 0u &&
+        --publicationRefCounter[publicationIndex] == 0u)
+    {
+        gos_messageSlotFree(publicationSlotBitmap, publicationIndex);
+    }
+    else
+    {
+        // Still referenced.
+    }
+}
+
+/**
+ * @brief   Removes a subscriber from the addressee list of a topic.
+ * @details Replaces the subscriber with the last addressee, and removes the topic
+ *          if it has no more addressees.
+ *
+ * @param[in] topicIndex   Index of the topic in the topic array.
+ * @param[in] subscriberId Subscriber identifier.
+ *
+ * @return  #GOS_TRUE if the subscriber was an addressee of the topic, #GOS_FALSE otherwise.
+ */
+GOS_STATIC bool_t gos_messageTopicRemoveAddressee (u16_t topicIndex, gos_messageSubscriberId_t subscriberId)
+{
+    /*
+     * Local variables.
+     */
+    bool_t removed        = GOS_FALSE;
+    u16_t  addresseeIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    for (addresseeIndex = 0u; addresseeIndex < messageTopicArray[topicIndex].addresseeNumber; addresseeIndex++)
+    {
+        if (messageTopicArray[topicIndex].addressees[addresseeIndex] == subscriberId)
+        {
+            // Replace with the last addressee.
+            messageTopicArray[topicIndex].addresseeNumber--;
+            messageTopicArray[topicIndex].addressees[addresseeIndex] =
+                    messageTopicArray[topicIndex].addressees[messageTopicArray[topicIndex].addresseeNumber];
+            removed = GOS_TRUE;
+            break;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    if (messageTopicArray[topicIndex].addresseeNumber == 0u)
+    {
+        // Remove topic.
+        gos_messageRouteRemove(topicRouteTable, GOS_MESSAGE_TOPIC_TABLE_SIZE, messageTopicArray[topicIndex].messageId, topicIndex);
+        gos_messageSlotFree(topicSlotBitmap, topicIndex);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return removed;
+}
+
+/**
+ * @brief   Frees a subscriber.
+ * @details Removes the subscriber from all of its topics, releases the held view
+ *          and the pending publications, and marks the subscriber slot unused.
+ *          Shall be called with the message mutex locked.
+ *
+ * @param[in] subscriberId Subscriber identifier.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageSubscriberFree (gos_messageSubscriberId_t subscriberId)
+{
+    /*
+     * Local variables.
+     */
+    u16_t                        topicIndex  = 0u;
+    gos_messageSubscriberDesc_t* pSubscriber = &messageSubscriberArray[subscriberId];
+
+    /*
+     * Function code.
+     */
+    for (topicIndex = 0u; topicIndex < CFG_MESSAGE_MAX_TOPICS; topicIndex++)
+    {
+        if ((topicSlotBitmap[topicIndex / 32u] & (1u << (topicIndex % 32u))) != 0u)
+        {
+            (void_t) gos_messageTopicRemoveAddressee(topicIndex, subscriberId);
+        }
+        else
+        {
+            // Topic not in use.
+        }
+    }
+
+    if (pSubscriber->heldPublication != GOS_MESSAGE_INVALID_SLOT)
+    {
+        gos_messagePublicationRelease(pSubscriber->heldPublication);
+        pSubscriber->heldPublication = GOS_MESSAGE_INVALID_SLOT;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    while (pSubscriber->pendingNumber > 0u)
+    {
+        gos_messagePublicationRelease(pSubscriber->pendingArray[pSubscriber->pendingHead]);
+        pSubscriber->pendingHead = (pSubscriber->pendingHead + 1u) % CFG_MESSAGE_SUBSCRIBER_QUEUE;
+        pSubscriber->pendingNumber--;
+    }
+
+    pSubscriber->waiting     = GOS_FALSE;
+    pSubscriber->ownerTaskId = GOS_INVALID_TASK_ID;
+}
+
+/**
+ * @brief   Task delete signal handler.
+ * @details Frees the subscribers and the waiter slots of the deleted task, so its
+ *          publication buffers and routes are not held forever.
+ *
+ * @param[in] senderId ID of the deleted task.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_messageTaskDeleteHandler (gos_signalSenderId_t senderId)
+{
+    /*
+     * Local variables.
+     */
+    gos_messageSubscriberId_t subscriberIndex = 0u;
+    gos_messageWaiterIndex_t  waiterIndex     = 0u;
+
+    /*
+     * Function code.
+     */
+    if (gos_mutexLock(&messageMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+    {
+        for (subscriberIndex = 0u; subscriberIndex < CFG_MESSAGE_MAX_SUBSCRIBERS; subscriberIndex++)
+        {
+            if (messageSubscriberArray[subscriberIndex].ownerTaskId == (gos_tid_t)senderId)
+            {
+                gos_messageSubscriberFree(subscriberIndex);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+
+        for (waiterIndex = 0u; waiterIndex < CFG_MESSAGE_MAX_WAITERS; waiterIndex++)
+        {
+            if (messageWaiterArray[waiterIndex].waiterTaskId == (gos_tid_t)senderId)
+            {
+                if (messageWaiterArray[waiterIndex].waiterServed != GOS_TRUE)
+                {
+                    gos_messageWaiterUnroute(waiterIndex);
+                }
+                else
+                {
+                    // Routes already removed by the transmitter.
+                }
+
+                messageWaiterArray[waiterIndex].waiterTaskId = GOS_INVALID_TASK_ID;
+                messageWaiterArray[waiterIndex].waiterServed = GOS_FALSE;
+                gos_messageSlotFree(waiterSlotBitmap, waiterIndex);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    // Unlock message mutex.
+    (void_t) gos_mutexUnlock(&messageMutex);
 }
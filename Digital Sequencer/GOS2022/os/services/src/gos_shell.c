@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_shell.c
 //! @author     Ahmed Gazar
-//! @date       2025-07-29
-//! @version    1.10
+//! @date       2026-10-19
+//! @version    1.15
 //!
 //! @brief      GOS shell service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_shell.h
@@ -39,6 +39,21 @@
 //                                          +    Shell CPU and runtime commands added
 // 1.9        2024-06-28    Ahmed Gazar     +    Task unblock commands added
 // 1.10       2025-07-29    Ahmed Gazar     +    CFG_SHELL_STARTUP_DELAY_MS added
+// 1.11       2026-10-19    Ahmed Gazar     +    Built-in trace command added (channel levels)
+// 1.12       2026-10-19    Ahmed Gazar     *    Daemon blocks on buffered reception and processes
+//                                               every received character per wake-up
+//                                          +    Echo buffering, CR LF handling added
+// 1.13       2026-10-19    Ahmed Gazar     +    Batch execution (';'-separated commands) added
+//                                          +    Machine output mode added
+//                                          +    gos_shellSetOutputMode, gos_shellGetOutputMode
+//                                               added
+// 1.14       2026-10-19    Ahmed Gazar     +    Hashed command lookup added
+//                                          +    Link time command registration added
+//                                          +    gos_shellSubCommandDispatch added
+//                                          *    Built-in commands converted to sub-command tables
+// 1.15       2026-10-19    Ahmed Gazar     *    Command handlers return gos_result_t, machine mode
+//                                               OK/ERR reflects the handler result
+//                                          *    Human messages suppressed in machine mode
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -73,15 +88,68 @@
  * Macros
  */
 /**
- * Shell daemon poll time [ms].
+ * Shell daemon poll time [ms] (only without buffered reception).
  */
 #define GOS_SHELL_DAEMON_POLL_TIME_MS    ( 50u )
 
+/**
+ * Shell receive chunk size.
+ */
+#define GOS_SHELL_RX_CHUNK_SIZE          ( 32u )
+
+/**
+ * Shell echo buffer size.
+ */
+#define GOS_SHELL_ECHO_BUFFER_SIZE       ( 40u )
+
 /**
  * Shell display text.
  */
 #define GOS_SHELL_DISPLAY_TEXT           ("[\x1B[1m\x1B[33mgos shell\x1B[0m]>> ")
 
+/**
+ * Command lookup table index mask.
+ */
+#define GOS_SHELL_HASH_MASK              ( CFG_SHELL_COMMAND_HASH_SIZE - 1u )
+
+/**
+ * FNV-1a offset basis.
+ */
+#define GOS_SHELL_HASH_OFFSET            ( 2166136261u )
+
+/**
+ * FNV-1a prime.
+ */
+#define GOS_SHELL_HASH_PRIME             ( 16777619u )
+
+/**
+ * Sends a human-readable message (suppressed in machine output mode).
+ */
+#define GOS_SHELL_HUMAN_PRINT(...)       ( {                                                        \
+                                             if (outputMode == GOS_SHELL_OUTPUT_HUMAN)              \
+                                             {                                                      \
+                                                 (void_t) gos_shellDriverTransmitString(__VA_ARGS__); \
+                                             }                                                      \
+                                         } )
+
+#if (CFG_SHELL_COMMAND_HASH_SIZE & (CFG_SHELL_COMMAND_HASH_SIZE - 1)) != 0 || \
+    CFG_SHELL_COMMAND_HASH_SIZE < CFG_SHELL_MAX_COMMAND_NUMBER
+#error "gos_shell.c: CFG_SHELL_COMMAND_HASH_SIZE shall be a power of 2 and not less than CFG_SHELL_MAX_COMMAND_NUMBER."
+#endif
+
+/*
+ * External variables
+ */
+/**
+ * Start of the shell command section (defined by the linker script).
+ */
+extern GOS_CONST gos_shellCommand_t __gos_shell_cmd_start [];
+
+/**
+ * End of the shell command section (defined by the linker script).
+ */
+extern GOS_CONST gos_shellCommand_t __gos_shell_cmd_end [];
+
 /*
  * Static variables
  */
@@ -90,6 +158,11 @@
  */
 GOS_STATIC gos_shellCommand_t shellCommands        [CFG_SHELL_MAX_COMMAND_NUMBER];
 
+/**
+ * Command lookup table (open addressing with linear probing).
+ */
+GOS_STATIC GOS_CONST gos_shellCommand_t* commandLookupTable [CFG_SHELL_COMMAND_HASH_SIZE];
+
 /**
  * Shell daemon task ID.
  */
@@ -120,11 +193,63 @@ GOS_STATIC char_t             actualCommand        [CFG_SHELL_MAX_COMMAND_LENGTH
  */
 GOS_STATIC char_t             commandParams        [CFG_SHELL_MAX_PARAMS_LENGTH];
 
+/**
+ * Echo buffer.
+ */
+GOS_STATIC char_t             echoBuffer           [GOS_SHELL_ECHO_BUFFER_SIZE];
+
+/**
+ * Echo buffer length.
+ */
+GOS_STATIC u16_t              echoLength;
+
+/**
+ * Previously received character.
+ */
+GOS_STATIC char_t             previousChar;
+
+/**
+ * Shell output mode.
+ */
+GOS_STATIC gos_shellOutputMode_t outputMode;
+
+/**
+ * Task data buffer for the machine-readable dump.
+ */
+GOS_STATIC gos_taskDescriptor_t   dumpTaskData;
+
 /*
  * Function prototypes
  */
 GOS_STATIC void_t gos_shellDaemonTask     (void_t);
-GOS_STATIC void_t gos_shellCommandHandler (char_t* params);
+GOS_STATIC void_t gos_shellProcessChar    (char_t character);
+GOS_STATIC void_t gos_shellExecuteLine    (void_t);
+GOS_STATIC void_t gos_shellExecuteCommand (char_t* pCommandLine);
+GOS_STATIC void_t gos_shellMachineDump    (void_t);
+GOS_STATIC void_t gos_shellEchoAppend     (char_t character);
+GOS_STATIC void_t gos_shellEchoFlush      (void_t);
+GOS_STATIC u32_t  gos_shellHash           (GOS_CONST char_t* pName);
+GOS_STATIC gos_result_t gos_shellLookupInsert (GOS_CONST gos_shellCommand_t* pCommand);
+GOS_STATIC GOS_CONST gos_shellCommand_t* gos_shellLookup (GOS_CONST char_t* pName);
+GOS_STATIC gos_result_t gos_shellTaskAction (char_t* params, bool_t useTaskId, gos_result_t (*action)(gos_tid_t), char_t* actionName);
+GOS_STATIC gos_result_t gos_shellCommandHandler (char_t* params);
+GOS_STATIC gos_result_t gos_shellCpuHandler     (char_t* params);
+GOS_STATIC gos_result_t gos_shellDeleteHandler  (char_t* params);
+GOS_STATIC gos_result_t gos_shellDeleteTidHandler  (char_t* params);
+GOS_STATIC gos_result_t gos_shellDumpHandler    (char_t* params);
+GOS_STATIC gos_result_t gos_shellHelpHandler    (char_t* params);
+GOS_STATIC gos_result_t gos_shellModeHandler    (char_t* params);
+GOS_STATIC gos_result_t gos_shellResetHandler   (char_t* params);
+GOS_STATIC gos_result_t gos_shellResumeHandler  (char_t* params);
+GOS_STATIC gos_result_t gos_shellResumeTidHandler  (char_t* params);
+GOS_STATIC gos_result_t gos_shellRuntimeHandler (char_t* params);
+GOS_STATIC gos_result_t gos_shellSuspendHandler (char_t* params);
+GOS_STATIC gos_result_t gos_shellSuspendTidHandler (char_t* params);
+GOS_STATIC gos_result_t gos_shellUnblockHandler (char_t* params);
+GOS_STATIC gos_result_t gos_shellUnblockTidHandler (char_t* params);
+GOS_STATIC gos_result_t gos_shellTraceCommandHandler (char_t* params);
+GOS_STATIC gos_result_t gos_shellTraceLevelHandler   (char_t* params);
+GOS_STATIC gos_result_t gos_shellTraceListHandler    (char_t* params);
 
 /**
  * Shell daemon task descriptor.
@@ -139,15 +264,45 @@ GOS_STATIC gos_taskDescriptor_t shellDaemonTaskDesc =
 };
 
 /**
- * Shell info command.
+ * Shell sub-commands (sorted by name).
+ */
+GOS_STATIC GOS_CONST gos_shellSubCommand_t shellSubCommands [] =
+{
+    { "cpu",         gos_shellCpuHandler        },
+    { "delete",      gos_shellDeleteHandler     },
+    { "delete_tid",  gos_shellDeleteTidHandler  },
+    { "dump",        gos_shellDumpHandler       },
+    { "help",        gos_shellHelpHandler       },
+    { "mode",        gos_shellModeHandler       },
+    { "reset",       gos_shellResetHandler      },
+    { "resume",      gos_shellResumeHandler     },
+    { "resume_tid",  gos_shellResumeTidHandler  },
+    { "runtime",     gos_shellRuntimeHandler    },
+    { "suspend",     gos_shellSuspendHandler    },
+    { "suspend_tid", gos_shellSuspendTidHandler },
+    { "unblock",     gos_shellUnblockHandler    },
+    { "unblock_tid", gos_shellUnblockTidHandler }
+};
+
+/**
+ * Trace sub-commands (sorted by name).
  */
-GOS_STATIC gos_shellCommand_t shellCommand =
+GOS_STATIC GOS_CONST gos_shellSubCommand_t traceSubCommands [] =
 {
-    .command        = "shell",
-    .commandHandler = gos_shellCommandHandler,
-    .commandHandlerPrivileges = GOS_TASK_PRIVILEGE_KERNEL
+    { "level",       gos_shellTraceLevelHandler },
+    { "list",        gos_shellTraceListHandler  }
 };
 
+/**
+ * Shell info command.
+ */
+GOS_SHELL_COMMAND("shell", gos_shellCommandHandler, GOS_TASK_PRIVILEGE_KERNEL);
+
+/**
+ * Trace level command.
+ */
+GOS_SHELL_COMMAND("trace", gos_shellTraceCommandHandler, GOS_TASK_PRIVILEGE_KERNEL);
+
 /*
  * Function: gos_shellInit
  */
@@ -156,23 +311,39 @@ gos_result_t gos_shellInit (void_t)
     /*
      * Local variables.
      */
-    gos_result_t            shellInitResult = GOS_ERROR;
-    gos_shellCommandIndex_t index           = 0u;
+    gos_result_t                  shellInitResult = GOS_SUCCESS;
+    gos_shellCommandIndex_t       index           = 0u;
+    GOS_CONST gos_shellCommand_t* pCommand        = NULL;
 
     /*
      * Function code.
      */
-    useEcho = GOS_TRUE;
+    useEcho    = GOS_TRUE;
+    outputMode = GOS_SHELL_OUTPUT_HUMAN;
 
     for (index = 0u; index < CFG_SHELL_MAX_COMMAND_NUMBER; index++)
     {
         shellCommands[index].commandHandler = NULL;
     }
 
-    if (gos_taskRegister(&shellDaemonTaskDesc, &shellDaemonTaskId) == GOS_SUCCESS &&
-        gos_shellRegisterCommand(&shellCommand) == GOS_SUCCESS)
+    (void_t) memset((void_t*)commandLookupTable, 0, sizeof(commandLookupTable));
+
+    // Add the commands registered at link time to the lookup table.
+    for (pCommand = __gos_shell_cmd_start; pCommand < __gos_shell_cmd_end; pCommand++)
+    {
+        if (gos_shellLookupInsert(pCommand) != GOS_SUCCESS)
+        {
+            shellInitResult = GOS_ERROR;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    if (gos_taskRegister(&shellDaemonTaskDesc, &shellDaemonTaskId) != GOS_SUCCESS)
     {
-        shellInitResult = GOS_SUCCESS;
+        shellInitResult = GOS_ERROR;
     }
     else
     {
@@ -252,8 +423,19 @@ gos_result_t gos_shellRegisterCommand (gos_shellCommand_t* command)
             {
                 shellCommands[index].commandHandler = command->commandHandler;
                 shellCommands[index].commandHandlerPrivileges = command->commandHandlerPrivileges;
-                (void_t) strcpy(shellCommands[index].command, command->command);
-                shellRegisterCommandResult = GOS_SUCCESS;
+                (void_t) strncpy(shellCommands[index].command, command->command, CFG_SHELL_MAX_COMMAND_LENGTH - 1);
+                shellCommands[index].command[CFG_SHELL_MAX_COMMAND_LENGTH - 1] = '\0';
+
+                // Slot is only kept if the name is not registered yet.
+                if (gos_shellLookupInsert(&shellCommands[index]) == GOS_SUCCESS)
+                {
+                    shellRegisterCommandResult = GOS_SUCCESS;
+                }
+                else
+                {
+                    shellCommands[index].commandHandler = NULL;
+                    shellCommands[index].command[0]     = '\0';
+                }
                 break;
             }
             else
@@ -265,6 +447,80 @@ gos_result_t gos_shellRegisterCommand (gos_shellCommand_t* command)
     return shellRegisterCommandResult;
 }
 
+/*
+ * Function: gos_shellSubCommandDispatch
+ */
+gos_result_t gos_shellSubCommandDispatch (
+        GOS_CONST gos_shellSubCommand_t* pTable,
+        u16_t                            tableSize,
+        char_t*                          params
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t dispatchResult = GOS_ERROR;
+    u16_t        paramIndex     = 0u;
+    u16_t        lowIndex       = 0u;
+    u16_t        highIndex      = tableSize;
+    u16_t        midIndex       = 0u;
+    s32_t        compareResult  = 0;
+
+    /*
+     * Function code.
+     */
+    if (pTable != NULL && params != NULL)
+    {
+        // Split the sub-command name.
+        while (params[paramIndex] != ' ' && params[paramIndex] != '\0')
+        {
+            paramIndex++;
+        }
+
+        if (params[paramIndex] == ' ')
+        {
+            params[paramIndex++] = '\0';
+        }
+        else
+        {
+            // No parameters.
+        }
+
+        while (lowIndex < highIndex)
+        {
+            midIndex      = lowIndex + ((highIndex - lowIndex) >> 1u);
+            compareResult = strcmp(params, pTable[midIndex].name);
+
+            if (compareResult == 0)
+            {
+                if (pTable[midIndex].handler != NULL)
+                {
+                    dispatchResult = pTable[midIndex].handler(&params[paramIndex]);
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+                break;
+            }
+            else if (compareResult < 0)
+            {
+                highIndex = midIndex;
+            }
+            else
+            {
+                lowIndex = midIndex + 1u;
+            }
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return dispatchResult;
+}
+
 /*
  * Function: gos_shellSuspend
  */
@@ -337,13 +593,48 @@ gos_result_t gos_shellEchoOff (void_t)
     return shellEchoOffResult;
 }
 
+/*
+ * Function: gos_shellSetOutputMode
+ */
+gos_result_t gos_shellSetOutputMode (gos_shellOutputMode_t mode)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t setOutputModeResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (mode == GOS_SHELL_OUTPUT_HUMAN || mode == GOS_SHELL_OUTPUT_MACHINE)
+    {
+        outputMode          = mode;
+        setOutputModeResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Invalid mode.
+    }
+
+    return setOutputModeResult;
+}
+
+/*
+ * Function: gos_shellGetOutputMode
+ */
+gos_shellOutputMode_t gos_shellGetOutputMode (void_t)
+{
+    /*
+     * Function code.
+     */
+    return outputMode;
+}
+
 /**
  * @brief   Shell daemon task.
- * @details Receives a character from the log serial line, if the echoing is on, then
- *          sends the same character back. When an enter key is received, it processes
- *          the command typed in, and loops through the command array. When the command
- *          is found, it calls the command handler function with the parameter list as
- *          a string.
+ * @details Blocks until characters arrive on the shell serial line and processes every
+ *          received character per wake-up. If the buffered receive driver is not
+ *          registered, it falls back to polling single characters.
  *
  * @return    -
  */
@@ -352,9 +643,9 @@ GOS_STATIC void_t gos_shellDaemonTask (void_t)
     /*
      * Local variables.
      */
-    gos_shellCommandIndex_t index              = 0u;
-    u16_t                   actualCommandIndex = 0u;
-    u16_t                   paramIndex         = 0u;
+    char_t rxBuffer [GOS_SHELL_RX_CHUNK_SIZE];
+    u16_t  rxSize  = 0u;
+    u16_t  rxIndex = 0u;
 
     /*
      * Function code.
@@ -364,326 +655,947 @@ GOS_STATIC void_t gos_shellDaemonTask (void_t)
 
     for (;;)
     {
-        if (gos_shellDriverReceiveChar(&commandBuffer[commandBufferIndex]) == GOS_SUCCESS)
+        if (gos_shellDriverReceiveBuffer(rxBuffer, GOS_SHELL_RX_CHUNK_SIZE, &rxSize) == GOS_SUCCESS)
         {
-            if (useEcho == GOS_TRUE)
+            for (rxIndex = 0u; rxIndex < rxSize; rxIndex++)
             {
-                (void_t) gos_shellDriverTransmitString(&commandBuffer[commandBufferIndex]);
-            }
-            else
-            {
-                // Nothing to do.
+                gos_shellProcessChar(rxBuffer[rxIndex]);
             }
 
-            /*
-             * Backspace character check
-             */
-            if (commandBuffer[commandBufferIndex] == '\177')
-            {
-                commandBuffer[commandBufferIndex] = '\0';
-                commandBufferIndex--;
-            }
-            /*
-             * Enter character check
-             */
-            else if (commandBuffer[commandBufferIndex] == '\r')
+            gos_shellEchoFlush();
+        }
+        else
+        {
+            // Buffered reception is not available, poll.
+            if (gos_shellDriverReceiveChar(&rxBuffer[0]) == GOS_SUCCESS)
             {
-                if (useEcho == GOS_TRUE)
-                {
-                    (void_t) gos_shellDriverTransmitString("\n");
-                }
-                else
-                {
-                    // Nothing to do.
-                }
-
-                commandBuffer[commandBufferIndex] = '\0';
-                actualCommandIndex = 0u;
-                paramIndex = 0u;
-
-                // Get command.
-                while (commandBuffer[actualCommandIndex] != ' ' && commandBuffer[actualCommandIndex] != '\0')
-                {
-                    actualCommand[actualCommandIndex] = commandBuffer[actualCommandIndex];
-                    actualCommandIndex++;
-                }
-                actualCommand[actualCommandIndex] = '\0';
-                actualCommandIndex++;
-
-                // Get parameters.
-                while (commandBuffer[actualCommandIndex] != '\0')
-                {
-                    commandParams[paramIndex++] = commandBuffer[actualCommandIndex++];
-                }
-                commandParams[paramIndex] = '\0';
-
-                for (index = 0u; index < CFG_SHELL_MAX_COMMAND_NUMBER; index++)
-                {
-                    if (strcmp(shellCommands[index].command, actualCommand) == 0)
-                    {
-                        if (shellCommands[index].commandHandler != NULL)
-                        {
-                            (void_t) gos_taskSetPrivileges(shellDaemonTaskId, shellCommands[index].commandHandlerPrivileges);
-                            shellCommands[index].commandHandler(commandParams);
-                            (void_t) gos_taskSetPrivileges(shellDaemonTaskId, GOS_TASK_PRIVILEGE_KERNEL);
-                        }
-                        else
-                        {
-                            // Nothing to do.
-                        }
-                        break;
-                    }
-                    else
-                    {
-                        // Nothing to do.
-                    }
-                }
-
-                // If command not found.
-                if (index == CFG_SHELL_MAX_COMMAND_NUMBER)
-                {
-                    (void_t) gos_shellDriverTransmitString("Unrecognized command!\r\n");
-                }
-                else
-                {
-                    // Nothing to do.
-                }
-
-                (void_t) memset((void_t*)commandBuffer, '\0', CFG_SHELL_COMMAND_BUFFER_SIZE);
-                commandBufferIndex = 0u;
-
-                (void_t) gos_shellDriverTransmitString(GOS_SHELL_DISPLAY_TEXT);
+                gos_shellProcessChar(rxBuffer[0]);
+                gos_shellEchoFlush();
             }
             else
             {
-                commandBufferIndex++;
-
-                if (commandBufferIndex >= CFG_SHELL_COMMAND_BUFFER_SIZE)
-                {
-                    (void_t) memset((void_t*)commandBuffer, '\0', CFG_SHELL_COMMAND_BUFFER_SIZE);
-                    commandBufferIndex = 0u;
-                }
-                else
-                {
-                    // Nothing to do.
-                }
+                // Nothing to do.
             }
+
+            (void_t) gos_taskSleep(GOS_SHELL_DAEMON_POLL_TIME_MS);
         }
-        (void_t) gos_taskSleep(GOS_SHELL_DAEMON_POLL_TIME_MS);
     }
 }
 
 /**
- * @brief   Shell command handler.
- * @details Handles the built-in shell command.
+ * @brief   Processes a received character.
+ * @details Handles line editing (backspace), collects the echo, and executes the
+ *          command when a line terminator is received. A CR LF pair counts as one
+ *          line terminator.
+ *
+ * @param[in] character Received character.
  *
  * @return    -
  */
-GOS_STATIC void_t gos_shellCommandHandler (char_t* params)
+GOS_STATIC void_t gos_shellProcessChar (char_t character)
 {
-    /*
-     * Local variables.
-     */
-    u8_t                    index        = 0u;
-    gos_shellCommandIndex_t commandIndex = 0u;
-    gos_tid_t               taskId       = GOS_INVALID_TASK_ID;
-    gos_runtime_t           totalRunTime = {0};
-
     /*
      * Function code.
      */
-    if (strcmp(params, "dump") == 0)
+    if (character == '\n' && previousChar == '\r')
     {
-        gos_Dump();
+        // Second half of CR LF, already processed.
     }
-    else if (strcmp(params, "reset") == 0)
+    /*
+     * Backspace character check
+     */
+    else if (character == '\177' || character == '\b')
     {
-        gos_kernelReset();
+        if (commandBufferIndex > 0u)
+        {
+            gos_shellEchoAppend(character);
+            commandBufferIndex--;
+            commandBuffer[commandBufferIndex] = '\0';
+        }
+        else
+        {
+            // Nothing to delete.
+        }
     }
-    else if (strcmp(params, "help") == 0)
+    /*
+     * Enter character check
+     */
+    else if (character == '\r' || character == '\n')
     {
-        (void_t) gos_shellDriverTransmitString("List of registered shell commands: \r\n");
-        for (commandIndex = 0u; commandIndex < CFG_SHELL_MAX_COMMAND_NUMBER; commandIndex++)
+        gos_shellEchoAppend('\r');
+        gos_shellEchoAppend('\n');
+        gos_shellEchoFlush();
+
+        commandBuffer[commandBufferIndex] = '\0';
+        gos_shellExecuteLine();
+
+        (void_t) memset((void_t*)commandBuffer, '\0', CFG_SHELL_COMMAND_BUFFER_SIZE);
+        commandBufferIndex = 0u;
+
+        if (outputMode == GOS_SHELL_OUTPUT_HUMAN)
         {
-            if (strcmp(shellCommands[commandIndex].command, "") == 0)
-            {
-                break;
-            }
-            else if (strcmp(shellCommands[commandIndex].command, "shell") == 0)
-            {
-                (void_t) gos_shellDriverTransmitString("\t"
-                        "- shell\r\n\t\t"
-                        "- dump\r\n\t\t"
-                        "- reset\r\n\t\t"
-                        "- delete_tid\r\n\t\t"
-                        "- suspend_tid\r\n\t\t"
-                        "- resume_tid\r\n\t\t"
-                        "- unblock_tid\r\n\t\t"
-                        "- delete\r\n\t\t"
-                        "- suspend\r\n\t\t"
-                        "- resume\r\n\t\t"
-                        "- unblock\r\n\t\t"
-                        "- runtime\r\n\t\t"
-                        "- cpu\r\n");
-            }
-            else
-            {
-                (void_t) gos_shellDriverTransmitString("\t- %s\r\n", shellCommands[commandIndex].command);
-            }
+            (void_t) gos_shellDriverTransmitString(GOS_SHELL_DISPLAY_TEXT);
+        }
+        else
+        {
+            // No prompt in machine mode.
         }
     }
     else
     {
-        while (params[index] != ' ' && params[index])
+        gos_shellEchoAppend(character);
+        commandBuffer[commandBufferIndex++] = character;
+
+        if (commandBufferIndex >= CFG_SHELL_COMMAND_BUFFER_SIZE)
+        {
+            (void_t) memset((void_t*)commandBuffer, '\0', CFG_SHELL_COMMAND_BUFFER_SIZE);
+            commandBufferIndex = 0u;
+        }
+        else
         {
-            index++;
+            // Nothing to do.
         }
+    }
+
+    previousChar = character;
+}
+
+/**
+ * @brief   Executes the command line in the command buffer.
+ * @details Splits the line at ';' characters and executes the commands back-to-back.
+ *          Empty commands are skipped.
+ *
+ * @return    -
+ */
+GOS_STATIC void_t gos_shellExecuteLine (void_t)
+{
+    /*
+     * Local variables.
+     */
+    char_t* pCommandLine = commandBuffer;
+    char_t* pSeparator   = NULL;
 
-        params[index] = '\0';
+    /*
+     * Function code.
+     */
+    while (pCommandLine != NULL)
+    {
+        pSeparator = strchr(pCommandLine, ';');
 
-        if (strcmp(params, "delete_tid") == 0)
+        if (pSeparator != NULL)
+        {
+            *pSeparator = '\0';
+        }
+        else
         {
-            taskId = (gos_tid_t)strtol(&params[++index], NULL, 16);
+            // Last command.
+        }
 
-            if (gos_taskDelete(taskId) == GOS_SUCCESS)
-            {
-                (void_t) gos_shellDriverTransmitString("0x%X task has been deleted.\r\n", taskId);
-            }
-            else
-            {
-                (void_t) gos_shellDriverTransmitString("0x%X task could not be deleted.\r\n", taskId);
-            }
+        // Skip leading spaces.
+        while (*pCommandLine == ' ')
+        {
+            pCommandLine++;
         }
-        else if (strcmp(params, "delete") == 0)
+
+        if (*pCommandLine != '\0')
         {
-            if (gos_taskGetId(&params[++index], &taskId) == GOS_SUCCESS)
-            {
-                if (gos_taskDelete(taskId) == GOS_SUCCESS)
-                {
-                    (void_t) gos_shellDriverTransmitString("%s has been deleted.\r\n", &params[index]);
-                }
-                else
-                {
-                    (void_t) gos_shellDriverTransmitString("%s could not be deleted.\r\n", &params[index]);
-                }
-            }
-            else
-            {
-                (void_t) gos_shellDriverTransmitString("Task could not be found.\r\n");
-            }
+            gos_shellExecuteCommand(pCommandLine);
         }
-        else if (strcmp(params, "suspend_tid") == 0)
+        else
         {
-            taskId = (gos_tid_t)strtol(&params[++index], NULL, 16);
+            // Empty command.
+        }
 
-            if (gos_taskSuspend(taskId) == GOS_SUCCESS)
-            {
-                (void_t) gos_shellDriverTransmitString("0x%X task has been suspended.\r\n", taskId);
-            }
-            else
-            {
-                (void_t) gos_shellDriverTransmitString("0x%X task could not be suspended.\r\n", taskId);
-            }
+        pCommandLine = (pSeparator != NULL) ? (pSeparator + 1) : NULL;
+    }
+}
+
+/**
+ * @brief   Executes the given command.
+ * @details Splits the command line to command and parameters, and looks up the command
+ *          in the lookup table. When the command is found, it calls the command handler
+ *          function with the parameter list as a string. In machine output mode every
+ *          command is closed by an OK line if the handler succeeded, or an ERR line if
+ *          the command is unknown or the handler failed.
+ *
+ * @param[in] pCommandLine Command line (command and parameters).
+ *
+ * @return    -
+ */
+GOS_STATIC void_t gos_shellExecuteCommand (char_t* pCommandLine)
+{
+    /*
+     * Local variables.
+     */
+    GOS_CONST gos_shellCommand_t* pCommand     = NULL;
+    gos_result_t            commandResult      = GOS_ERROR;
+    u16_t                   actualCommandIndex = 0u;
+    u16_t                   paramIndex         = 0u;
+
+    /*
+     * Function code.
+     */
+    // Get command.
+    while (pCommandLine[actualCommandIndex] != ' ' && pCommandLine[actualCommandIndex] != '\0' &&
+           actualCommandIndex < (CFG_SHELL_MAX_COMMAND_LENGTH - 1))
+    {
+        actualCommand[actualCommandIndex] = pCommandLine[actualCommandIndex];
+        actualCommandIndex++;
+    }
+    actualCommand[actualCommandIndex] = '\0';
+
+    // Skip the separator (if any).
+    if (pCommandLine[actualCommandIndex] == ' ')
+    {
+        actualCommandIndex++;
+    }
+    else
+    {
+        // No parameters.
+    }
+
+    // Get parameters.
+    while (pCommandLine[actualCommandIndex] != '\0' && paramIndex < (CFG_SHELL_MAX_PARAMS_LENGTH - 1))
+    {
+        commandParams[paramIndex++] = pCommandLine[actualCommandIndex++];
+    }
+    commandParams[paramIndex] = '\0';
+
+    pCommand = gos_shellLookup(actualCommand);
+
+    if (pCommand != NULL)
+    {
+        (void_t) gos_taskSetPrivileges(shellDaemonTaskId, pCommand->commandHandlerPrivileges);
+        commandResult = pCommand->commandHandler(commandParams);
+        (void_t) gos_taskSetPrivileges(shellDaemonTaskId, GOS_TASK_PRIVILEGE_KERNEL);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    if (outputMode == GOS_SHELL_OUTPUT_MACHINE)
+    {
+        (void_t) gos_shellDriverTransmitString((commandResult == GOS_SUCCESS) ? "OK\r\n" : "ERR\r\n");
+    }
+    // If command not found.
+    else if (pCommand == NULL)
+    {
+        (void_t) gos_shellDriverTransmitString("Unrecognized command!\r\n");
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/**
+ * @brief   Transmits the task data in machine-readable form.
+ * @details Sends a CSV header line and one line per task (CPU values in [% x 100]).
+ *
+ * @return    -
+ */
+GOS_STATIC void_t gos_shellMachineDump (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u16_t taskIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_shellDriverTransmitString("#task,tid,name,prio,privileges,cpu,cpu_max,state\r\n");
+
+    for (taskIndex = 0u; taskIndex < CFG_TASK_MAX_NUMBER; taskIndex++)
+    {
+        if (gos_taskGetDataByIndex(taskIndex, &dumpTaskData) == GOS_SUCCESS)
+        {
+            (void_t) gos_shellDriverTransmitString("task,0x%04X,%s,%u,0x%04X,%u,%u,%u\r\n",
+                    dumpTaskData.taskId,
+                    dumpTaskData.taskName,
+                    dumpTaskData.taskPriority,
+                    (u16_t)dumpTaskData.taskPrivilegeLevel,
+                    dumpTaskData.taskCpuUsage,
+                    dumpTaskData.taskCpuUsageMax,
+                    dumpTaskData.taskState
+                    );
         }
-        else if (strcmp(params, "suspend") == 0)
+        else
         {
-            if (gos_taskGetId(&params[++index], &taskId) == GOS_SUCCESS)
-            {
-                if (gos_taskSuspend(taskId) == GOS_SUCCESS)
-                {
-                    (void_t) gos_shellDriverTransmitString("%s has been suspended.\r\n", &params[index]);
-                }
-                else
-                {
-                    (void_t) gos_shellDriverTransmitString("%s could not be suspended.\r\n", &params[index]);
-                }
-            }
-            else
-            {
-                (void_t) gos_shellDriverTransmitString("Task could not be found.\r\n");
-            }
+            break;
         }
-        else if (strcmp(params, "resume_tid") == 0)
+    }
+}
+
+/**
+ * @brief   Appends a character to the echo buffer.
+ * @details If echoing is on, the character is collected and sent back in one
+ *          transmission by #gos_shellEchoFlush.
+ *
+ * @param[in] character Character to echo.
+ *
+ * @return    -
+ */
+GOS_STATIC void_t gos_shellEchoAppend (char_t character)
+{
+    /*
+     * Function code.
+     */
+    if (useEcho == GOS_TRUE && outputMode == GOS_SHELL_OUTPUT_HUMAN)
+    {
+        if (echoLength >= GOS_SHELL_ECHO_BUFFER_SIZE - 1u)
+        {
+            gos_shellEchoFlush();
+        }
+        else
         {
-            taskId = (gos_tid_t)strtol(&params[++index], NULL, 16);
+            // Nothing to do.
+        }
 
-            if (gos_taskResume(taskId) == GOS_SUCCESS)
-            {
-                (void_t) gos_shellDriverTransmitString("0x%X task has been resumed.\r\n", taskId);
-            }
-            else
-            {
-                (void_t) gos_shellDriverTransmitString("0x%X task could not be resumed.\r\n", taskId);
-            }
+        echoBuffer[echoLength++] = character;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/**
+ * @brief   Sends the collected echo characters.
+ * @details Transmits the echo buffer (if not empty) and empties it.
+ *
+ * @return    -
+ */
+GOS_STATIC void_t gos_shellEchoFlush (void_t)
+{
+    /*
+     * Function code.
+     */
+    if (echoLength > 0u)
+    {
+        echoBuffer[echoLength] = '\0';
+        (void_t) gos_shellDriverTransmitString("%s", echoBuffer);
+        echoLength = 0u;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/**
+ * @brief   Calculates the hash of a command name.
+ * @details Calculates the 32-bit FNV-1a hash of the given string.
+ *
+ * @param[in] pName Command name.
+ *
+ * @return    Hash value.
+ */
+GOS_STATIC u32_t gos_shellHash (GOS_CONST char_t* pName)
+{
+    /*
+     * Local variables.
+     */
+    u32_t hash = GOS_SHELL_HASH_OFFSET;
+
+    /*
+     * Function code.
+     */
+    while (*pName != '\0')
+    {
+        hash ^= (u8_t)*pName++;
+        hash *= GOS_SHELL_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief   Adds a command to the lookup table.
+ * @details Stores the command pointer in the first free slot from its hash position.
+ *
+ * @param[in] pCommand Pointer to the command to add.
+ *
+ * @return    Result of insertion.
+ *
+ * @retval    #GOS_SUCCESS Command added.
+ * @retval    #GOS_ERROR   Command name already registered or lookup table is full.
+ */
+GOS_STATIC gos_result_t gos_shellLookupInsert (GOS_CONST gos_shellCommand_t* pCommand)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t insertResult = GOS_ERROR;
+    u32_t        slot         = gos_shellHash(pCommand->command) & GOS_SHELL_HASH_MASK;
+    u16_t        probeCount   = 0u;
+
+    /*
+     * Function code.
+     */
+    for (probeCount = 0u; probeCount < CFG_SHELL_COMMAND_HASH_SIZE; probeCount++)
+    {
+        if (commandLookupTable[slot] == NULL)
+        {
+            commandLookupTable[slot] = pCommand;
+            insertResult             = GOS_SUCCESS;
+            break;
         }
-        else if (strcmp(params, "resume") == 0)
+        else if (strcmp(commandLookupTable[slot]->command, pCommand->command) == 0)
         {
-            if (gos_taskGetId(&params[++index], &taskId) == GOS_SUCCESS)
-            {
-                if (gos_taskResume(taskId) == GOS_SUCCESS)
-                {
-                    (void_t) gos_shellDriverTransmitString("%s has been resumed.\r\n", &params[index]);
-                }
-                else
-                {
-                    (void_t) gos_shellDriverTransmitString("%s could not be resumed.\r\n", &params[index]);
-                }
-            }
-            else
-            {
-                (void_t) gos_shellDriverTransmitString("Task could not be found.\r\n");
-            }
+            // Duplicate name.
+            break;
         }
-        else if (strcmp(params, "unblock_tid") == 0)
+        else
         {
-            taskId = (gos_tid_t)strtol(&params[++index], NULL, 16);
+            slot = (slot + 1u) & GOS_SHELL_HASH_MASK;
+        }
+    }
 
-            if (gos_taskUnblock(taskId) == GOS_SUCCESS)
-            {
-                (void_t) gos_shellDriverTransmitString("0x%X task has been unblocked.\r\n", taskId);
-            }
-            else
-            {
-                (void_t) gos_shellDriverTransmitString("0x%X task could not be unblocked.\r\n", taskId);
-            }
+    return insertResult;
+}
+
+/**
+ * @brief   Looks up a command by name.
+ * @details Probes the lookup table from the hash position of the name until the
+ *          command or an empty slot is found.
+ *
+ * @param[in] pName Command name.
+ *
+ * @return    Pointer to the command or NULL if not found.
+ */
+GOS_STATIC GOS_CONST gos_shellCommand_t* gos_shellLookup (GOS_CONST char_t* pName)
+{
+    /*
+     * Local variables.
+     */
+    GOS_CONST gos_shellCommand_t* pCommand   = NULL;
+    u32_t                         slot       = gos_shellHash(pName) & GOS_SHELL_HASH_MASK;
+    u16_t                         probeCount = 0u;
+
+    /*
+     * Function code.
+     */
+    for (probeCount = 0u; probeCount < CFG_SHELL_COMMAND_HASH_SIZE; probeCount++)
+    {
+        if (commandLookupTable[slot] == NULL)
+        {
+            break;
+        }
+        else if (strcmp(commandLookupTable[slot]->command, pName) == 0)
+        {
+            pCommand = commandLookupTable[slot];
+            break;
+        }
+        else
+        {
+            slot = (slot + 1u) & GOS_SHELL_HASH_MASK;
         }
-        else if (strcmp(params, "unblock") == 0)
+    }
+
+    return pCommand;
+}
+
+/**
+ * @brief   Executes a task action.
+ * @details Resolves the task by ID (hexadecimal) or by name, calls the action and
+ *          reports the result (in human output mode).
+ *
+ * @param[in] params     Task ID or task name.
+ * @param[in] useTaskId  Flag to indicate whether the parameter is a task ID.
+ * @param[in] action     Task action function.
+ * @param[in] actionName Name of the action for the report (past tense).
+ *
+ * @return    Result of the task action.
+ *
+ * @retval    #GOS_SUCCESS Action executed successfully.
+ * @retval    #GOS_ERROR   Task not found or action failed.
+ */
+GOS_STATIC gos_result_t gos_shellTaskAction (char_t* params, bool_t useTaskId, gos_result_t (*action)(gos_tid_t), char_t* actionName)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t actionResult = GOS_ERROR;
+    gos_tid_t    taskId       = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    if (useTaskId == GOS_TRUE)
+    {
+        taskId       = (gos_tid_t)strtol(params, NULL, 16);
+        actionResult = action(taskId);
+
+        if (actionResult == GOS_SUCCESS)
+        {
+            GOS_SHELL_HUMAN_PRINT("0x%X task has been %s.\r\n", taskId, actionName);
+        }
+        else
+        {
+            GOS_SHELL_HUMAN_PRINT("0x%X task could not be %s.\r\n", taskId, actionName);
+        }
+    }
+    else if (gos_taskGetId(params, &taskId) == GOS_SUCCESS)
+    {
+        actionResult = action(taskId);
+
+        if (actionResult == GOS_SUCCESS)
+        {
+            GOS_SHELL_HUMAN_PRINT("%s has been %s.\r\n", params, actionName);
+        }
+        else
+        {
+            GOS_SHELL_HUMAN_PRINT("%s could not be %s.\r\n", params, actionName);
+        }
+    }
+    else
+    {
+        GOS_SHELL_HUMAN_PRINT("Task could not be found.\r\n");
+    }
+
+    return actionResult;
+}
+
+/**
+ * @brief   Shell command handler.
+ * @details Dispatches the built-in shell sub-commands.
+ *
+ * @return    Result of the sub-command.
+ */
+GOS_STATIC gos_result_t gos_shellCommandHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    return gos_shellSubCommandDispatch(shellSubCommands, sizeof(shellSubCommands) / sizeof(shellSubCommands[0]), params);
+}
+
+/**
+ * @brief   Shell cpu sub-command handler.
+ * @details Sends the CPU usage.
+ *
+ * @return    #GOS_SUCCESS
+ */
+GOS_STATIC gos_result_t gos_shellCpuHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    if (outputMode == GOS_SHELL_OUTPUT_MACHINE)
+    {
+        (void_t) gos_shellDriverTransmitString("cpu,%u\r\n", gos_kernelGetCpuUsage());
+    }
+    else
+    {
+        (void_t) gos_shellDriverTransmitString("CPU usage: %u.%02u%%\r\n", (gos_kernelGetCpuUsage() / 100), (gos_kernelGetCpuUsage() % 100));
+    }
+
+    return GOS_SUCCESS;
+}
+
+/**
+ * @brief   Shell delete sub-command handler.
+ * @details Deletes the task with the given name.
+ *
+ * @return    Result of task deletion.
+ */
+GOS_STATIC gos_result_t gos_shellDeleteHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    return gos_shellTaskAction(params, GOS_FALSE, gos_taskDelete, "deleted");
+}
+
+/**
+ * @brief   Shell delete_tid sub-command handler.
+ * @details Deletes the task with the given ID.
+ *
+ * @return    Result of task deletion.
+ */
+GOS_STATIC gos_result_t gos_shellDeleteTidHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    return gos_shellTaskAction(params, GOS_TRUE, gos_taskDelete, "deleted");
+}
+
+/**
+ * @brief   Shell dump sub-command handler.
+ * @details Dumps the system data (or the task table in machine output mode).
+ *
+ * @return    #GOS_SUCCESS
+ */
+GOS_STATIC gos_result_t gos_shellDumpHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    if (outputMode == GOS_SHELL_OUTPUT_MACHINE)
+    {
+        gos_shellMachineDump();
+    }
+    else
+    {
+        gos_Dump();
+    }
+
+    return GOS_SUCCESS;
+}
+
+/**
+ * @brief   Shell help sub-command handler.
+ * @details Lists the registered commands and the shell sub-commands (one
+ *          command per line in machine output mode).
+ *
+ * @return    #GOS_SUCCESS
+ */
+GOS_STATIC gos_result_t gos_shellHelpHandler (char_t* params)
+{
+    /*
+     * Local variables.
+     */
+    gos_shellCommandIndex_t       commandIndex = 0u;
+    u16_t                         subIndex     = 0u;
+    GOS_CONST gos_shellCommand_t* pCommand     = NULL;
+    bool_t                        machineMode  = (outputMode == GOS_SHELL_OUTPUT_MACHINE) ? GOS_TRUE : GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    GOS_SHELL_HUMAN_PRINT("List of registered shell commands: \r\n");
+
+    for (pCommand = __gos_shell_cmd_start; pCommand < __gos_shell_cmd_end; pCommand++)
+    {
+        (void_t) gos_shellDriverTransmitString(machineMode == GOS_TRUE ? "command,%s\r\n" : "\t- %s\r\n", pCommand->command);
+
+        if (pCommand->commandHandler == gos_shellCommandHandler)
         {
-            if (gos_taskGetId(&params[++index], &taskId) == GOS_SUCCESS)
+            for (subIndex = 0u; subIndex < sizeof(shellSubCommands) / sizeof(shellSubCommands[0]); subIndex++)
             {
-                if (gos_taskUnblock(taskId) == GOS_SUCCESS)
+                if (machineMode == GOS_TRUE)
                 {
-                    (void_t) gos_shellDriverTransmitString("%s has been unblocked.\r\n", &params[index]);
+                    (void_t) gos_shellDriverTransmitString("command,%s %s\r\n", pCommand->command, shellSubCommands[subIndex].name);
                 }
                 else
                 {
-                    (void_t) gos_shellDriverTransmitString("%s could not be unblocked.\r\n", &params[index]);
+                    (void_t) gos_shellDriverTransmitString("\t\t- %s\r\n", shellSubCommands[subIndex].name);
                 }
             }
-            else
-            {
-                (void_t) gos_shellDriverTransmitString("Task could not be found.\r\n");
-            }
         }
-        else if (strcmp(params, "cpu") == 0)
+        else
         {
-            (void_t) gos_shellDriverTransmitString("CPU usage: %u.%02u%%\r\n", (gos_kernelGetCpuUsage() / 100), (gos_kernelGetCpuUsage() % 100));
+            // Nothing to do.
         }
-        else if (strcmp(params, "runtime") == 0)
-        {
-            (void_t) gos_runTimeGet(&totalRunTime);
+    }
 
-            (void_t) gos_shellDriverTransmitString(
-                    "System runtime: %d days %d hours %d minutes %d seconds\r\n",
-                    totalRunTime.days,
-                    totalRunTime.hours,
-                    totalRunTime.minutes,
-                    totalRunTime.seconds
-                    );
+    for (commandIndex = 0u; commandIndex < CFG_SHELL_MAX_COMMAND_NUMBER; commandIndex++)
+    {
+        if (shellCommands[commandIndex].commandHandler != NULL)
+        {
+            (void_t) gos_shellDriverTransmitString(machineMode == GOS_TRUE ? "command,%s\r\n" : "\t- %s\r\n", shellCommands[commandIndex].command);
         }
         else
         {
             // Nothing to do.
         }
     }
+
+    return GOS_SUCCESS;
+}
+
+/**
+ * @brief   Shell mode sub-command handler.
+ * @details Sets the output mode (human or machine).
+ *
+ * @return    Result of setting the output mode.
+ *
+ * @retval    #GOS_SUCCESS Output mode set.
+ * @retval    #GOS_ERROR   Unknown output mode.
+ */
+GOS_STATIC gos_result_t gos_shellModeHandler (char_t* params)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t modeResult = GOS_SUCCESS;
+
+    /*
+     * Function code.
+     */
+    if (strcmp(params, "machine") == 0)
+    {
+        outputMode = GOS_SHELL_OUTPUT_MACHINE;
+    }
+    else if (strcmp(params, "human") == 0)
+    {
+        outputMode = GOS_SHELL_OUTPUT_HUMAN;
+    }
+    else
+    {
+        GOS_SHELL_HUMAN_PRINT("Unknown output mode.\r\n");
+        modeResult = GOS_ERROR;
+    }
+
+    return modeResult;
+}
+
+/**
+ * @brief   Shell reset sub-command handler.
+ * @details Resets the system.
+ *
+ * @return    #GOS_SUCCESS
+ */
+GOS_STATIC gos_result_t gos_shellResetHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    gos_kernelReset();
+
+    return GOS_SUCCESS;
+}
+
+/**
+ * @brief   Shell resume sub-command handler.
+ * @details Resumes the task with the given name.
+ *
+ * @return    Result of task resumption.
+ */
+GOS_STATIC gos_result_t gos_shellResumeHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    return gos_shellTaskAction(params, GOS_FALSE, gos_taskResume, "resumed");
+}
+
+/**
+ * @brief   Shell resume_tid sub-command handler.
+ * @details Resumes the task with the given ID.
+ *
+ * @return    Result of task resumption.
+ */
+GOS_STATIC gos_result_t gos_shellResumeTidHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    return gos_shellTaskAction(params, GOS_TRUE, gos_taskResume, "resumed");
+}
+
+/**
+ * @brief   Shell runtime sub-command handler.
+ * @details Sends the system runtime.
+ *
+ * @return    Result of getting the runtime.
+ */
+GOS_STATIC gos_result_t gos_shellRuntimeHandler (char_t* params)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t  runtimeResult = GOS_ERROR;
+    gos_runtime_t totalRunTime  = {0};
+
+    /*
+     * Function code.
+     */
+    runtimeResult = gos_runTimeGet(&totalRunTime);
+
+    if (runtimeResult != GOS_SUCCESS)
+    {
+        // Nothing to send.
+    }
+    else if (outputMode == GOS_SHELL_OUTPUT_MACHINE)
+    {
+        (void_t) gos_shellDriverTransmitString("runtime,%u,%u,%u,%u,%u\r\n",
+                totalRunTime.days,
+                totalRunTime.hours,
+                totalRunTime.minutes,
+                totalRunTime.seconds,
+                totalRunTime.milliseconds
+                );
+    }
+    else
+    {
+        (void_t) gos_shellDriverTransmitString(
+                "System runtime: %d days %d hours %d minutes %d seconds\r\n",
+                totalRunTime.days,
+                totalRunTime.hours,
+                totalRunTime.minutes,
+                totalRunTime.seconds
+                );
+    }
+
+    return runtimeResult;
+}
+
+/**
+ * @brief   Shell suspend sub-command handler.
+ * @details Suspends the task with the given name.
+ *
+ * @return    Result of task suspension.
+ */
+GOS_STATIC gos_result_t gos_shellSuspendHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    return gos_shellTaskAction(params, GOS_FALSE, gos_taskSuspend, "suspended");
+}
+
+/**
+ * @brief   Shell suspend_tid sub-command handler.
+ * @details Suspends the task with the given ID.
+ *
+ * @return    Result of task suspension.
+ */
+GOS_STATIC gos_result_t gos_shellSuspendTidHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    return gos_shellTaskAction(params, GOS_TRUE, gos_taskSuspend, "suspended");
+}
+
+/**
+ * @brief   Shell unblock sub-command handler.
+ * @details Unblocks the task with the given name.
+ *
+ * @return    Result of task unblocking.
+ */
+GOS_STATIC gos_result_t gos_shellUnblockHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    return gos_shellTaskAction(params, GOS_FALSE, gos_taskUnblock, "unblocked");
+}
+
+/**
+ * @brief   Shell unblock_tid sub-command handler.
+ * @details Unblocks the task with the given ID.
+ *
+ * @return    Result of task unblocking.
+ */
+GOS_STATIC gos_result_t gos_shellUnblockTidHandler (char_t* params)
+{
+    /*
+     * Function code.
+     */
+    return gos_shellTaskAction(params, GOS_TRUE, gos_taskUnblock, "unblocked");
+}
+
+/**
+ * @brief   Trace command handler.
+ * @details Lists the trace channels (trace list) or sets the level of a channel
+ *          (trace level <channel|all> <level>).
+ *
+ * @return    Result of the sub-command.
+ */
+GOS_STATIC gos_result_t gos_shellTraceCommandHandler (char_t* params)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t traceResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    traceResult = gos_shellSubCommandDispatch(traceSubCommands, sizeof(traceSubCommands) / sizeof(traceSubCommands[0]), params);
+
+    if (traceResult != GOS_SUCCESS)
+    {
+        GOS_SHELL_HUMAN_PRINT("Usage: trace list | trace level <channel|all> <0-4>\r\n");
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return traceResult;
+}
+
+/**
+ * @brief   Trace level sub-command handler.
+ * @details Sets the level of the given channel (or all channels).
+ *
+ * @return    Result of setting the level.
+ *
+ * @retval    #GOS_SUCCESS Level set.
+ * @retval    #GOS_ERROR   Missing level or unknown channel.
+ */
+GOS_STATIC gos_result_t gos_shellTraceLevelHandler (char_t* params)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t     levelResult = GOS_ERROR;
+    u8_t             levelIndex  = 0u;
+    gos_traceLevel_t level       = GOS_TRACE_LEVEL_OFF;
+
+    /*
+     * Function code.
+     */
+    // Separate channel name and level.
+    while (params[levelIndex] != ' ' && params[levelIndex])
+    {
+        levelIndex++;
+    }
+
+    if (params[levelIndex] == ' ')
+    {
+        params[levelIndex] = '\0';
+        level              = (gos_traceLevel_t)strtol(&params[++levelIndex], NULL, 10);
+        levelResult        = gos_traceChannelSetLevel(params, level);
+
+        if (levelResult == GOS_SUCCESS)
+        {
+            GOS_SHELL_HUMAN_PRINT("Trace level of %s set to %u.\r\n", params, level);
+        }
+        else
+        {
+            GOS_SHELL_HUMAN_PRINT("Trace level of %s could not be set.\r\n", params);
+        }
+    }
+    else
+    {
+        // Missing level, usage is sent by the trace command.
+    }
+
+    return levelResult;
+}
+
+/**
+ * @brief   Trace list sub-command handler.
+ * @details Lists the trace channels and their levels.
+ *
+ * @return    #GOS_SUCCESS
+ */
+GOS_STATIC gos_result_t gos_shellTraceListHandler (char_t* params)
+{
+    /*
+     * Local variables.
+     */
+    u8_t                index    = 0u;
+    gos_traceChannel_t* pChannel = NULL;
+
+    /*
+     * Function code.
+     */
+    GOS_SHELL_HUMAN_PRINT("Trace channels (level ceiling: %u):\r\n", CFG_TRACE_LEVEL_CEILING);
+
+    while (gos_traceChannelGet(index++, &pChannel) == GOS_SUCCESS)
+    {
+        (void_t) gos_shellDriverTransmitString(
+                outputMode == GOS_SHELL_OUTPUT_MACHINE ? "trace,%s,%u\r\n" : "\t- %s: %u\r\n",
+                pChannel->name, pChannel->level);
+    }
+
+    return GOS_SUCCESS;
 }
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_signal.c
 //! @author     Ahmed Gazar
-//! @date       2025-04-06
-//! @version    1.10
+//! @date       2026-10-19
+//! @version    1.15
 //!
 //! @brief      GOS signal service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_signal.h
@@ -39,6 +39,20 @@
 //                                          -    GOS_SIGNAL_DAEMON_POLL_TIME_MS removed
 // 1.9        2025-03-28    Ahmed Gazar     +    GOS_SIGNAL_DAEMON_POLL_TIME_MS added back
 // 1.10       2025-04-06    Ahmed Gazar     *    Initializer result logic inverted
+// 1.11       2026-10-19    Ahmed Gazar     +    Invoke queue added (invocations are not merged,
+//                                               each one keeps its sender ID)
+//                                          +    gos_signalGetQueueStatistics added
+//                                          -    GOS_SIGNAL_DAEMON_POLL_TIME_MS removed
+// 1.12       2026-10-19    Ahmed Gazar     +    Handler dispatch modes added (inline, subscriber
+//                                               task, priority-aware worker pool)
+//                                          +    Handler execution time statistics added
+//                                          +    gos_signalSubscribeDispatch added
+//                                          +    gos_signalProcessPending added
+//                                          +    gos_signalGetHandlerStatistics added
+//                                          *    Daemon privilege switching only on change
+// 1.13       2026-10-19    Ahmed Gazar     *    Handler run-time measured with the monotonic clock
+// 1.14       2026-10-19    Ahmed Gazar     +    Per-handler sender filter mask added
+// 1.15       2026-10-19    Ahmed Gazar     *    Worker task IDs registered through a local variable
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -64,30 +78,45 @@
  */
 #include <gos_signal.h>
 #include <gos_error.h>
+#include <gos_time.h>
 #include <gos_trigger.h>
 #include <string.h>
 
 /*
  * Macros
  */
-/**
- * Signal daemon poll time [ms].
- */
-#define GOS_SIGNAL_DAEMON_POLL_TIME_MS ( 50u )
+#if CFG_SIGNAL_WORKER_NUMBER > 10
+#error "gos_signal.c: CFG_SIGNAL_WORKER_NUMBER shall not exceed 10."
+#endif
 
 /*
  * Type definitions
  */
+/**
+ * Signal handler descriptor type.
+ */
+typedef struct
+{
+    gos_signalHandler_t           handler;                                         //!< Signal handler.
+    gos_taskPrivilegeLevel_t      privileges;                                      //!< Signal handler privileges.
+    gos_signalDispatchMode_t      dispatchMode;                                    //!< Dispatch mode.
+    gos_taskPrio_t                workerPriority;                                  //!< Worker priority (worker mode).
+    gos_tid_t                     ownerTaskId;                                     //!< Owner task ID (task mode).
+    gos_trigger_t*                pNotifyTrigger;                                  //!< Owner notify trigger (task mode).
+    u32_t                         senderMask;                                      //!< Accepted sender IDs (0 for all).
+    gos_signalSenderId_t          pendingArray [CFG_SIGNAL_HANDLER_QUEUE_LENGTH];  //!< Pending sender IDs (task mode).
+    u8_t                          pendingHead;                                     //!< Index of the oldest pending call.
+    u8_t                          pendingNumber;                                   //!< Number of pending calls.
+    gos_signalHandlerStatistics_t statistics;                                      //!< Handler statistics.
+}gos_signalHandlerDescriptor_t;
+
 /**
  * Signal descriptor type.
  */
 typedef struct
 {
-    bool_t                   inUse;                                         //!< Flag to indicate whether the signal is in use.
-    gos_signalHandler_t      handlers         [CFG_SIGNAL_MAX_SUBSCRIBERS]; //!< Signal handler array.
-    gos_taskPrivilegeLevel_t handlerPrvileges [CFG_SIGNAL_MAX_SUBSCRIBERS]; //!< Signal handler privileges array.
-    bool_t                   invokeRequired;                                //!< Invoke required flag.
-    gos_signalSenderId_t     senderId;                                      //!< Sender ID.
+    bool_t                        inUse;                                          //!< Flag to indicate whether the signal is in use.
+    gos_signalHandlerDescriptor_t handlers [CFG_SIGNAL_MAX_SUBSCRIBERS];          //!< Signal handler array.
 }gos_signalDescriptor_t;
 
 /**
@@ -99,6 +128,31 @@ typedef struct
     gos_signalSenderId_t     senderId;                                      //!< Sender ID.
 }gos_signalInvokeDescriptor;
 
+#if CFG_SIGNAL_WORKER_NUMBER > 0
+/**
+ * Signal worker job type.
+ */
+typedef struct
+{
+    bool_t                   inUse;                                         //!< Job slot in use flag.
+    gos_signalId_t           signalId;                                      //!< Signal ID.
+    gos_signalHandlerIndex_t handlerIndex;                                  //!< Signal handler index.
+    gos_signalSenderId_t     senderId;                                      //!< Sender ID.
+    gos_taskPrio_t           priority;                                      //!< Execution priority.
+    u32_t                    sequence;                                      //!< Sequence number (FIFO on equal priority).
+}gos_signalWorkerJob_t;
+
+/**
+ * Signal worker descriptor type.
+ */
+typedef struct
+{
+    gos_taskDescriptor_t     taskDescriptor;                                //!< Worker task descriptor.
+    gos_trigger_t            trigger;                                       //!< Worker wake-up trigger.
+    bool_t                   idle;                                          //!< Worker idle flag.
+}gos_signalWorkerDescriptor_t;
+#endif
+
 /*
  * Static variables
  */
@@ -107,6 +161,31 @@ typedef struct
  */
 GOS_STATIC gos_signalDescriptor_t signalArray [CFG_SIGNAL_MAX_NUMBER];
 
+/**
+ * Signal invoke queue (ring buffer).
+ */
+GOS_STATIC gos_signalInvokeDescriptor invokeQueue [CFG_SIGNAL_INVOKE_QUEUE_LENGTH];
+
+/**
+ * Index of the oldest invocation in the invoke queue.
+ */
+GOS_STATIC u16_t                  invokeQueueHead;
+
+/**
+ * Number of invocations in the invoke queue.
+ */
+GOS_STATIC u16_t                  invokeQueueUsage;
+
+/**
+ * Maximum number of invocations in the invoke queue.
+ */
+GOS_STATIC u16_t                  invokeQueueMaxUsage;
+
+/**
+ * Number of invocations lost because of full invoke queue.
+ */
+GOS_STATIC u32_t                  invokeQueueOverflowCounter;
+
 /**
  * Invoke trigger (to count the number of signal invokings).
  */
@@ -117,6 +196,23 @@ GOS_STATIC gos_trigger_t          signalInvokeTrigger;
  */
 GOS_STATIC gos_taskDescriptor_t   callerTaskDesc = {0};
 
+#if CFG_SIGNAL_WORKER_NUMBER > 0
+/**
+ * Signal worker job array.
+ */
+GOS_STATIC gos_signalWorkerJob_t        workerJobArray [CFG_SIGNAL_WORKER_QUEUE_LENGTH];
+
+/**
+ * Signal worker array.
+ */
+GOS_STATIC gos_signalWorkerDescriptor_t workerArray [CFG_SIGNAL_WORKER_NUMBER];
+
+/**
+ * Next worker job sequence number.
+ */
+GOS_STATIC u32_t                        nextWorkerJobSequence;
+#endif
+
 /*
  * External variables
  */
@@ -126,7 +222,14 @@ GOS_EXTERN gos_signalId_t kernelDumpReadySignal;
 /*
  * Function prototypes
  */
-GOS_STATIC void_t gos_signalDaemonTask (void_t);
+GOS_STATIC void_t gos_signalDaemonTask     (void_t);
+GOS_STATIC void_t gos_signalCallHandler    (gos_signalHandlerDescriptor_t* pHandler, gos_signalSenderId_t senderId);
+GOS_STATIC void_t gos_signalPostToTask     (gos_signalHandlerDescriptor_t* pHandler, gos_signalSenderId_t senderId);
+
+#if CFG_SIGNAL_WORKER_NUMBER > 0
+GOS_STATIC void_t gos_signalWorkerTask     (void_t);
+GOS_STATIC void_t gos_signalPostToWorker   (gos_signalId_t signalId, gos_signalHandlerIndex_t handlerIndex, gos_signalSenderId_t senderId);
+#endif
 
 /**
  * Signal daemon task descriptor.
@@ -150,6 +253,11 @@ gos_result_t gos_signalInit (void_t)
      */
     gos_result_t      signalInitResult = GOS_ERROR;
     gos_signalIndex_t signalIndex      = 0u;
+#if CFG_SIGNAL_WORKER_NUMBER > 0
+    u8_t              workerIndex      = 0u;
+    u8_t              nameLength       = 0u;
+    gos_tid_t         workerTaskId     = GOS_INVALID_TASK_ID;
+#endif
 
     /*
      * Function code.
@@ -160,6 +268,11 @@ gos_result_t gos_signalInit (void_t)
         signalArray[signalIndex].inUse = GOS_FALSE;
     }
 
+    invokeQueueHead            = 0u;
+    invokeQueueUsage           = 0u;
+    invokeQueueMaxUsage        = 0u;
+    invokeQueueOverflowCounter = 0u;
+
     // Register signal daemon and create kernel task delete signal.
     if (gos_taskRegister(&signalDaemonTaskDescriptor, NULL) == GOS_SUCCESS &&
         gos_signalCreate(&kernelTaskDeleteSignal)           == GOS_SUCCESS &&
@@ -174,6 +287,36 @@ gos_result_t gos_signalInit (void_t)
         // Nothing to do.
     }
 
+#if CFG_SIGNAL_WORKER_NUMBER > 0
+    (void_t) memset((void_t*)workerJobArray, 0, sizeof(workerJobArray));
+    nextWorkerJobSequence = 0u;
+
+    // Register worker tasks.
+    for (workerIndex = 0u; workerIndex < CFG_SIGNAL_WORKER_NUMBER && signalInitResult == GOS_SUCCESS; workerIndex++)
+    {
+        (void_t) strcpy(workerArray[workerIndex].taskDescriptor.taskName, "gos_signal_worker_0");
+        nameLength = (u8_t)strlen(workerArray[workerIndex].taskDescriptor.taskName);
+
+        workerArray[workerIndex].taskDescriptor.taskName[nameLength - 1u] = (char_t)('0' + workerIndex);
+        workerArray[workerIndex].taskDescriptor.taskFunction              = gos_signalWorkerTask;
+        workerArray[workerIndex].taskDescriptor.taskStackSize             = CFG_TASK_SIGNAL_WORKER_STACK;
+        workerArray[workerIndex].taskDescriptor.taskPriority              = CFG_TASK_SIGNAL_WORKER_PRIO;
+        workerArray[workerIndex].taskDescriptor.taskPrivilegeLevel        = GOS_TASK_PRIVILEGE_KERNEL;
+        workerArray[workerIndex].idle                                     = GOS_TRUE;
+
+        if (gos_triggerInit(&workerArray[workerIndex].trigger)                        != GOS_SUCCESS ||
+            gos_taskRegister(&workerArray[workerIndex].taskDescriptor, &workerTaskId) != GOS_SUCCESS
+        )
+        {
+            signalInitResult = GOS_ERROR;
+        }
+        else
+        {
+            workerArray[workerIndex].taskDescriptor.taskId = workerTaskId;
+        }
+    }
+#endif
+
     return signalInitResult;
 }
 
@@ -196,10 +339,9 @@ gos_result_t gos_signalCreate (gos_signalId_t* pSignal)
     {
         if (signalArray[signalIndex].inUse == GOS_FALSE && pSignal != NULL)
         {
-            *pSignal                                = signalIndex;
-            signalArray[signalIndex].inUse          = GOS_TRUE;
-            signalArray[signalIndex].invokeRequired = GOS_FALSE;
-            signalCreateResult                      = GOS_SUCCESS;
+            *pSignal                       = signalIndex;
+            signalArray[signalIndex].inUse = GOS_TRUE;
+            signalCreateResult             = GOS_SUCCESS;
             break;
         }
         else
@@ -219,25 +361,80 @@ gos_result_t gos_signalSubscribe (
         gos_signalHandler_t      signalHandler,
         gos_taskPrivilegeLevel_t signalHandlerPrivileges
         )
+{
+    /*
+     * Function code.
+     */
+    return gos_signalSubscribeDispatch(signalId, signalHandler, signalHandlerPrivileges, NULL);
+}
+
+/*
+ * Function: gos_signalSubscribeDispatch
+ */
+gos_result_t gos_signalSubscribeDispatch (
+        gos_signalId_t              signalId,
+        gos_signalHandler_t         signalHandler,
+        gos_taskPrivilegeLevel_t    signalHandlerPrivileges,
+        gos_signalDispatchConfig_t* pDispatchConfig
+        )
 {
     /*
      * Local variables.
      */
-    gos_result_t             signalSubscribeResult = GOS_ERROR;
-    gos_signalHandlerIndex_t signalHandlerIndex    = 0u;
+    gos_result_t                   signalSubscribeResult = GOS_ERROR;
+    gos_signalHandlerIndex_t       signalHandlerIndex    = 0u;
+    gos_signalHandlerDescriptor_t* pHandler              = NULL;
+    gos_signalDispatchMode_t       dispatchMode          = GOS_SIGNAL_DISPATCH_INLINE;
+    gos_tid_t                      ownerTaskId           = GOS_INVALID_TASK_ID;
 
     /*
      * Function code.
      */
-    if (signalId < CFG_SIGNAL_MAX_NUMBER && signalArray[signalId].inUse == GOS_TRUE && signalHandler != NULL)
+    if (pDispatchConfig != NULL)
+    {
+        dispatchMode = pDispatchConfig->dispatchMode;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    if (signalId < CFG_SIGNAL_MAX_NUMBER && signalArray[signalId].inUse == GOS_TRUE && signalHandler != NULL &&
+        (dispatchMode == GOS_SIGNAL_DISPATCH_INLINE ||
+        (dispatchMode == GOS_SIGNAL_DISPATCH_TASK && gos_taskGetCurrentId(&ownerTaskId) == GOS_SUCCESS) ||
+        (dispatchMode == GOS_SIGNAL_DISPATCH_WORKER && CFG_SIGNAL_WORKER_NUMBER > 0))
+        )
     {
         for (signalHandlerIndex = 0u; signalHandlerIndex < CFG_SIGNAL_MAX_SUBSCRIBERS; signalHandlerIndex++)
         {
-            if (signalArray[signalId].handlers[signalHandlerIndex] == NULL)
+            pHandler = &signalArray[signalId].handlers[signalHandlerIndex];
+
+            if (pHandler->handler == NULL)
             {
-                signalArray[signalId].handlers[signalHandlerIndex]         = signalHandler;
-                signalArray[signalId].handlerPrvileges[signalHandlerIndex] = signalHandlerPrivileges;
-                signalSubscribeResult                                      = GOS_SUCCESS;
+                // Fill the descriptor first, the handler pointer makes the slot valid.
+                (void_t) memset((void_t*)&pHandler->statistics, 0, sizeof(pHandler->statistics));
+                pHandler->privileges     = signalHandlerPrivileges;
+                pHandler->dispatchMode   = dispatchMode;
+                pHandler->ownerTaskId    = ownerTaskId;
+                pHandler->pendingHead    = 0u;
+                pHandler->pendingNumber  = 0u;
+                pHandler->workerPriority = CFG_TASK_SIGNAL_WORKER_PRIO;
+                pHandler->pNotifyTrigger = NULL;
+                pHandler->senderMask     = 0u;
+
+                if (pDispatchConfig != NULL)
+                {
+                    pHandler->workerPriority = pDispatchConfig->workerPriority;
+                    pHandler->pNotifyTrigger = pDispatchConfig->pNotifyTrigger;
+                    pHandler->senderMask     = pDispatchConfig->senderMask;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                pHandler->handler     = signalHandler;
+                signalSubscribeResult = GOS_SUCCESS;
                 break;
             }
             else
@@ -276,13 +473,43 @@ GOS_INLINE gos_result_t gos_signalInvoke (gos_signalId_t signalId, gos_signalSen
             (callerTaskDesc.taskPrivilegeLevel & GOS_PRIV_SIGNALING) == GOS_PRIV_SIGNALING))
             )
         {
-            signalArray[signalId].senderId       = senderId;
-            signalArray[signalId].invokeRequired = GOS_TRUE;
-            signalInvokeResult                   = GOS_SUCCESS;
+            // Place invocation in the queue.
+            GOS_ATOMIC_ENTER
+
+            if (invokeQueueUsage < CFG_SIGNAL_INVOKE_QUEUE_LENGTH)
+            {
+                invokeQueue[(invokeQueueHead + invokeQueueUsage) % CFG_SIGNAL_INVOKE_QUEUE_LENGTH].signalId = signalId;
+                invokeQueue[(invokeQueueHead + invokeQueueUsage) % CFG_SIGNAL_INVOKE_QUEUE_LENGTH].senderId = senderId;
+                invokeQueueUsage++;
 
-            // Unblock signal daemon to handle signal invoking by
-            // incrementing the invoke trigger.
-            (void_t) gos_triggerIncrement(&signalInvokeTrigger);
+                if (invokeQueueUsage > invokeQueueMaxUsage)
+                {
+                    invokeQueueMaxUsage = invokeQueueUsage;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                signalInvokeResult = GOS_SUCCESS;
+            }
+            else
+            {
+                invokeQueueOverflowCounter++;
+            }
+
+            GOS_ATOMIC_EXIT
+
+            if (signalInvokeResult == GOS_SUCCESS)
+            {
+                // Unblock signal daemon to handle signal invoking by
+                // incrementing the invoke trigger.
+                (void_t) gos_triggerIncrement(&signalInvokeTrigger);
+            }
+            else
+            {
+                // Nothing to do.
+            }
         }
         else
         {
@@ -299,9 +526,172 @@ GOS_INLINE gos_result_t gos_signalInvoke (gos_signalId_t signalId, gos_signalSen
     return signalInvokeResult;
 }
 
+/*
+ * Function: gos_signalGetQueueStatistics
+ */
+gos_result_t gos_signalGetQueueStatistics (gos_signalQueueStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getStatisticsResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+
+        pStatistics->queueLength     = CFG_SIGNAL_INVOKE_QUEUE_LENGTH;
+        pStatistics->queueUsage      = invokeQueueUsage;
+        pStatistics->queueMaxUsage   = invokeQueueMaxUsage;
+        pStatistics->overflowCounter = invokeQueueOverflowCounter;
+
+        GOS_ATOMIC_EXIT
+
+        getStatisticsResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
+/*
+ * Function: gos_signalProcessPending
+ */
+gos_result_t gos_signalProcessPending (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t                   processResult      = GOS_ERROR;
+    gos_tid_t                      callerTaskId       = GOS_INVALID_TASK_ID;
+    gos_signalIndex_t              signalIndex        = 0u;
+    gos_signalHandlerIndex_t       signalHandlerIndex = 0u;
+    gos_signalHandlerDescriptor_t* pHandler           = NULL;
+    gos_signalSenderId_t           senderId           = 0u;
+    bool_t                         callPending        = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    if (gos_taskGetCurrentId(&callerTaskId) == GOS_SUCCESS)
+    {
+        for (signalIndex = 0u; signalIndex < CFG_SIGNAL_MAX_NUMBER; signalIndex++)
+        {
+            for (signalHandlerIndex = 0u; signalHandlerIndex < CFG_SIGNAL_MAX_SUBSCRIBERS; signalHandlerIndex++)
+            {
+                pHandler = &signalArray[signalIndex].handlers[signalHandlerIndex];
+
+                if (pHandler->handler == NULL)
+                {
+                    // Last handler checked.
+                    break;
+                }
+                else if (pHandler->dispatchMode == GOS_SIGNAL_DISPATCH_TASK && pHandler->ownerTaskId == callerTaskId)
+                {
+                    do
+                    {
+                        GOS_ATOMIC_ENTER
+
+                        if (pHandler->pendingNumber > 0u)
+                        {
+                            senderId              = pHandler->pendingArray[pHandler->pendingHead];
+                            pHandler->pendingHead = (pHandler->pendingHead + 1u) % CFG_SIGNAL_HANDLER_QUEUE_LENGTH;
+                            pHandler->pendingNumber--;
+                            callPending           = GOS_TRUE;
+                        }
+                        else
+                        {
+                            callPending = GOS_FALSE;
+                        }
+
+                        GOS_ATOMIC_EXIT
+
+                        if (callPending == GOS_TRUE)
+                        {
+                            // Call the handler in the context of the owner task.
+                            gos_signalCallHandler(pHandler, senderId);
+                            processResult = GOS_SUCCESS;
+                        }
+                        else
+                        {
+                            // Nothing to do.
+                        }
+                    }
+                    while (callPending == GOS_TRUE);
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return processResult;
+}
+
+/*
+ * Function: gos_signalGetHandlerStatistics
+ */
+gos_result_t gos_signalGetHandlerStatistics (
+        gos_signalId_t                 signalId,
+        gos_signalHandler_t            signalHandler,
+        gos_signalHandlerStatistics_t* pStatistics
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t             getStatisticsResult = GOS_ERROR;
+    gos_signalHandlerIndex_t signalHandlerIndex  = 0u;
+
+    /*
+     * Function code.
+     */
+    if (signalId < CFG_SIGNAL_MAX_NUMBER && signalArray[signalId].inUse == GOS_TRUE &&
+        signalHandler != NULL && pStatistics != NULL)
+    {
+        for (signalHandlerIndex = 0u; signalHandlerIndex < CFG_SIGNAL_MAX_SUBSCRIBERS; signalHandlerIndex++)
+        {
+            if (signalArray[signalId].handlers[signalHandlerIndex].handler == signalHandler)
+            {
+                GOS_ATOMIC_ENTER
+                (void_t) memcpy((void_t*)pStatistics, (void_t*)&signalArray[signalId].handlers[signalHandlerIndex].statistics,
+                        sizeof(*pStatistics));
+                GOS_ATOMIC_EXIT
+
+                getStatisticsResult = GOS_SUCCESS;
+                break;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getStatisticsResult;
+}
+
 /**
  * @brief   Signal daemon task.
- * @details Polls the signal invoke queue, and completes the necessary signal invokings.
+ * @details Waits for signal invokings, and processes the invoke queue in invocation
+ *          order until it gets empty. Inline handlers are called directly, task and
+ *          worker mode handlers are posted to their executor.
  *
  * @return -
  */
@@ -310,56 +700,390 @@ GOS_STATIC void_t gos_signalDaemonTask (void_t)
     /*
      * Local variables.
      */
-    gos_signalHandlerIndex_t signalHandlerIndex = 0u;
-    gos_signalIndex_t        signalIndex        = 0u;
+    gos_signalHandlerIndex_t       signalHandlerIndex = 0u;
+    gos_signalInvokeDescriptor     invocation         = {0};
+    bool_t                         invocationValid    = GOS_FALSE;
+    gos_signalHandlerDescriptor_t* pHandler           = NULL;
+    gos_taskPrivilegeLevel_t       currentPrivileges  = GOS_TASK_PRIVILEGE_KERNEL;
 
     /*
      * Function code.
      */
     for (;;)
     {
-        // Wait for trigger.
-        if (gos_triggerWait(&signalInvokeTrigger, 1u, GOS_TRIGGER_ENDLESS_TMO) == GOS_SUCCESS)
+        // Wait for trigger. The trigger is reset before processing the queue, so
+        // invocations placed during processing either get processed in this round
+        // or re-trigger the daemon.
+        (void_t) gos_triggerWait(&signalInvokeTrigger, 1u, GOS_TRIGGER_ENDLESS_TMO);
+        (void_t) gos_triggerReset(&signalInvokeTrigger);
+
+        do
         {
-            (void_t) gos_triggerReset(&signalInvokeTrigger);
-            for (signalIndex = 0u; signalIndex < CFG_SIGNAL_MAX_NUMBER; signalIndex++)
+            // Get the oldest invocation.
+            GOS_ATOMIC_ENTER
+
+            if (invokeQueueUsage > 0u)
+            {
+                invocation      = invokeQueue[invokeQueueHead];
+                invokeQueueHead = (invokeQueueHead + 1u) % CFG_SIGNAL_INVOKE_QUEUE_LENGTH;
+                invokeQueueUsage--;
+                invocationValid = GOS_TRUE;
+            }
+            else
+            {
+                invocationValid = GOS_FALSE;
+            }
+
+            GOS_ATOMIC_EXIT
+
+            if (invocationValid == GOS_TRUE)
             {
-                if (signalArray[signalIndex].invokeRequired == GOS_TRUE)
+                for (signalHandlerIndex = 0u; signalHandlerIndex < CFG_SIGNAL_MAX_SUBSCRIBERS; signalHandlerIndex++)
                 {
-                    for (signalHandlerIndex = 0u; signalHandlerIndex < CFG_SIGNAL_MAX_SUBSCRIBERS; signalHandlerIndex++)
+                    pHandler = &signalArray[invocation.signalId].handlers[signalHandlerIndex];
+
+                    if (pHandler->handler == NULL)
+                    {
+                        // Last handler called, stop calling.
+                        break;
+                    }
+                    else if (pHandler->senderMask != 0u &&
+                            (invocation.senderId >= 32u || (pHandler->senderMask & GOS_SIGNAL_SENDER_MASK(invocation.senderId)) == 0u))
+                    {
+                        // Sender filtered out by the handler.
+                    }
+                    else if (pHandler->dispatchMode == GOS_SIGNAL_DISPATCH_TASK)
+                    {
+                        gos_signalPostToTask(pHandler, invocation.senderId);
+                    }
+#if CFG_SIGNAL_WORKER_NUMBER > 0
+                    else if (pHandler->dispatchMode == GOS_SIGNAL_DISPATCH_WORKER)
                     {
-                        if (signalArray[signalIndex].handlers[signalHandlerIndex] == NULL)
+                        gos_signalPostToWorker(invocation.signalId, signalHandlerIndex, invocation.senderId);
+                    }
+#endif
+                    else
+                    {
+                        // Switch to signal handler privilege (if different).
+                        if (pHandler->privileges != currentPrivileges)
                         {
-                            // Last handler called, stop calling.
-                            break;
+                            (void_t) gos_taskSetPrivileges(signalDaemonTaskDescriptor.taskId, pHandler->privileges);
+                            currentPrivileges = pHandler->privileges;
                         }
                         else
                         {
-                            // Switch to signal handler privilege.
-                            (void_t) gos_taskSetPrivileges(
-                                    signalDaemonTaskDescriptor.taskId,
-                                    signalArray[signalIndex].handlerPrvileges[signalHandlerIndex]
-                                    );
-                            // Call signal handler.
-                            signalArray[signalIndex].handlers[signalHandlerIndex](signalArray[signalIndex].senderId);
-
-                            // Switch back to kernel privilege.
-                            (void_t) gos_taskSetPrivileges(signalDaemonTaskDescriptor.taskId, GOS_TASK_PRIVILEGE_KERNEL);
+                            // Nothing to do.
                         }
+
+                        // Call signal handler.
+                        gos_signalCallHandler(pHandler, invocation.senderId);
                     }
-                    signalArray[signalIndex].invokeRequired = GOS_FALSE;
-                }
-                else
-                {
-                    // Nothing to do.
                 }
             }
+            else
+            {
+                // Queue empty.
+            }
+        }
+        while (invocationValid == GOS_TRUE);
+
+        // Switch back to kernel privilege.
+        if (currentPrivileges != GOS_TASK_PRIVILEGE_KERNEL)
+        {
+            (void_t) gos_taskSetPrivileges(signalDaemonTaskDescriptor.taskId, GOS_TASK_PRIVILEGE_KERNEL);
+            currentPrivileges = GOS_TASK_PRIVILEGE_KERNEL;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+}
+
+/**
+ * @brief   Calls the given signal handler and updates its statistics.
+ * @details Measures the execution time of the handler with the monotonic clock.
+ *
+ * @param[in] pHandler Pointer to the signal handler descriptor.
+ * @param[in] senderId Sender ID to pass to the handler.
+ *
+ * @return -
+ */
+GOS_STATIC void_t gos_signalCallHandler (gos_signalHandlerDescriptor_t* pHandler, gos_signalSenderId_t senderId)
+{
+    /*
+     * Local variables.
+     */
+    u64_t startTimeUs = 0u;
+    u32_t runTimeUs   = 0u;
+
+    /*
+     * Function code.
+     */
+    startTimeUs = gos_timeGetMonotonicUs();
+    pHandler->handler(senderId);
+    runTimeUs   = (u32_t)gos_timeGetElapsedUs(startTimeUs);
+
+    GOS_ATOMIC_ENTER
+
+    pHandler->statistics.callCounter++;
+    pHandler->statistics.lastRunTimeUs   = runTimeUs;
+    pHandler->statistics.totalRunTimeUs += runTimeUs;
+
+    if (runTimeUs > pHandler->statistics.maxRunTimeUs)
+    {
+        pHandler->statistics.maxRunTimeUs = runTimeUs;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    GOS_ATOMIC_EXIT
+}
+
+/**
+ * @brief   Posts a signal invocation to the owner task of the handler.
+ * @details Places the sender ID in the pending queue of the handler and increments
+ *          the notify trigger of the owner task (if any).
+ *
+ * @param[in] pHandler Pointer to the signal handler descriptor.
+ * @param[in] senderId Sender ID.
+ *
+ * @return -
+ */
+GOS_STATIC void_t gos_signalPostToTask (gos_signalHandlerDescriptor_t* pHandler, gos_signalSenderId_t senderId)
+{
+    /*
+     * Local variables.
+     */
+    bool_t posted = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+
+    if (pHandler->pendingNumber < CFG_SIGNAL_HANDLER_QUEUE_LENGTH)
+    {
+        pHandler->pendingArray[(pHandler->pendingHead + pHandler->pendingNumber) % CFG_SIGNAL_HANDLER_QUEUE_LENGTH] = senderId;
+        pHandler->pendingNumber++;
+        posted = GOS_TRUE;
+    }
+    else
+    {
+        pHandler->statistics.droppedCounter++;
+    }
+
+    GOS_ATOMIC_EXIT
+
+    if (posted == GOS_TRUE && pHandler->pNotifyTrigger != NULL)
+    {
+        (void_t) gos_triggerIncrement(pHandler->pNotifyTrigger);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+#if CFG_SIGNAL_WORKER_NUMBER > 0
+/**
+ * @brief   Posts a signal invocation to the worker pool.
+ * @details Places the job in a free job slot and wakes up an idle worker (if there
+ *          is none, a busy worker picks the job up before going idle).
+ *
+ * @param[in] signalId     Signal ID.
+ * @param[in] handlerIndex Signal handler index.
+ * @param[in] senderId     Sender ID.
+ *
+ * @return -
+ */
+GOS_STATIC void_t gos_signalPostToWorker (
+        gos_signalId_t           signalId,
+        gos_signalHandlerIndex_t handlerIndex,
+        gos_signalSenderId_t     senderId
+        )
+{
+    /*
+     * Local variables.
+     */
+    u8_t jobIndex    = 0u;
+    u8_t workerIndex = 0u;
+    u8_t wakeIndex   = CFG_SIGNAL_WORKER_NUMBER;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+
+    for (jobIndex = 0u; jobIndex < CFG_SIGNAL_WORKER_QUEUE_LENGTH; jobIndex++)
+    {
+        if (workerJobArray[jobIndex].inUse == GOS_FALSE)
+        {
+            workerJobArray[jobIndex].inUse        = GOS_TRUE;
+            workerJobArray[jobIndex].signalId     = signalId;
+            workerJobArray[jobIndex].handlerIndex = handlerIndex;
+            workerJobArray[jobIndex].senderId     = senderId;
+            workerJobArray[jobIndex].priority     = signalArray[signalId].handlers[handlerIndex].workerPriority;
+            workerJobArray[jobIndex].sequence     = nextWorkerJobSequence++;
+            break;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    if (jobIndex < CFG_SIGNAL_WORKER_QUEUE_LENGTH)
+    {
+        for (workerIndex = 0u; workerIndex < CFG_SIGNAL_WORKER_NUMBER; workerIndex++)
+        {
+            if (workerArray[workerIndex].idle == GOS_TRUE)
+            {
+                workerArray[workerIndex].idle = GOS_FALSE;
+                wakeIndex                     = workerIndex;
+                break;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+    }
+    else
+    {
+        signalArray[signalId].handlers[handlerIndex].statistics.droppedCounter++;
+    }
+
+    GOS_ATOMIC_EXIT
+
+    if (wakeIndex < CFG_SIGNAL_WORKER_NUMBER)
+    {
+        (void_t) gos_triggerIncrement(&workerArray[wakeIndex].trigger);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+}
+
+/**
+ * @brief   Signal worker task.
+ * @details Waits for wake-up, then executes the pending jobs in priority order (FIFO
+ *          on equal priority) at the priority declared by the subscriber, until the
+ *          job queue gets empty.
+ *
+ * @return -
+ */
+GOS_STATIC void_t gos_signalWorkerTask (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_tid_t                      ownTaskId   = GOS_INVALID_TASK_ID;
+    gos_signalWorkerDescriptor_t*  pWorker     = NULL;
+    gos_signalWorkerJob_t          job         = {0};
+    gos_signalHandlerDescriptor_t* pHandler    = NULL;
+    u8_t                           index       = 0u;
+    u8_t                           bestIndex   = 0u;
+    bool_t                         jobValid    = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_taskGetCurrentId(&ownTaskId);
+
+    for (index = 0u; index < CFG_SIGNAL_WORKER_NUMBER; index++)
+    {
+        if (workerArray[index].taskDescriptor.taskId == ownTaskId)
+        {
+            pWorker = &workerArray[index];
+            break;
         }
         else
         {
-            // Unexpected error.
+            // Nothing to do.
         }
+    }
+
+    for (;;)
+    {
+        if (pWorker == NULL)
+        {
+            // Unknown worker, should not happen.
+            (void_t) gos_taskSuspend(ownTaskId);
+        }
+        else
+        {
+            (void_t) gos_triggerWait(&pWorker->trigger, 1u, GOS_TRIGGER_ENDLESS_TMO);
+            (void_t) gos_triggerReset(&pWorker->trigger);
+
+            do
+            {
+                // Take the highest priority job.
+                GOS_ATOMIC_ENTER
+
+                jobValid = GOS_FALSE;
+
+                for (index = 0u; index < CFG_SIGNAL_WORKER_QUEUE_LENGTH; index++)
+                {
+                    if (workerJobArray[index].inUse == GOS_TRUE &&
+                        (jobValid == GOS_FALSE ||
+                        workerJobArray[index].priority < workerJobArray[bestIndex].priority ||
+                        (workerJobArray[index].priority == workerJobArray[bestIndex].priority &&
+                        (s32_t)(workerJobArray[index].sequence - workerJobArray[bestIndex].sequence) < 0)))
+                    {
+                        bestIndex = index;
+                        jobValid  = GOS_TRUE;
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+                }
+
+                if (jobValid == GOS_TRUE)
+                {
+                    job                             = workerJobArray[bestIndex];
+                    workerJobArray[bestIndex].inUse = GOS_FALSE;
+                }
+                else
+                {
+                    // Queue empty, go idle.
+                    pWorker->idle = GOS_TRUE;
+                }
+
+                GOS_ATOMIC_EXIT
+
+                if (jobValid == GOS_TRUE)
+                {
+                    pHandler = &signalArray[job.signalId].handlers[job.handlerIndex];
+
+                    // Run at the declared priority with the handler privileges.
+                    (void_t) gos_taskSetPriority(ownTaskId, job.priority);
 
-        (void_t) gos_taskSleep(GOS_SIGNAL_DAEMON_POLL_TIME_MS);
+                    if (pHandler->privileges != GOS_TASK_PRIVILEGE_KERNEL)
+                    {
+                        (void_t) gos_taskSetPrivileges(ownTaskId, pHandler->privileges);
+                        gos_signalCallHandler(pHandler, job.senderId);
+                        (void_t) gos_taskSetPrivileges(ownTaskId, GOS_TASK_PRIVILEGE_KERNEL);
+                    }
+                    else
+                    {
+                        gos_signalCallHandler(pHandler, job.senderId);
+                    }
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+            }
+            while (jobValid == GOS_TRUE);
+
+            // Restore idle priority.
+            (void_t) gos_taskSetPriority(ownTaskId, CFG_TASK_SIGNAL_WORKER_PRIO);
+        }
     }
 }
+#endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_time.c
 //! @author     Ahmed Gazar
-//! @date       2025-04-06
-//! @version    1.8
+//! @date       2026-10-19
+//! @version    1.11
 //!
 //! @brief      GOS time service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_time.h
@@ -40,6 +40,16 @@
 //                                               runtime as well)
 //                                          +    gos_timeAddMilliseconds added
 // 1.8        2025-04-06    Ahmed Gazar     *    Initializer result logic inverted
+// 1.9        2026-10-19    Ahmed Gazar     +    Monotonic microsecond clock added
+//                                          *    System tick only advances the monotonic clock,
+//                                               calendar time and run-time are derived lazily
+// 1.10       2026-10-19    Ahmed Gazar     -    TIME_SLEEP_TIME_MS removed
+//                                          *    Time daemon woken by the system tick at second
+//                                               boundaries, elapsed units collected at the carry
+//                                          +    gos_timeSubscribe added
+// 1.11       2026-10-19    Ahmed Gazar     *    Calendar catch-up computed arithmetically instead of
+//                                               stepping in the atomic section
+//                                          -    TIME_CALENDAR_STEP_MS removed
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -65,6 +75,8 @@
  */
 #include <gos_time.h>
 #include <gos_signal.h>
+#include <gos_timer_driver.h>
+#include <gos_trigger.h>
 #include <string.h>
 
 /*
@@ -85,16 +97,11 @@
  */
 #define TIME_DEFAULT_DAY      ( 1 )
 
-/**
- * Time task sleep time in [ms].
- */
-#define TIME_SLEEP_TIME_MS    ( 500u )
-
 /*
  * Static variables
  */
 /**
- * System time.
+ * System time (calendar), valid at the monotonic time stamp below.
  */
 GOS_STATIC gos_time_t systemTime =
 {
@@ -104,9 +111,34 @@ GOS_STATIC gos_time_t systemTime =
 };
 
 /**
- * System run-time.
+ * Monotonic time in [ms] at which the system time was last brought up to date.
+ */
+GOS_STATIC u64_t systemTimeStampMs;
+
+/**
+ * Monotonic clock: number of elapsed milliseconds since startup.
+ */
+GOS_STATIC u64_t monotonicMs;
+
+/**
+ * System timer value [us] sampled at the last monotonic clock increment.
+ */
+GOS_STATIC u16_t monotonicTimerValue;
+
+/**
+ * Monotonic time in [ms] of the next calendar second boundary.
+ */
+GOS_STATIC u64_t timeNextSecondMs = 1000u;
+
+/**
+ * Elapsed units not yet signaled (#GOS_TIME_UNIT_MASK).
  */
-GOS_STATIC gos_runtime_t systemRunTime;
+GOS_STATIC u32_t timePendingUnits;
+
+/**
+ * Time daemon wake-up trigger.
+ */
+GOS_STATIC gos_trigger_t timeTrigger;
 
 /**
  * Number of days in each month - lookup table.
@@ -140,7 +172,10 @@ gos_signalId_t timeSignalId;
 /*
  * Function prototypes
  */
-GOS_STATIC void_t gos_timeDaemonTask (void_t);
+GOS_STATIC void_t gos_timeDaemonTask      (void_t);
+GOS_STATIC void_t gos_timeCalendarUpdate  (void_t);
+GOS_STATIC void_t gos_timeCalendarAdd     (gos_time_t* pTime, u64_t milliseconds);
+GOS_STATIC u32_t  gos_timeGetElapsedUnits (gos_time_t* pPrevious, gos_time_t* pCurrent);
 
 /**
  * Time task descriptor.
@@ -167,7 +202,8 @@ gos_result_t gos_timeInit (void_t)
     /*
      * Function code.
      */
-    if (gos_signalCreate(&timeSignalId)                          == GOS_SUCCESS &&
+    if (gos_triggerInit(&timeTrigger)                            == GOS_SUCCESS &&
+        gos_signalCreate(&timeSignalId)                          == GOS_SUCCESS &&
         gos_taskRegister(&timeDaemonTaskDesc, &timeDaemonTaskId) == GOS_SUCCESS
         )
     {
@@ -196,7 +232,10 @@ gos_result_t gos_timeGet (gos_time_t* pTime)
      */
     if (pTime != NULL)
     {
+        GOS_ATOMIC_ENTER
+        gos_timeCalendarUpdate();
         (void_t) memcpy((void_t*)pTime, (GOS_CONST void_t*)&systemTime, sizeof(systemTime));
+        GOS_ATOMIC_EXIT
 
         timeGetResult = GOS_SUCCESS;
     }
@@ -223,7 +262,11 @@ gos_result_t gos_timeSet (gos_time_t* pTime)
      */
     if (pTime != NULL)
     {
+        GOS_ATOMIC_ENTER
         (void_t) memcpy((void_t*)&systemTime, (GOS_CONST void_t*)pTime, sizeof(*pTime));
+        systemTimeStampMs = monotonicMs;
+        timeNextSecondMs  = monotonicMs + (1000u - (systemTime.milliseconds % 1000u));
+        GOS_ATOMIC_EXIT
 
         timeSetResult = GOS_SUCCESS;
     }
@@ -244,13 +287,23 @@ gos_result_t gos_runTimeGet (gos_runtime_t* pRunTime)
      * Local variables.
      */
     gos_result_t runtimeGetResult = GOS_ERROR;
+    u64_t        runTimeUs        = 0u;
+    u32_t        runTimeSeconds   = 0u;
 
     /*
      * Function code.
      */
     if (pRunTime != NULL)
     {
-        (void_t) memcpy((void_t*)pRunTime, (void_t*)&systemRunTime, sizeof(systemRunTime));
+        runTimeUs      = gos_timeGetMonotonicUs();
+        runTimeSeconds = (u32_t)(runTimeUs / 1000000u);
+
+        pRunTime->microseconds = (gos_microsecond_t)(runTimeUs % 1000u);
+        pRunTime->milliseconds = (gos_millisecond_t)((runTimeUs / 1000u) % 1000u);
+        pRunTime->seconds      = (gos_second_t)(runTimeSeconds % 60u);
+        pRunTime->minutes      = (gos_minute_t)((runTimeSeconds / 60u) % 60u);
+        pRunTime->hours        = (gos_hour_t)((runTimeSeconds / 3600u) % 24u);
+        pRunTime->days         = (gos_day_t)(runTimeSeconds / 86400u);
 
         runtimeGetResult = GOS_SUCCESS;
     }
@@ -262,6 +315,116 @@ gos_result_t gos_runTimeGet (gos_runtime_t* pRunTime)
     return runtimeGetResult;
 }
 
+/*
+ * Function: gos_timeGetMonotonicUs
+ */
+u64_t gos_timeGetMonotonicUs (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u64_t milliseconds = 0u;
+    u16_t tickValue    = 0u;
+    u16_t timerValue   = 0u;
+    u16_t subTickUs    = 0u;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    milliseconds = monotonicMs;
+    tickValue    = monotonicTimerValue;
+    (void_t) gos_timerDriverSysTimerGet(&timerValue);
+    GOS_ATOMIC_EXIT
+
+    subTickUs = (u16_t)(timerValue - tickValue);
+
+    // A pending tick that has not been processed yet must not make
+    // the clock jump ahead of the next tick.
+    if (subTickUs > 999u)
+    {
+        subTickUs = 999u;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return (milliseconds * 1000u) + subTickUs;
+}
+
+/*
+ * Function: gos_timeGetMonotonicMs
+ */
+u64_t gos_timeGetMonotonicMs (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u64_t milliseconds = 0u;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+    milliseconds = monotonicMs;
+    GOS_ATOMIC_EXIT
+
+    return milliseconds;
+}
+
+/*
+ * Function: gos_timeGetElapsedUs
+ */
+u64_t gos_timeGetElapsedUs (u64_t startUs)
+{
+    /*
+     * Function code.
+     */
+    return gos_timeGetMonotonicUs() - startUs;
+}
+
+/*
+ * Function: gos_timeSubscribe
+ */
+gos_result_t gos_timeSubscribe (
+        u32_t                       unitMask,
+        gos_signalHandler_t         signalHandler,
+        gos_taskPrivilegeLevel_t    signalHandlerPrivileges,
+        gos_signalDispatchConfig_t* pDispatchConfig
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t               timeSubscribeResult = GOS_ERROR;
+    gos_signalDispatchConfig_t dispatchConfig      = {0};
+
+    /*
+     * Function code.
+     */
+    if (unitMask != 0u)
+    {
+        if (pDispatchConfig != NULL)
+        {
+            (void_t) memcpy((void_t*)&dispatchConfig, (void_t*)pDispatchConfig, sizeof(dispatchConfig));
+        }
+        else
+        {
+            dispatchConfig.dispatchMode = GOS_SIGNAL_DISPATCH_INLINE;
+        }
+
+        dispatchConfig.senderMask = unitMask;
+        timeSubscribeResult       = gos_signalSubscribeDispatch(timeSignalId, signalHandler, signalHandlerPrivileges, &dispatchConfig);
+    }
+    else
+    {
+        // No unit selected.
+    }
+
+    return timeSubscribeResult;
+}
+
 /*
  * Function: gos_timeCompare
  */
@@ -770,105 +933,223 @@ gos_result_t gos_timeIncreaseSystemTime (u16_t milliseconds)
     /*
      * Local variables.
      */
-    gos_result_t increaseSystemTimeResult = GOS_ERROR;
+    gos_result_t increaseSystemTimeResult = GOS_SUCCESS;
 
     /*
      * Function code.
      */
-    if (gos_runTimeAddMilliseconds(&systemRunTime, milliseconds) == GOS_SUCCESS &&
-        gos_timeAddMilliseconds(&systemTime, milliseconds) == GOS_SUCCESS)
+    GOS_ATOMIC_ENTER
+    monotonicMs += milliseconds;
+    (void_t) gos_timerDriverSysTimerGet(&monotonicTimerValue);
+
+    // Wake up the time daemon at the second boundary, the carries are
+    // resolved there.
+    if (monotonicMs >= timeNextSecondMs)
     {
-        increaseSystemTimeResult = GOS_SUCCESS;
+        timeNextSecondMs += 1000u;
+        (void_t) gos_triggerIncrement(&timeTrigger);
     }
     else
     {
-        // One of the operations failed.
+        // Nothing to do.
     }
+    GOS_ATOMIC_EXIT
 
     return increaseSystemTimeResult;
 }
 
 /**
- * @brief   Time daemon task.
- * @details Increases the system time approximately every second and invokes the
- *          elapsed signals.
+ * @brief   Brings the calendar time up to date.
+ * @details Adds the milliseconds elapsed since the last update to the system time
+ *          and records the elapsed units for the time daemon. Must be called from an
+ *          atomic section (the addition takes constant time apart from one step per
+ *          elapsed month).
  *
  * @return    -
  */
-GOS_STATIC void_t gos_timeDaemonTask (void_t)
+GOS_STATIC void_t gos_timeCalendarUpdate (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_time_t previousTime = systemTime;
+
+    /*
+     * Function code.
+     */
+    if (monotonicMs != systemTimeStampMs)
+    {
+        gos_timeCalendarAdd(&systemTime, monotonicMs - systemTimeStampMs);
+
+        // The highest changed unit covers every carry in between.
+        timePendingUnits |= gos_timeGetElapsedUnits(&previousTime, &systemTime);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    systemTimeStampMs = monotonicMs;
+    timeNextSecondMs  = monotonicMs + (1000u - (systemTime.milliseconds % 1000u));
+}
+
+/**
+ * @brief   Adds milliseconds to a calendar time.
+ * @details Resolves the carries up to the hours by division, then advances the
+ *          calendar month by month with the remaining days (February has 29 days
+ *          in years divisible by 4, like in #gos_timeAddMilliseconds).
+ *
+ * @param[in,out] pTime        Pointer to the calendar time.
+ * @param[in]     milliseconds Milliseconds to add.
+ *
+ * @return    -
+ */
+GOS_STATIC void_t gos_timeCalendarAdd (gos_time_t* pTime, u64_t milliseconds)
 {
     /*
      * Local variables.
      */
-    gos_time_t previousTime = {0};
+    u64_t totalSeconds = (pTime->milliseconds + milliseconds) / 1000u;
+    u32_t totalHours   = 0u;
+    u32_t totalDays    = 0u;
+    u32_t monthDays    = 0u;
 
     /*
      * Function code.
      */
+    pTime->milliseconds = (gos_millisecond_t)((pTime->milliseconds + milliseconds) % 1000u);
+
+    totalSeconds   += pTime->seconds + 60u * (pTime->minutes + 60u * (u64_t)pTime->hours);
+    pTime->seconds  = (gos_second_t)(totalSeconds % 60u);
+    pTime->minutes  = (gos_minute_t)((totalSeconds / 60u) % 60u);
+    totalHours      = (u32_t)(totalSeconds / 3600u);
+    pTime->hours    = (gos_hour_t)(totalHours % 24u);
+    totalDays       = pTime->days + totalHours / 24u;
+
     for (;;)
     {
-        // Invoke second elapsed signal.
-        if (systemTime.seconds > previousTime.seconds)
-        {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_SECOND_ELAPSED_SENDER_ID);
-        }
-        else
-        {
-            // Nothing to do.
-        }
+        monthDays = (pTime->years % 4 == 0 && pTime->months == GOS_TIME_FEBRUARY) ?
+                29u : dayLookupTable[pTime->months - 1];
 
-        // Invoke minute elapsed signal.
-        if (systemTime.minutes > previousTime.minutes)
+        if (totalDays > monthDays)
         {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_MINUTE_ELAPSED_SENDER_ID);
-        }
-        else
-        {
-            // Nothing to do.
-        }
+            totalDays -= monthDays;
+            pTime->months++;
 
-        // Invoke hour elapsed signal.
-        if (systemTime.hours > previousTime.hours)
-        {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_HOUR_ELAPSED_SENDER_ID);
+            if (pTime->months == 13)
+            {
+                pTime->months = 1;
+                pTime->years++;
+            }
+            else
+            {
+                // Nothing to do.
+            }
         }
         else
         {
-            // Nothing to do.
+            break;
         }
+    }
 
-        // Invoke day elapsed signal.
-        if (systemTime.days > previousTime.days)
-        {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_DAY_ELAPSED_SENDER_ID);
-        }
-        else
-        {
-            // Nothing to do.
-        }
+    pTime->days = (gos_day_t)totalDays;
+}
 
-        // Invoke month elapsed signal.
-        if (systemTime.months > previousTime.months)
-        {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_MONTH_ELAPSED_SENDER_ID);
-        }
-        else
-        {
-            // Nothing to do.
-        }
+/**
+ * @brief   Gets the elapsed units between two calendar times.
+ * @details Finds the highest unit that has changed: that unit and every lower unit
+ *          have elapsed (a unit can only change through a carry from the lower one).
+ *
+ * @param[in] pPrevious Pointer to the previous calendar time.
+ * @param[in] pCurrent  Pointer to the current calendar time.
+ *
+ * @return  Mask of the elapsed units (#GOS_TIME_UNIT_MASK).
+ */
+GOS_STATIC u32_t gos_timeGetElapsedUnits (gos_time_t* pPrevious, gos_time_t* pCurrent)
+{
+    /*
+     * Local variables.
+     */
+    u32_t elapsedUnits = 0u;
 
-        // Invoke year elapsed signal.
-        if (systemTime.years > previousTime.years)
-        {
-            (void_t) gos_signalInvoke(timeSignalId, GOS_TIME_YEAR_ELAPSED_SENDER_ID);
-        }
-        else
+    /*
+     * Function code.
+     */
+    if (pPrevious->years != pCurrent->years)
+    {
+        elapsedUnits = GOS_TIME_UNIT_MASK(GOS_TIME_YEAR_ELAPSED_SENDER_ID);
+    }
+    else if (pPrevious->months != pCurrent->months)
+    {
+        elapsedUnits = GOS_TIME_UNIT_MASK(GOS_TIME_MONTH_ELAPSED_SENDER_ID);
+    }
+    else if (pPrevious->days != pCurrent->days)
+    {
+        elapsedUnits = GOS_TIME_UNIT_MASK(GOS_TIME_DAY_ELAPSED_SENDER_ID);
+    }
+    else if (pPrevious->hours != pCurrent->hours)
+    {
+        elapsedUnits = GOS_TIME_UNIT_MASK(GOS_TIME_HOUR_ELAPSED_SENDER_ID);
+    }
+    else if (pPrevious->minutes != pCurrent->minutes)
+    {
+        elapsedUnits = GOS_TIME_UNIT_MASK(GOS_TIME_MINUTE_ELAPSED_SENDER_ID);
+    }
+    else if (pPrevious->seconds != pCurrent->seconds)
+    {
+        elapsedUnits = GOS_TIME_UNIT_MASK(GOS_TIME_SECOND_ELAPSED_SENDER_ID);
+    }
+    else
+    {
+        // No unit has elapsed.
+    }
+
+    // The changed unit implies every lower unit.
+    return (elapsedUnits != 0u) ? ((elapsedUnits << 1) - 1u) : 0u;
+}
+
+/**
+ * @brief   Time daemon task.
+ * @details Woken up by the system tick at every second boundary. Brings the calendar
+ *          time up to date and invokes the time signal once for each elapsed unit.
+ *
+ * @return    -
+ */
+GOS_STATIC void_t gos_timeDaemonTask (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_time_t                currentTime  = {0};
+    u32_t                     elapsedUnits = 0u;
+    gos_timeElapsedSenderId_t unit         = GOS_TIME_SECOND_ELAPSED_SENDER_ID;
+
+    /*
+     * Function code.
+     */
+    for (;;)
+    {
+        (void_t) gos_triggerWait(&timeTrigger, 1u, GOS_TRIGGER_ENDLESS_TMO);
+        (void_t) gos_triggerReset(&timeTrigger);
+
+        // Collect the carries (including the ones of other readers).
+        (void_t) gos_timeGet(&currentTime);
+
+        GOS_ATOMIC_ENTER
+        elapsedUnits        = timePendingUnits;
+        timePendingUnits    = 0u;
+        GOS_ATOMIC_EXIT
+
+        for (unit = GOS_TIME_SECOND_ELAPSED_SENDER_ID; unit <= GOS_TIME_YEAR_ELAPSED_SENDER_ID; unit++)
         {
-            // Nothing to do.
+            if ((elapsedUnits & GOS_TIME_UNIT_MASK(unit)) != 0u)
+            {
+                (void_t) gos_signalInvoke(timeSignalId, unit);
+            }
+            else
+            {
+                // Unit has not elapsed.
+            }
         }
-
-        // Initialize previous time.
-        (void_t) gos_timeGet(&previousTime);
-        (void_t) gos_taskSleep(TIME_SLEEP_TIME_MS);
     }
 }
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       gos_trace.c
 //! @author     Ahmed Gazar
-//! @date       2025-04-06
-//! @version    1.13
+//! @date       2026-10-19
+//! @version    1.19
 //!
 //! @brief      GOS trace service source.
 //! @details    For a more detailed description of this service, please refer to @ref gos_trace.h
@@ -42,6 +42,27 @@
 // 1.12       2024-03-08    Ahmed Gazar     -    GOS_TRACE_DAEMON_POLL_TIME_MS removed
 // 1.13       2025-04-06    Ahmed Gazar     *    Initializer result logic inverted
 //                                          *    GOS_CONCAT_RESULT usage added
+// 1.14       2026-10-19    Ahmed Gazar     +    Binary trace ring added
+//                                          +    gos_traceTraceBinary added
+//                                          +    gos_traceGetBinaryDropCounter added
+// 1.15       2026-10-19    Ahmed Gazar     *    Trace queue, mutex and daemon resume replaced by
+//                                               a multi-producer reserve/commit byte ring
+//                                               drained in contiguous chunks
+//                                          +    gos_traceGetStatistics added
+//                                          -    gos_traceGetBinaryDropCounter removed
+//                                          -    GOS_TRACE_QUEUE_TMO_MS removed
+//                                          -    GOS_TRACE_MUTEX_TMO_MS removed
+// 1.16       2026-10-19    Ahmed Gazar     +    Trace channel registry added
+// 1.17       2026-10-19    Ahmed Gazar     *    Binary record timestamp taken from the monotonic
+//                                               microsecond clock
+// 1.18       2026-10-19    Ahmed Gazar     *    Trace data copied to the ring in the same atomic
+//                                               section as the space allocation (a preempted or
+//                                               deleted producer cannot stall the ring)
+//                                          -    Commit index and pending commit counter removed
+// 1.19       2026-10-19    Ahmed Gazar     *    gos_traceTraceFormatted formats in static line
+//                                               buffers (task buffer guarded by the trace mutex)
+//                                               instead of on the caller stack
+//                                          +    GOS_TRACE_MUTEX_TMO_MS added
 //*************************************************************************************************
 //
 // Copyright (c) 2022 Ahmed Gazar
@@ -67,12 +88,13 @@
  */
 #include <gos_trace.h>
 #include <gos_mutex.h>
-#include <gos_queue.h>
 #include <gos_time.h>
 #include <gos_trace_driver.h>
+#include <gos_trigger.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+
 /*
  * Macros
  */
@@ -87,52 +109,106 @@
 #define GOS_TRACE_TIMESTAMP_LENGTH       ( 46u )
 
 /**
- * Timeout value in [ms] for queue operations.
+ * Maximum time in [ms] a task waits for free space in the trace ring (back-pressure).
+ */
+#define GOS_TRACE_BACKPRESSURE_TMO_MS    ( 20u )
+
+/**
+ * Maximum time in [ms] a task waits for the formatting line buffer.
  */
-#define GOS_TRACE_QUEUE_TMO_MS           ( 2000u )
+#define GOS_TRACE_MUTEX_TMO_MS           ( 20u )
 
 /**
- * Timeout value in [ms] for mutex operations.
+ * Trace line buffer length (timestamp and formatted message).
  */
-#define GOS_TRACE_MUTEX_TMO_MS           ( 2000u )
+#define GOS_TRACE_LINE_LENGTH            ( GOS_TRACE_TIMESTAMP_LENGTH + CFG_TRACE_MAX_LENGTH )
+
+/**
+ * Trace ring index mask.
+ */
+#define GOS_TRACE_RING_MASK              ( CFG_TRACE_RING_SIZE - 1u )
+
+#if (CFG_TRACE_RING_SIZE & (CFG_TRACE_RING_SIZE - 1)) != 0 || CFG_TRACE_RING_SIZE > 32768
+#error "gos_trace.c: CFG_TRACE_RING_SIZE shall be a power of 2 and not greater than 32768."
+#endif
 
 /*
  * Static variables
  */
 /**
- * Trace queue.
+ * Trace ring (raw output bytes).
  */
-GOS_STATIC gos_queueDescriptor_t traceQueue =
-{
-#if CFG_QUEUE_USE_NAME == 1
-    .queueName = "gos_trace_queue"
-#endif
-};
+GOS_STATIC u8_t          traceRing [CFG_TRACE_RING_SIZE];
+
+/**
+ * Write index (free-running), the bytes before it are ready to be sent.
+ */
+GOS_STATIC u32_t         traceRingWriteIndex;
+
+/**
+ * Read index (free-running), the bytes before it have been sent.
+ */
+GOS_STATIC u32_t         traceRingReadIndex;
+
+/**
+ * Maximum number of bytes in the trace ring.
+ */
+GOS_STATIC u32_t         traceRingMaxUsage;
+
+/**
+ * Number of traces lost because of full ring.
+ */
+GOS_STATIC u32_t         traceDropCounter;
+
+/**
+ * Trace channel registry.
+ */
+GOS_STATIC gos_traceChannel_t* traceChannels [CFG_TRACE_MAX_CHANNELS];
+
+/**
+ * Number of registered trace channels.
+ */
+GOS_STATIC u8_t          traceChannelNumber;
+
+/**
+ * Trace daemon wake-up trigger.
+ */
+GOS_STATIC gos_trigger_t traceTrigger;
 
 /**
- * Trace line buffer.
+ * Trace line buffer (for string transmission if no binary driver is registered).
  */
-GOS_STATIC char_t traceLine       [CFG_TRACE_MAX_LENGTH];
+GOS_STATIC char_t        traceLine [CFG_TRACE_MAX_LENGTH];
 
 /**
- * Trace formatted buffer for message formatting.
+ * Trace line buffer for formatting in tasks (guarded by the trace mutex).
  */
-GOS_STATIC char_t formattedBuffer [CFG_TRACE_MAX_LENGTH];
+GOS_STATIC char_t        taskLineBuffer [GOS_TRACE_LINE_LENGTH];
 
 /**
- * Buffer for timestamp printing.
+ * Trace line buffer for formatting in ISRs (used in an atomic section).
  */
-GOS_STATIC char_t timeStampBuffer [GOS_TRACE_TIMESTAMP_LENGTH];
+GOS_STATIC char_t        isrLineBuffer [GOS_TRACE_LINE_LENGTH];
 
 /**
- * Trace mutex.
+ * Trace mutex (guards the task line buffer).
  */
-GOS_STATIC gos_mutex_t traceMutex;
+GOS_STATIC gos_mutex_t   traceMutex;
+
+/**
+ * Trace formatted buffer for unsafe message formatting.
+ */
+GOS_STATIC char_t        formattedBuffer [CFG_TRACE_MAX_LENGTH];
 
 /*
  * Function prototypes
  */
-GOS_STATIC void_t gos_traceDaemonTask (void_t);
+GOS_STATIC void_t       gos_traceDaemonTask   (void_t);
+GOS_STATIC bool_t       gos_traceCallerAllowed (void_t);
+GOS_STATIC gos_result_t gos_traceRingPut     (GOS_CONST void_t* pHead, u32_t headSize, GOS_CONST void_t* pData, u32_t dataSize);
+GOS_STATIC void_t       gos_traceRingWrite    (u32_t startIndex, GOS_CONST void_t* pData, u32_t size);
+GOS_STATIC u32_t        gos_traceTimeStampPrint (char_t* pBuffer);
+GOS_STATIC gos_result_t gos_traceLinePut      (char_t* pLineBuffer, bool_t addTimeStamp, GOS_CONST char_t* traceFormat, va_list args);
 
 /**
  * Trace daemon task descriptor.
@@ -159,14 +235,24 @@ gos_result_t gos_traceInit (void_t)
     /*
      * Function code.
      */
-    // Create trace queue and register trace daemon task.
-    if (gos_queueCreate(&traceQueue)                 == GOS_SUCCESS &&
-        gos_taskRegister(&traceDaemonTaskDesc, NULL) == GOS_SUCCESS &&
-        gos_mutexInit(&traceMutex) == GOS_SUCCESS
+    traceRingWriteIndex     = 0u;
+    traceRingReadIndex      = 0u;
+    traceRingMaxUsage       = 0u;
+    traceDropCounter        = 0u;
+    traceChannelNumber      = 0u;
+
+    // Initialize trigger and register trace daemon task.
+    if (gos_triggerInit(&traceTrigger)               == GOS_SUCCESS &&
+        gos_mutexInit(&traceMutex)                   == GOS_SUCCESS &&
+        gos_taskRegister(&traceDaemonTaskDesc, NULL) == GOS_SUCCESS
         )
     {
         traceInitResult = GOS_SUCCESS;
     }
+    else
+    {
+        // Nothing to do.
+    }
 
     return traceInitResult;
 }
@@ -179,78 +265,29 @@ GOS_INLINE gos_result_t gos_traceTrace (bool_t addTimeStamp, char_t* traceMessag
     /*
      * Local variables.
      */
-    gos_result_t             traceResult    = GOS_ERROR;
-    gos_tid_t                callerTaskId   = GOS_INVALID_TASK_ID;
-    gos_taskPrivilegeLevel_t privileges     = 0u;
-    gos_taskDescriptor_t     callerTaskDesc = {0};
-    gos_time_t               sysTime        = {0};
+    gos_result_t traceResult     = GOS_ERROR;
+    char_t       timeStampBuffer [GOS_TRACE_TIMESTAMP_LENGTH];
+    u32_t        timeStampLength = 0u;
+    u32_t        messageLength   = 0u;
 
     /*
      * Function code.
      */
-    if ((traceMessage                                          != NULL           ) &&
-        (gos_taskGetCurrentId(&callerTaskId)                   == GOS_SUCCESS    ) &&
-        (gos_taskGetData(callerTaskId, &callerTaskDesc)        == GOS_SUCCESS    ) &&
-        (((callerTaskDesc.taskPrivilegeLevel & GOS_PRIV_TRACE) == GOS_PRIV_TRACE ) ||
-        (gos_kernelIsCallerIsr()                               == GOS_TRUE       )) &&
-        (gos_mutexLock(&traceMutex, GOS_TRACE_MUTEX_TMO_MS)    == GOS_SUCCESS    )
-        )
+    if ((traceMessage != NULL) && (gos_traceCallerAllowed() == GOS_TRUE))
     {
-        // Pre-set result.
-        traceResult = GOS_SUCCESS;
-
         if (addTimeStamp == GOS_TRUE)
         {
-            GOS_CONCAT_RESULT(traceResult, gos_timeGet(&sysTime));
-            (void_t) sprintf(timeStampBuffer, GOS_TRACE_TIMESTAMP_FORMAT,
-                    sysTime.years,
-                    sysTime.months,
-                    sysTime.days,
-                    sysTime.hours,
-                    sysTime.minutes,
-                    sysTime.seconds,
-                    sysTime.milliseconds
-                    );
-            // Add timestamp to queue.
-            GOS_CONCAT_RESULT(traceResult, gos_queuePut(
-                    traceQueue.queueId,
-                    (void_t*)timeStampBuffer,
-                    strlen(timeStampBuffer) + 1,
-                    GOS_TRACE_QUEUE_TMO_MS
-                    ));
+            timeStampLength = gos_traceTimeStampPrint(timeStampBuffer);
         }
         else
         {
             // Timestamp not needed.
         }
 
-        // Add trace message to queue.
-        GOS_CONCAT_RESULT(traceResult, gos_queuePut(
-                traceQueue.queueId,
-                (void_t*)traceMessage,
-                strlen(traceMessage) + 1,
-                GOS_TRACE_QUEUE_TMO_MS
-                ));
-
-        GOS_ATOMIC_ENTER
-
-        // Get task privileges.
-        (void_t) gos_taskGetPrivileges(callerTaskId, &privileges);
+        messageLength = strlen(traceMessage);
 
-        if ((privileges & GOS_PRIV_TASK_MANIPULATE) != GOS_PRIV_TASK_MANIPULATE)
-        {
-            // If task has no privilege to manipulate other tasks, add it temporarily.
-            (void_t) gos_taskAddPrivilege(callerTaskId, GOS_PRIV_TASK_MANIPULATE);
-            (void_t) gos_taskResume(traceDaemonTaskDesc.taskId);
-            (void_t) gos_taskRemovePrivilege(callerTaskId, GOS_PRIV_TASK_MANIPULATE);
-        }
-        else
-        {
-            (void_t) gos_taskResume(traceDaemonTaskDesc.taskId);
-        }
-        GOS_ATOMIC_EXIT
-
-        (void_t) gos_mutexUnlock(&traceMutex);
+        // Timestamp and message are placed in the ring together.
+        traceResult = gos_traceRingPut(timeStampBuffer, timeStampLength, traceMessage, messageLength);
     }
     else
     {
@@ -268,83 +305,41 @@ gos_result_t gos_traceTraceFormatted (bool_t addTimeStamp, GOS_CONST char_t* tra
     /*
      * Local variables.
      */
-    gos_result_t             traceResult    = GOS_SUCCESS;
-    gos_tid_t                callerTaskId   = GOS_INVALID_TASK_ID;
-    gos_taskDescriptor_t     callerTaskDesc = {0};
-    gos_time_t               sysTime        = {0};
-    va_list                  args;
-    gos_taskPrivilegeLevel_t privileges     = 0u;
+    gos_result_t traceResult = GOS_ERROR;
+    va_list      args;
 
     /*
      * Function code.
      */
-    if ((traceFormat                                           != NULL           ) &&
-        (gos_taskGetCurrentId(&callerTaskId)                   == GOS_SUCCESS    ) &&
-        (gos_taskGetData(callerTaskId, &callerTaskDesc)        == GOS_SUCCESS    ) &&
-        (((callerTaskDesc.taskPrivilegeLevel & GOS_PRIV_TRACE) == GOS_PRIV_TRACE ) ||
-        (gos_kernelIsCallerIsr()                               == GOS_TRUE       )) &&
-        (gos_mutexLock(&traceMutex, GOS_TRACE_MUTEX_TMO_MS)    == GOS_SUCCESS    )
-        )
+    if ((traceFormat != NULL) && (gos_traceCallerAllowed() == GOS_TRUE))
     {
-        if (addTimeStamp == GOS_TRUE)
-        {
-            GOS_CONCAT_RESULT(traceResult, gos_timeGet(&sysTime));
-            (void_t) sprintf(timeStampBuffer, GOS_TRACE_TIMESTAMP_FORMAT,
-                    sysTime.years,
-                    sysTime.months,
-                    sysTime.days,
-                    sysTime.hours,
-                    sysTime.minutes,
-                    sysTime.seconds,
-                    sysTime.milliseconds
-                    );
-            // Add timestamp to queue.
-            GOS_CONCAT_RESULT(traceResult, gos_queuePut(
-                    traceQueue.queueId,
-                    (void_t*)timeStampBuffer,
-                    strlen(timeStampBuffer) + 1,
-                    GOS_TRACE_QUEUE_TMO_MS
-                    ));
-        }
-        else
-        {
-            // Timestamp not needed.
-        }
-
-        // Add trace message to queue.
         va_start(args, traceFormat);
-        (void_t) vsprintf(formattedBuffer, traceFormat, args);
-        va_end(args);
-        GOS_CONCAT_RESULT(traceResult, gos_queuePut(
-                traceQueue.queueId,
-                (void_t*)formattedBuffer,
-                strlen(formattedBuffer) + 1,
-                GOS_TRACE_QUEUE_TMO_MS
-                ));
-
-        GOS_ATOMIC_ENTER
 
-        // Get task privileges.
-        (void_t) gos_taskGetPrivileges(callerTaskId, &privileges);
-
-        if ((privileges & GOS_PRIV_TASK_MANIPULATE) != GOS_PRIV_TASK_MANIPULATE)
+        if (gos_kernelIsCallerIsr() == GOS_TRUE)
+        {
+            // ISRs format in their own buffer with interrupts disabled (nested ISRs).
+            GOS_ATOMIC_ENTER
+            traceResult = gos_traceLinePut(isrLineBuffer, addTimeStamp, traceFormat, args);
+            GOS_ATOMIC_EXIT
+        }
+        else if (gos_mutexLock(&traceMutex, GOS_TRACE_MUTEX_TMO_MS) == GOS_SUCCESS)
         {
-            // If task has no privilege to manipulate other tasks, add it temporarily.
-            (void_t) gos_taskAddPrivilege(callerTaskId, GOS_PRIV_TASK_MANIPULATE);
-            (void_t) gos_taskResume(traceDaemonTaskDesc.taskId);
-            (void_t) gos_taskRemovePrivilege(callerTaskId, GOS_PRIV_TASK_MANIPULATE);
+            traceResult = gos_traceLinePut(taskLineBuffer, addTimeStamp, traceFormat, args);
+            (void_t) gos_mutexUnlock(&traceMutex);
         }
         else
         {
-            (void_t) gos_taskResume(traceDaemonTaskDesc.taskId);
+            // Dropped.
+            GOS_ATOMIC_ENTER
+            traceDropCounter++;
+            GOS_ATOMIC_EXIT
         }
-        GOS_ATOMIC_EXIT
 
-        (void_t) gos_mutexUnlock(&traceMutex);
+        va_end(args);
     }
     else
     {
-        traceResult = GOS_ERROR;
+        // Nothing to do.
     }
 
     return traceResult;
@@ -369,7 +364,7 @@ gos_result_t gos_traceTraceFormattedUnsafe (GOS_CONST char_t* traceFormat, ...)
         GOS_DISABLE_SCHED
         {
             va_start(args, traceFormat);
-            (void_t) vsprintf(formattedBuffer, traceFormat, args);
+            (void_t) vsnprintf(formattedBuffer, CFG_TRACE_MAX_LENGTH, traceFormat, args);
             va_end(args);
 
             traceResult = gos_traceDriverTransmitString_Unsafe(formattedBuffer);
@@ -384,36 +379,519 @@ gos_result_t gos_traceTraceFormattedUnsafe (GOS_CONST char_t* traceFormat, ...)
     return traceResult;
 }
 
+/*
+ * Function: gos_traceTraceBinary
+ */
+GOS_INLINE gos_result_t gos_traceTraceBinary (u16_t formatId, u8_t argNumber, u32_t* pArgs)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t            traceResult = GOS_ERROR;
+    gos_traceBinaryRecord_t record;
+    u32_t                   recordSize  = GOS_TRACE_BINARY_HEADER_SIZE + argNumber * sizeof(u32_t);
+
+    /*
+     * Function code.
+     */
+    if ((argNumber <= CFG_TRACE_BINARY_MAX_ARGS) && (argNumber == 0u || pArgs != NULL) &&
+        (gos_traceCallerAllowed() == GOS_TRUE))
+    {
+        record.sync      = GOS_TRACE_BINARY_SYNC;
+        record.argNumber = argNumber;
+        record.formatId  = formatId;
+        record.timeStamp = (u32_t)gos_timeGetMonotonicUs();
+        (void_t) memcpy((void_t*)record.arguments, (void_t*)pArgs, argNumber * sizeof(u32_t));
+
+        traceResult = gos_traceRingPut(&record, recordSize, NULL, 0u);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return traceResult;
+}
+
+/*
+ * Function: gos_traceGetStatistics
+ */
+gos_result_t gos_traceGetStatistics (gos_traceStatistics_t* pStatistics)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pStatistics != NULL)
+    {
+        GOS_ATOMIC_ENTER
+
+        pStatistics->ringSize     = CFG_TRACE_RING_SIZE;
+        pStatistics->ringUsage    = traceRingWriteIndex - traceRingReadIndex;
+        pStatistics->ringMaxUsage = traceRingMaxUsage;
+        pStatistics->dropCounter  = traceDropCounter;
+
+        GOS_ATOMIC_EXIT
+
+        getResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getResult;
+}
+
+/*
+ * Function: gos_traceChannelRegister
+ */
+gos_result_t gos_traceChannelRegister (gos_traceChannel_t* pChannel)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t registerResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    GOS_ATOMIC_ENTER
+
+    if (pChannel != NULL && pChannel->name != NULL && traceChannelNumber < CFG_TRACE_MAX_CHANNELS)
+    {
+        traceChannels[traceChannelNumber++] = pChannel;
+        registerResult                      = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    GOS_ATOMIC_EXIT
+
+    return registerResult;
+}
+
+/*
+ * Function: gos_traceChannelSetLevel
+ */
+gos_result_t gos_traceChannelSetLevel (GOS_CONST char_t* channelName, gos_traceLevel_t level)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t setResult    = GOS_ERROR;
+    u8_t         channelIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    if (channelName != NULL && level <= GOS_TRACE_LEVEL_DEBUG)
+    {
+        for (channelIndex = 0u; channelIndex < traceChannelNumber; channelIndex++)
+        {
+            if (strcmp(channelName, "all") == 0 || strcmp(channelName, traceChannels[channelIndex]->name) == 0)
+            {
+                traceChannels[channelIndex]->level = level;
+                setResult                          = GOS_SUCCESS;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return setResult;
+}
+
+/*
+ * Function: gos_traceChannelGet
+ */
+gos_result_t gos_traceChannelGet (u8_t index, gos_traceChannel_t** ppChannel)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t getResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (index < traceChannelNumber && ppChannel != NULL)
+    {
+        *ppChannel = traceChannels[index];
+        getResult  = GOS_SUCCESS;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return getResult;
+}
+
 /**
- * @brief   Trace daemon task.
- * @details Polls the trace queue and transmits the elements in the trace queue
- *          via the registered trace driver.
+ * @brief   Checks whether the caller is allowed to trace.
+ * @details ISRs are always allowed, tasks need the trace privilege.
  *
- * @return  -
+ * @return  Caller allowed flag.
+ *
+ * @retval  #GOS_TRUE  Caller allowed to trace.
+ * @retval  #GOS_FALSE Caller has no trace privilege.
  */
-GOS_STATIC void_t gos_traceDaemonTask (void_t)
+GOS_STATIC bool_t gos_traceCallerAllowed (void_t)
+{
+    /*
+     * Local variables.
+     */
+    bool_t                   callerAllowed = GOS_FALSE;
+    gos_tid_t                callerTaskId  = GOS_INVALID_TASK_ID;
+    gos_taskPrivilegeLevel_t privileges    = 0u;
+
+    /*
+     * Function code.
+     */
+    if ((gos_kernelIsCallerIsr()                           == GOS_TRUE      ) ||
+        ((gos_taskGetCurrentId(&callerTaskId)              == GOS_SUCCESS   ) &&
+        (gos_taskGetPrivileges(callerTaskId, &privileges)  == GOS_SUCCESS   ) &&
+        ((privileges & GOS_PRIV_TRACE)                     == GOS_PRIV_TRACE))
+        )
+    {
+        callerAllowed = GOS_TRUE;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return callerAllowed;
+}
+
+/**
+ * @brief   Puts data in the trace ring.
+ * @details Copies the head and the data (optional) in the ring in the same atomic
+ *          section as the space is allocated in, so the data is ready to be sent
+ *          as soon as the section ends. Tasks wait for the daemon to free space
+ *          (back-pressure) for a limited time, ISRs drop the trace immediately.
+ *          The daemon is only notified if it has nothing else to send (otherwise
+ *          it picks the new data up anyway).
+ *
+ * @param[in] pHead    Pointer to the head data.
+ * @param[in] headSize Size of the head data.
+ * @param[in] pData    Pointer to the data following the head (can be NULL).
+ * @param[in] dataSize Size of the data following the head.
+ *
+ * @return  Result of placing the data in the ring.
+ *
+ * @retval  #GOS_SUCCESS Data placed in the ring.
+ * @retval  #GOS_ERROR   Ring full, trace dropped.
+ */
+GOS_STATIC gos_result_t gos_traceRingPut (GOS_CONST void_t* pHead, u32_t headSize, GOS_CONST void_t* pData, u32_t dataSize)
 {
+    /*
+     * Local variables.
+     */
+    gos_result_t putResult    = GOS_ERROR;
+    u32_t        size         = headSize + (pData != NULL ? dataSize : 0u);
+    u32_t        waitTime     = 0u;
+    u32_t        usage        = 0u;
+    bool_t       notifyDaemon = GOS_FALSE;
+
     /*
      * Function code.
      */
     for (;;)
     {
-        if (gos_mutexLock(&traceMutex, GOS_TRACE_MUTEX_TMO_MS) == GOS_SUCCESS)
+        GOS_ATOMIC_ENTER
+
+        usage = traceRingWriteIndex - traceRingReadIndex;
+
+        if ((usage + size) <= CFG_TRACE_RING_SIZE)
         {
-            while (gos_queueGet(
-                    traceQueue.queueId,
-                    (void_t*)traceLine,
-                    sizeof(traceLine),
-                    GOS_TRACE_QUEUE_TMO_MS) == GOS_SUCCESS)
+            gos_traceRingWrite(traceRingWriteIndex, pHead, headSize);
+
+            if (pData != NULL)
+            {
+                gos_traceRingWrite(traceRingWriteIndex + headSize, pData, dataSize);
+            }
+            else
+            {
+                // Head only.
+            }
+
+            notifyDaemon         = (usage == 0u) ? GOS_TRUE : GOS_FALSE;
+            traceRingWriteIndex += size;
+            putResult            = GOS_SUCCESS;
+
+            if ((usage + size) > traceRingMaxUsage)
             {
-                (void_t) gos_traceDriverTransmitString(traceLine);
+                traceRingMaxUsage = usage + size;
+            }
+            else
+            {
+                // Nothing to do.
             }
         }
         else
         {
             // Nothing to do.
         }
-        (void_t) gos_mutexUnlock(&traceMutex);
-        (void_t) gos_taskSuspend(traceDaemonTaskDesc.taskId);
+
+        GOS_ATOMIC_EXIT
+
+        if ((putResult == GOS_SUCCESS) || (size > CFG_TRACE_RING_SIZE) ||
+            (gos_kernelIsCallerIsr() == GOS_TRUE) || (waitTime >= GOS_TRACE_BACKPRESSURE_TMO_MS) ||
+            (gos_taskSleep(1u) != GOS_SUCCESS))
+        {
+            break;
+        }
+        else
+        {
+            waitTime++;
+        }
+    }
+
+    if (putResult != GOS_SUCCESS)
+    {
+        GOS_ATOMIC_ENTER
+        traceDropCounter++;
+        GOS_ATOMIC_EXIT
+    }
+    else if (notifyDaemon == GOS_TRUE)
+    {
+        (void_t) gos_triggerIncrement(&traceTrigger);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return putResult;
+}
+
+/**
+ * @brief   Writes data to the trace ring.
+ * @details Copies the data in at most two parts (ring wrap-around). Shall be
+ *          called in an atomic section.
+ *
+ * @param[in] startIndex Free-running start index.
+ * @param[in] pData      Pointer to the data.
+ * @param[in] size       Size of the data.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_traceRingWrite (u32_t startIndex, GOS_CONST void_t* pData, u32_t size)
+{
+    /*
+     * Local variables.
+     */
+    u32_t offset    = startIndex & GOS_TRACE_RING_MASK;
+    u32_t firstPart = CFG_TRACE_RING_SIZE - offset;
+
+    /*
+     * Function code.
+     */
+    if (size <= firstPart)
+    {
+        (void_t) memcpy((void_t*)&traceRing[offset], pData, size);
+    }
+    else
+    {
+        (void_t) memcpy((void_t*)&traceRing[offset], pData, firstPart);
+        (void_t) memcpy((void_t*)traceRing, (GOS_CONST u8_t*)pData + firstPart, size - firstPart);
+    }
+}
+
+/**
+ * @brief   Formats a trace line and puts it in the trace ring.
+ * @details Prints the timestamp (optional) and the formatted message in the given
+ *          line buffer. The caller shall have exclusive access to the buffer.
+ *
+ * @param[in] pLineBuffer  Line buffer of #GOS_TRACE_LINE_LENGTH bytes.
+ * @param[in] addTimeStamp Flag to indicate whether to add timestamp.
+ * @param[in] traceFormat  Formatter string.
+ * @param[in] args         Formatter arguments.
+ *
+ * @return  Result of placing the line in the ring.
+ *
+ * @retval  #GOS_SUCCESS Line placed in the ring.
+ * @retval  #GOS_ERROR   Ring full, trace dropped.
+ */
+GOS_STATIC gos_result_t gos_traceLinePut (char_t* pLineBuffer, bool_t addTimeStamp, GOS_CONST char_t* traceFormat, va_list args)
+{
+    /*
+     * Local variables.
+     */
+    u32_t timeStampLength = 0u;
+    s32_t messageLength   = 0;
+
+    /*
+     * Function code.
+     */
+    if (addTimeStamp == GOS_TRUE)
+    {
+        timeStampLength = gos_traceTimeStampPrint(pLineBuffer);
+    }
+    else
+    {
+        // Timestamp not needed.
+    }
+
+    messageLength = vsnprintf(&pLineBuffer[timeStampLength], CFG_TRACE_MAX_LENGTH, traceFormat, args);
+
+    if (messageLength >= CFG_TRACE_MAX_LENGTH)
+    {
+        // Truncated.
+        messageLength = CFG_TRACE_MAX_LENGTH - 1;
+    }
+    else if (messageLength < 0)
+    {
+        messageLength = 0;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return gos_traceRingPut(pLineBuffer, timeStampLength + (u32_t)messageLength, NULL, 0u);
+}
+
+/**
+ * @brief   Prints the current timestamp.
+ * @details Prints the system time in the trace timestamp format.
+ *
+ * @param[out] pBuffer Buffer of at least #GOS_TRACE_TIMESTAMP_LENGTH bytes.
+ *
+ * @return  Length of the timestamp string.
+ */
+GOS_STATIC u32_t gos_traceTimeStampPrint (char_t* pBuffer)
+{
+    /*
+     * Local variables.
+     */
+    gos_time_t sysTime = {0};
+    s32_t      length  = 0;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_timeGet(&sysTime);
+    length = snprintf(pBuffer, GOS_TRACE_TIMESTAMP_LENGTH, GOS_TRACE_TIMESTAMP_FORMAT,
+            sysTime.years,
+            sysTime.months,
+            sysTime.days,
+            sysTime.hours,
+            sysTime.minutes,
+            sysTime.seconds,
+            sysTime.milliseconds
+            );
+
+    if (length >= (s32_t)GOS_TRACE_TIMESTAMP_LENGTH)
+    {
+        length = GOS_TRACE_TIMESTAMP_LENGTH - 1;
+    }
+    else if (length < 0)
+    {
+        length = 0;
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return (u32_t)length;
+}
+
+/**
+ * @brief   Trace daemon task.
+ * @details Waits for trace data and transmits it in contiguous chunks via
+ *          the binary (DMA) trace driver. The ring space is only released after the
+ *          transmission has finished. If no binary driver is registered, the chunks
+ *          are sent as strings.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t gos_traceDaemonTask (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u32_t readIndex   = 0u;
+    u32_t writeIndex  = 0u;
+    u32_t chunkSize   = 0u;
+    u32_t offset      = 0u;
+
+    /*
+     * Function code.
+     */
+    for (;;)
+    {
+        (void_t) gos_triggerWait(&traceTrigger, 1u, GOS_TRIGGER_ENDLESS_TMO);
+        (void_t) gos_triggerReset(&traceTrigger);
+
+        do
+        {
+            GOS_ATOMIC_ENTER
+            readIndex   = traceRingReadIndex;
+            writeIndex  = traceRingWriteIndex;
+            GOS_ATOMIC_EXIT
+
+            offset    = readIndex & GOS_TRACE_RING_MASK;
+            chunkSize = writeIndex - readIndex;
+
+            // Send until the end of the ring at most (contiguous chunk).
+            if (chunkSize > (CFG_TRACE_RING_SIZE - offset))
+            {
+                chunkSize = CFG_TRACE_RING_SIZE - offset;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            if (chunkSize > 0u)
+            {
+                if (gos_traceDriverTransmitBinary(&traceRing[offset], (u16_t)chunkSize) != GOS_SUCCESS)
+                {
+                    // Fall back to string transmission.
+                    if (chunkSize >= CFG_TRACE_MAX_LENGTH)
+                    {
+                        chunkSize = CFG_TRACE_MAX_LENGTH - 1u;
+                    }
+                    else
+                    {
+                        // Nothing to do.
+                    }
+
+                    (void_t) memcpy((void_t*)traceLine, (void_t*)&traceRing[offset], chunkSize);
+                    traceLine[chunkSize] = '\0';
+                    (void_t) gos_traceDriverTransmitString(traceLine);
+                }
+                else
+                {
+                    // Chunk sent.
+                }
+
+                // Release the sent bytes.
+                GOS_ATOMIC_ENTER
+                traceRingReadIndex += chunkSize;
+                GOS_ATOMIC_EXIT
+            }
+            else
+            {
+                // Nothing to do.
+            }
+        }
+        while (chunkSize > 0u);
     }
 }
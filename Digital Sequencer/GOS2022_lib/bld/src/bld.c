@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       bld.c
 //! @author     Ahmed Gazar
-//! @date       2024-12-26
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.1
 //!
 //! @brief      GOS2022 Library / Bootloader source.
 //! @details    For a more detailed description of this service, please refer to @ref bld.h
@@ -25,6 +25,8 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-12-26    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     *    Install chunks read into double buffer by SDH read
+//                                               stream while the previous chunk is programmed
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -109,9 +111,9 @@ GOS_STATIC svl_pdhSwInfo_t     currentSwInfo = {0};
 GOS_STATIC bld_state_t         bldState;
 
 /**
- * Bootloader install buffer.
+ * Bootloader install buffers (one is programmed while the other is filled).
  */
-GOS_STATIC u8_t                bldInstallBuffer [BLD_INSTALL_CHUNK_SIZE];
+GOS_STATIC u8_t                bldInstallBuffer [2][BLD_INSTALL_CHUNK_SIZE];
 
 /**
  * Buffer for progress printing.
@@ -226,6 +228,7 @@ GOS_STATIC void_t bld_task (void_t)
     bool_t              connectTmo       = GOS_FALSE;
     gos_messageId_t     msgIds []        = { BLD_STATE_CONT_MSG_ID, 0 };
     u32_t               byteCounter      = 0u;
+    u8_t                installBufferIdx = 0u;
 
     /*
      * Function code.
@@ -269,20 +272,39 @@ GOS_STATIC void_t bld_task (void_t)
                 // Write to internal flash by chunks.
                 (void_t) drv_flashUnlock();
 
-                for (installChunkCntr = 0u; installChunkCntr < installChunkNum; installChunkCntr++)
+                // Start reading the first chunk from external flash.
+                installBufferIdx = 0u;
+
+                if (installChunkNum > 0u)
                 {
-                    // Read chunk from external flash.
-                    (void_t) svl_sdhReadBytesFromMemory(
-                            binaryDescriptor.binaryLocation + (installChunkCntr * BLD_INSTALL_CHUNK_SIZE),
-                            bldInstallBuffer,
+                    (void_t) svl_sdhReadStreamStart(
+                            binaryDescriptor.binaryLocation,
+                            bldInstallBuffer[installBufferIdx],
                             BLD_INSTALL_CHUNK_SIZE);
+                }
+                else
+                {
+                    // Nothing to install.
+                }
+
+                for (installChunkCntr = 0u; installChunkCntr < installChunkNum; installChunkCntr++)
+                {
+                    // Complete current chunk and start reading the next one meanwhile it is programmed.
+                    if ((installChunkCntr + 1) < installChunkNum)
+                    {
+                        (void_t) svl_sdhReadStreamNext(bldInstallBuffer[installBufferIdx ^ 1u], BLD_INSTALL_CHUNK_SIZE);
+                    }
+                    else
+                    {
+                        (void_t) svl_sdhReadStreamStop();
+                    }
 
                     // Program chunk in internal flash.
                     if (((installChunkCntr + 1) * BLD_INSTALL_CHUNK_SIZE) < binaryDescriptor.binaryInfo.size)
                     {
                         (void_t) drv_flashWriteWithoutLock(
                                  (binaryDescriptor.binaryInfo.startAddress + (installChunkCntr * BLD_INSTALL_CHUNK_SIZE)),
-                                 (void_t*)bldInstallBuffer,
+                                 (void_t*)bldInstallBuffer[installBufferIdx],
                                  BLD_INSTALL_CHUNK_SIZE);
 
                         byteCounter += BLD_INSTALL_CHUNK_SIZE;
@@ -291,12 +313,14 @@ GOS_STATIC void_t bld_task (void_t)
                     {
                         (void_t) drv_flashWriteWithoutLock(
                                  (binaryDescriptor.binaryInfo.startAddress + (installChunkCntr * BLD_INSTALL_CHUNK_SIZE)),
-                                 (void_t*)bldInstallBuffer,
+                                 (void_t*)bldInstallBuffer[installBufferIdx],
                                  binaryDescriptor.binaryInfo.size - (installChunkCntr * BLD_INSTALL_CHUNK_SIZE));
 
                         byteCounter += binaryDescriptor.binaryInfo.size - (installChunkCntr * BLD_INSTALL_CHUNK_SIZE);
                     }
 
+                    installBufferIdx ^= 1u;
+
                     // Display progress.
                     perc = 100 * 100 * byteCounter / binaryDescriptor.binaryInfo.size;
 
@@ -14,17 +14,27 @@
 //*************************************************************************************************
 //! @file       drv_crc.h
 //! @author     Ahmed Gazar
-//! @date       2024-02-01
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.3
 //!
 //! @brief      GOS2022 Library / Cyclic Redundancy Check driver header.
 //! @details    This driver provides CRC8/CRC16/CRC32/CRC64 and CHK8/CHK16/CHK32/CHK64 algorithms.
+//!             The CRC calculation method can be selected per width at compile time (bitwise,
+//!             table-driven, slice-by-4 or slice-by-8), trading flash for speed. All methods
+//!             give identical results. The 32-bit CRC is calculated on the CRC unit of the
+//!             controller when the hardware backend is selected, with a transparent fallback to
+//!             the software engine while the unit is busy or not initialized. Data arriving
+//!             in chunks can be processed with the start/update/finish context API.
 //*************************************************************************************************
 // History
 // ------------------------------------------------------------------------------------------------
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-02-01    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    CRC calculation method selection added
+// 1.2        2026-10-19    Ahmed Gazar     +    Hardware/software backend selection added
+//                                          +    drv_crcInit added
+// 1.3        2026-10-19    Ahmed Gazar     +    Streaming CRC context API added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -52,6 +62,78 @@
  */
 #include <gos.h>
 
+/*
+ * Macros
+ */
+/**
+ * Bitwise CRC calculation (no lookup table, smallest and slowest).
+ */
+#define DRV_CRC_METHOD_BITWISE      ( 0u )
+/**
+ * Table-driven CRC calculation (one 256-entry table per width, one byte per lookup).
+ */
+#define DRV_CRC_METHOD_TABLE        ( 1u )
+/**
+ * Slice-by-4 CRC calculation (4 input bytes per iteration, (3 + width / 8) tables per width).
+ */
+#define DRV_CRC_METHOD_SLICE4       ( 4u )
+/**
+ * Slice-by-8 CRC calculation (8 input bytes per iteration, (7 + width / 8) tables per width).
+ */
+#define DRV_CRC_METHOD_SLICE8       ( 8u )
+
+/**
+ * Software CRC backend (portable, used for host-side builds).
+ */
+#define DRV_CRC_BACKEND_SOFTWARE    ( 0u )
+/**
+ * Hardware CRC backend (CRC unit for matching widths, software engines for the others).
+ */
+#define DRV_CRC_BACKEND_HARDWARE    ( 1u )
+
+#if !defined(DRV_CRC_BACKEND)
+/**
+ * CRC backend selection.
+ */
+#define DRV_CRC_BACKEND             DRV_CRC_BACKEND_HARDWARE
+#endif
+
+#if !defined(DRV_CRC_METHOD)
+/**
+ * Default CRC calculation method for all widths. Flash cost of the tables per width:
+ * table: 256 * width / 8 bytes, slice-by-N: (N - 1 + width / 8) * 256 * width / 8 bytes.
+ */
+#define DRV_CRC_METHOD              DRV_CRC_METHOD_TABLE
+#endif
+
+#if !defined(DRV_CRC_METHOD_CRC8)
+/**
+ * 8-bit CRC calculation method.
+ */
+#define DRV_CRC_METHOD_CRC8         DRV_CRC_METHOD
+#endif
+
+#if !defined(DRV_CRC_METHOD_CRC16)
+/**
+ * 16-bit CRC calculation method.
+ */
+#define DRV_CRC_METHOD_CRC16        DRV_CRC_METHOD
+#endif
+
+#if !defined(DRV_CRC_METHOD_CRC32)
+/**
+ * 32-bit CRC calculation method (used for application and bootloader image checks).
+ */
+#define DRV_CRC_METHOD_CRC32        DRV_CRC_METHOD
+#endif
+
+#if !defined(DRV_CRC_METHOD_CRC64)
+/**
+ * 64-bit CRC calculation method.
+ */
+#define DRV_CRC_METHOD_CRC64        DRV_CRC_METHOD
+#endif
+
 /*
  * Type definitions
  */
@@ -73,9 +155,57 @@ typedef enum
     DRV_CHKSUM_CHECK_ERROR = 0b11101001  //!< CHK mismatch.
 }drv_crcChkSumCheckResult_t;
 
+/**
+ * 8-bit CRC streaming context.
+ */
+typedef struct
+{
+    u8_t  crcValue; //!< Current CRC register value.
+    u32_t dataSize; //!< Number of bytes processed so far.
+}drv_crcContext8_t;
+
+/**
+ * 16-bit CRC streaming context.
+ */
+typedef struct
+{
+    u16_t crcValue; //!< Current CRC register value.
+    u32_t dataSize; //!< Number of bytes processed so far.
+}drv_crcContext16_t;
+
+/**
+ * 32-bit CRC streaming context.
+ */
+typedef struct
+{
+    u32_t crcValue; //!< Current CRC register value.
+    u32_t dataSize; //!< Number of bytes processed so far.
+}drv_crcContext32_t;
+
+/**
+ * 64-bit CRC streaming context.
+ */
+typedef struct
+{
+    u64_t crcValue; //!< Current CRC register value.
+    u32_t dataSize; //!< Number of bytes processed so far.
+}drv_crcContext64_t;
+
 /*
  * Function prototypes
  */
+/**
+ * @brief   Initializes the CRC driver.
+ * @details Enables the CRC unit and creates its mutex when the hardware backend is used.
+ *          Until this is called, every calculation is done by the software engines.
+ *
+ * @return  Result of initialization.
+ *
+ * @retval  GOS_SUCCESS : Initialization successful.
+ * @retval  GOS_ERROR   : Mutex initialization failed.
+ */
+gos_result_t drv_crcInit (void_t);
+
 /**
  * @brief   8-bit CRC calculator.
  * @details Calculates the 8-bit CRC value on the given buffer.
@@ -136,6 +266,178 @@ gos_result_t drv_crcGetCrc32 (u8_t* pData, u32_t dataSize, u32_t* pCrc);
  */
 gos_result_t drv_crcGetCrc64 (u8_t* pData, u32_t dataSize, u64_t* pCrc);
 
+/**
+ * @brief   8-bit CRC stream start.
+ * @details Initializes the context for a new 8-bit CRC calculation.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ *
+ * @return  Result of starting.
+ *
+ * @retval  GOS_SUCCESS : Context initialized.
+ * @retval  GOS_ERROR   : pContext is NULL.
+ */
+gos_result_t drv_crcStartCrc8  (drv_crcContext8_t* pContext);
+
+/**
+ * @brief   8-bit CRC stream update.
+ * @details Continues the 8-bit CRC calculation with the next chunk of data. Chunks can be
+ *          of arbitrary size, the result equals the CRC of the concatenated chunks.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ * @param   pData    : Pointer to the chunk.
+ * @param   dataSize : Size of the chunk.
+ *
+ * @return  Result of updating.
+ *
+ * @retval  GOS_SUCCESS : Update successful.
+ * @retval  GOS_ERROR   : pContext or pData is NULL.
+ */
+gos_result_t drv_crcUpdateCrc8 (drv_crcContext8_t* pContext, u8_t* pData, u32_t dataSize);
+
+/**
+ * @brief   8-bit CRC stream finish.
+ * @details Returns the 8-bit CRC value of the data processed with the context so far.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ * @param   pCrc     : Variable to store the result in.
+ *
+ * @return  Result of finishing.
+ *
+ * @retval  GOS_SUCCESS : Calculation successful.
+ * @retval  GOS_ERROR   : pContext or pCrc is NULL.
+ */
+gos_result_t drv_crcFinishCrc8 (drv_crcContext8_t* pContext, u8_t* pCrc);
+
+/**
+ * @brief   16-bit CRC stream start.
+ * @details Initializes the context for a new 16-bit CRC calculation.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ *
+ * @return  Result of starting.
+ *
+ * @retval  GOS_SUCCESS : Context initialized.
+ * @retval  GOS_ERROR   : pContext is NULL.
+ */
+gos_result_t drv_crcStartCrc16  (drv_crcContext16_t* pContext);
+
+/**
+ * @brief   16-bit CRC stream update.
+ * @details Continues the 16-bit CRC calculation with the next chunk of data. Chunks can be
+ *          of arbitrary size, the result equals the CRC of the concatenated chunks.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ * @param   pData    : Pointer to the chunk.
+ * @param   dataSize : Size of the chunk.
+ *
+ * @return  Result of updating.
+ *
+ * @retval  GOS_SUCCESS : Update successful.
+ * @retval  GOS_ERROR   : pContext or pData is NULL.
+ */
+gos_result_t drv_crcUpdateCrc16 (drv_crcContext16_t* pContext, u8_t* pData, u32_t dataSize);
+
+/**
+ * @brief   16-bit CRC stream finish.
+ * @details Returns the 16-bit CRC value of the data processed with the context so far.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ * @param   pCrc     : Variable to store the result in.
+ *
+ * @return  Result of finishing.
+ *
+ * @retval  GOS_SUCCESS : Calculation successful.
+ * @retval  GOS_ERROR   : pContext or pCrc is NULL.
+ */
+gos_result_t drv_crcFinishCrc16 (drv_crcContext16_t* pContext, u16_t* pCrc);
+
+/**
+ * @brief   32-bit CRC stream start.
+ * @details Initializes the context for a new 32-bit CRC calculation.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ *
+ * @return  Result of starting.
+ *
+ * @retval  GOS_SUCCESS : Context initialized.
+ * @retval  GOS_ERROR   : pContext is NULL.
+ */
+gos_result_t drv_crcStartCrc32  (drv_crcContext32_t* pContext);
+
+/**
+ * @brief   32-bit CRC stream update.
+ * @details Continues the 32-bit CRC calculation with the next chunk of data. Chunks can be
+ *          of arbitrary size, the result equals the CRC of the concatenated chunks.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ * @param   pData    : Pointer to the chunk.
+ * @param   dataSize : Size of the chunk.
+ *
+ * @return  Result of updating.
+ *
+ * @retval  GOS_SUCCESS : Update successful.
+ * @retval  GOS_ERROR   : pContext or pData is NULL.
+ */
+gos_result_t drv_crcUpdateCrc32 (drv_crcContext32_t* pContext, u8_t* pData, u32_t dataSize);
+
+/**
+ * @brief   32-bit CRC stream finish.
+ * @details Returns the 32-bit CRC value of the data processed with the context so far.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ * @param   pCrc     : Variable to store the result in.
+ *
+ * @return  Result of finishing.
+ *
+ * @retval  GOS_SUCCESS : Calculation successful.
+ * @retval  GOS_ERROR   : pContext or pCrc is NULL.
+ */
+gos_result_t drv_crcFinishCrc32 (drv_crcContext32_t* pContext, u32_t* pCrc);
+
+/**
+ * @brief   64-bit CRC stream start.
+ * @details Initializes the context for a new 64-bit CRC calculation.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ *
+ * @return  Result of starting.
+ *
+ * @retval  GOS_SUCCESS : Context initialized.
+ * @retval  GOS_ERROR   : pContext is NULL.
+ */
+gos_result_t drv_crcStartCrc64  (drv_crcContext64_t* pContext);
+
+/**
+ * @brief   64-bit CRC stream update.
+ * @details Continues the 64-bit CRC calculation with the next chunk of data. Chunks can be
+ *          of arbitrary size, the result equals the CRC of the concatenated chunks.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ * @param   pData    : Pointer to the chunk.
+ * @param   dataSize : Size of the chunk.
+ *
+ * @return  Result of updating.
+ *
+ * @retval  GOS_SUCCESS : Update successful.
+ * @retval  GOS_ERROR   : pContext or pData is NULL.
+ */
+gos_result_t drv_crcUpdateCrc64 (drv_crcContext64_t* pContext, u8_t* pData, u32_t dataSize);
+
+/**
+ * @brief   64-bit CRC stream finish.
+ * @details Returns the 64-bit CRC value of the data processed with the context so far.
+ *
+ * @param   pContext : Pointer to the CRC context.
+ * @param   pCrc     : Variable to store the result in.
+ *
+ * @return  Result of finishing.
+ *
+ * @retval  GOS_SUCCESS : Calculation successful.
+ * @retval  GOS_ERROR   : pContext or pCrc is NULL.
+ */
+gos_result_t drv_crcFinishCrc64 (drv_crcContext64_t* pContext, u64_t* pCrc);
+
 /**
  * @brief   8-bit CRC checker.
  * @details Calculates the 8-bit CRC value on the given buffer and compares it with the
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       TODO
 //! @author     Ahmed Gazar
-//! @date       2024-04-24
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.4
 //!
 //! @brief      GOS2022 Library / TODO header.
 //! @details    TODO
@@ -25,6 +25,10 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-04-24    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    UART RX ring error flags added
+// 1.2        2026-10-19    Ahmed Gazar     +    UART segmented transmission error flags added
+// 1.3        2026-10-19    Ahmed Gazar     +    W25Q64 erase error flag added
+// 1.4        2026-10-19    Ahmed Gazar     +    SPI bus lock error flag added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -85,6 +89,13 @@
 #define DRV_ERROR_UART_RX_IT_HAL                  ( 1 << 16 )
 #define DRV_ERROR_UART_RX_IT_MUTEX                ( 1 << 17 )
 
+#define DRV_ERROR_UART_RX_RING_HAL                ( 1 << 18 )
+#define DRV_ERROR_UART_RX_RING_OVERFLOW           ( 1 << 19 )
+
+#define DRV_ERROR_UART_TX_SEG_TRIG                ( 1 << 20 )
+#define DRV_ERROR_UART_TX_SEG_HAL                 ( 1 << 21 )
+#define DRV_ERROR_UART_TX_SEG_MUTEX               ( 1 << 22 )
+
 
 #define DRV_ERROR_TMR_CFG_ARRAY_NULL              ( 1 << 0  )
 #define DRV_ERROR_TMR_INDEX_OUT_OF_BOUND          ( 1 << 1  )
@@ -125,6 +136,7 @@
 #define DRV_ERROR_SPI_TX_RX_DMA_TRIG              ( 1 << 25 )
 #define DRV_ERROR_SPI_TX_RX_DMA_HAL               ( 1 << 26 )
 #define DRV_ERROR_SPI_TX_RX_DMA_MUTEX             ( 1 << 27 )
+#define DRV_ERROR_SPI_BUS_LOCK                    ( 1 << 28 )
 
 #define DRV_ERROR_I2C_CFG_ARRAY_NULL              ( 1 << 0  )
 #define DRV_ERROR_I2C_INDEX_OUT_OF_BOUND          ( 1 << 1  )
@@ -184,6 +196,7 @@
 #define DRV_ERROR_W25Q64_MUTEX_LOCK               ( 1 << 2  )
 #define DRV_ERROR_W25Q64_READ                     ( 1 << 3  )
 #define DRV_ERROR_W25Q64_WRITE                    ( 1 << 4  )
+#define DRV_ERROR_W25Q64_ERASE                    ( 1 << 5  )
 
 
 #define DRV_ERROR_CHK_NULL_PTR(var, flags, error) ( { if (var == NULL) DRV_ERROR_SET(flags, error); } )
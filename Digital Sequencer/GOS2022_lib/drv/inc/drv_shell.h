@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_shell.h
 //! @author     Ahmed Gazar
-//! @date       2024-03-15
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.1
 //!
 //! @brief      GOS2022 Library / Shell driver header.
 //! @details    This component provides the implementation of shell functions that are used
@@ -26,6 +26,7 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-03-15    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    drv_shellReceiveBuffer added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -88,4 +89,23 @@ gos_result_t drv_shellTransmitString (char_t* pString);
  */
 gos_result_t drv_shellReceiveChar (char_t* pBuffer);
 
+/**
+ * @brief   Shell buffer receive function.
+ * @details This function starts the interrupt-driven RX ring of the configured
+ *          shell UART instance on the first call. It blocks until data arrives and
+ *          returns every buffered character. Shall not be mixed with
+ *          drv_shellReceiveChar.
+ *
+ * @param   pBuffer       : Buffer where the received characters are stored.
+ * @param   bufferSize    : Size of the buffer.
+ * @param   pReceivedSize : Number of received characters.
+ *
+ * @return  Result of reception.
+ *
+ * @retval  GOS_SUCCESS : Reception successful.
+ * @retval  GOS_ERROR   : Empty UART service configuration or low-level
+ *                        driver error.
+ */
+gos_result_t drv_shellReceiveBuffer (char_t* pBuffer, u16_t bufferSize, u16_t* pReceivedSize);
+
 #endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_spi.h
 //! @author     Ahmed Gazar
-//! @date       2025-07-24
-//! @version    1.1
+//! @date       2026-10-19
+//! @version    1.3
 //!
 //! @brief      GOS2022 Library / SPI driver header.
 //! @details    This component provides access to the SPI peripheries.
@@ -26,6 +26,8 @@
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-03-19    Ahmed Gazar     Initial version created.
 // 1.1        2025-07-24    Ahmed Gazar     +    Diagnostics implemented
+// 1.2        2026-10-19    Ahmed Gazar     +    drv_spiReceiveDMAWait added
+// 1.3        2026-10-19    Ahmed Gazar     +    drv_spiBusLock and drv_spiBusUnlock added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -196,12 +198,68 @@ gos_result_t drv_spiTransmitDMA (
         u16_t                   size,     u32_t mutexTmo, u32_t triggerTmo
         );
 
+/**
+ * @brief     Locks the SPI bus for the calling task.
+ * @details   Takes the instance mutex and keeps it until #drv_spiBusUnlock. While
+ *            the bus is locked, the transfer functions called by the same task
+ *            do not take or release the mutex, and the transfers of other tasks
+ *            wait. This way a device can keep its chip select low across several
+ *            transfers (including DMA transfers started with zero trigger timeout)
+ *            without another device clocking the bus in between.
+ *
+ * @param[in] instance SPI instance.
+ * @param[in] mutexTmo Mutex timeout [ms].
+ *
+ * @return    Result of locking.
+ *
+ * @retval    #GOS_SUCCESS Bus locked.
+ * @retval    #GOS_ERROR   Wrong instance or mutex timeout.
+ */
+gos_result_t drv_spiBusLock (
+        drv_spiPeriphInstance_t instance, u32_t mutexTmo
+        );
+
+/**
+ * @brief     Unlocks the SPI bus.
+ * @details   Releases a bus lock taken by #drv_spiBusLock. Only the task that
+ *            locked the bus can unlock it.
+ *
+ * @param[in] instance SPI instance.
+ *
+ * @return    Result of unlocking.
+ *
+ * @retval    #GOS_SUCCESS Bus unlocked.
+ * @retval    #GOS_ERROR   Wrong instance or the bus is not locked by the caller.
+ */
+gos_result_t drv_spiBusUnlock (
+        drv_spiPeriphInstance_t instance
+        );
+
 // TODO
 gos_result_t drv_spiReceiveDMA (
         drv_spiPeriphInstance_t instance, u8_t* pBuffer,
         u16_t                   size,     u32_t mutexTmo, u32_t triggerTmo
         );
 
+/**
+ * @brief     Waits for a started DMA reception to complete.
+ * @details   Completes a reception started by #drv_spiReceiveDMA with zero trigger
+ *            timeout. This way the caller can process data while the DMA fills
+ *            the buffer. Every such reception shall be completed by exactly one call.
+ *            On timeout the ongoing transfer is aborted.
+ *
+ * @param[in] instance   SPI instance.
+ * @param[in] triggerTmo Trigger timeout [ms].
+ *
+ * @return    Result of waiting.
+ *
+ * @retval    #GOS_SUCCESS Reception completed.
+ * @retval    #GOS_ERROR   Reception did not complete in time.
+ */
+gos_result_t drv_spiReceiveDMAWait (
+        drv_spiPeriphInstance_t instance, u32_t triggerTmo
+        );
+
 // TODO
 gos_result_t drv_spiTransmitReceiveBlocking (
         drv_spiPeriphInstance_t instance, u8_t* pTxData,  u8_t* pRxData,
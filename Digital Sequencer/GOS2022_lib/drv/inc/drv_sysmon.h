@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_sysmon.h
 //! @author     Ahmed Gazar
-//! @date       2024-03-15
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.2
 //!
 //! @brief      GOS2022 Library / Sysmon driver header.
 //! @details    This component provides the implementation of sysmon functions that are used
@@ -26,6 +26,10 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-03-15    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    Vectored transmit functions added
+// 1.2        2026-10-19    Ahmed Gazar     *    Wireless vectored transmit falls back to sequential
+//                                               transmissions
+//                                          +    Wireless function descriptions added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -90,10 +94,73 @@ gos_result_t drv_sysmonWiredTransmit (u8_t* pData, u16_t size);
  */
 gos_result_t drv_sysmonWiredReceive (u8_t* pBuffer, u16_t size);
 
-// TODO
+/**
+ * @brief   Sysmon vectored transmit function.
+ * @details This function uses the configured sysmon UART instance to
+ *          transmit the given segments as one transmission, directly
+ *          from the memory of the caller (mutex and trigger are used).
+ *
+ * @param   pSegments    : Segments to be transmitted.
+ * @param   segmentCount : Number of segments.
+ *
+ * @return  Result of transmission.
+ *
+ * @retval  GOS_SUCCESS : Transmit successful.
+ * @retval  GOS_ERROR   : Empty UART service configuration, too many
+ *                        segments or low-level driver error.
+ */
+gos_result_t drv_sysmonWiredTransmitVector (gos_gcpSegment_t* pSegments, u8_t segmentCount);
+
+/**
+ * @brief   Sysmon wireless transmit function.
+ * @details This function uses the configured wireless sysmon UART instance
+ *          to transmit the given data bytes ensuring safe access to the
+ *          periphery (mutex and trigger are used).
+ *
+ * @param   pData : Data bytes to be transmitted.
+ * @param   size  : Size of data.
+ *
+ * @return  Result of transmission.
+ *
+ * @retval  GOS_SUCCESS : Transmit successful.
+ * @retval  GOS_ERROR   : Empty UART service configuration or low-level
+ *                        driver error.
+ */
 gos_result_t drv_sysmonWirelessTransmit (u8_t* pData, u16_t size);
 
-// TODO
+/**
+ * @brief   Sysmon wireless vectored transmit function.
+ * @details This function transmits the given segments one after the other
+ *          by #drv_sysmonWirelessTransmit (empty segments are skipped).
+ *          The segments are not sent as one transmission, the caller
+ *          shall serialize the frames on the wireless link.
+ *
+ * @param   pSegments    : Segments to be transmitted.
+ * @param   segmentCount : Number of segments.
+ *
+ * @return  Result of transmission.
+ *
+ * @retval  GOS_SUCCESS : All segments transmitted.
+ * @retval  GOS_ERROR   : Segment array is NULL or transmission of a
+ *                        segment failed (the rest is not sent).
+ */
+gos_result_t drv_sysmonWirelessTransmitVector (gos_gcpSegment_t* pSegments, u8_t segmentCount);
+
+/**
+ * @brief   Sysmon wireless receive function.
+ * @details This function uses the configured wireless sysmon UART instance
+ *          to receive data ensuring safe access to the periphery (mutex
+ *          and trigger are used).
+ *
+ * @param   pBuffer : Buffer where the received data is stored.
+ * @param   size    : Size of the receive buffer.
+ *
+ * @return  Result of reception.
+ *
+ * @retval  GOS_SUCCESS : Reception successful.
+ * @retval  GOS_ERROR   : Empty UART service configuration or low-level
+ *                        driver error.
+ */
 gos_result_t drv_sysmonWirelessReceive (u8_t* pBuffer, u16_t size);
 
 #endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_trace.h
 //! @author     Ahmed Gazar
-//! @date       2024-03-15
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.1
 //!
 //! @brief      GOS2022 Library / Trace driver header.
 //! @details    This component provides the implementation of trace functions that are used
@@ -26,6 +26,7 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-03-15    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    drv_traceTransmitBinary added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -91,6 +92,26 @@ gos_result_t drv_traceTransmit (
 		char_t* pMessage
 		);
 
+/**
+ * @brief   Safe trace binary transmit function.
+ * @details This function uses the configured trace UART instance to
+ *          transmit the given binary data in DMA mode ensuring safe access
+ *          to the periphery (mutex and trigger are used).
+ *
+ * @param   pData Pointer to the data to be transmitted.
+ * @param   size  Size of the data [byte].
+ *
+ * @return  Result of transmission.
+ *
+ * @retval  #GOS_SUCCESS Transmit successful.
+ * @retval  #GOS_ERROR   Empty UART service configuration or low-level
+ *                       driver error.
+ */
+gos_result_t drv_traceTransmitBinary (
+		u8_t* pData,
+		u16_t size
+		);
+
 // TODO
 gos_result_t drv_traceEnqueueTraceMessage (
 		GOS_CONST char_t* message,
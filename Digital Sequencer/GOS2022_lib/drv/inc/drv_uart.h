@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_uart.h
 //! @author     Ahmed Gazar
-//! @date       2025-07-23
-//! @version    1.3
+//! @date       2026-10-19
+//! @version    1.5
 //!
 //! @brief      GOS2022 Library / UART driver header.
 //! @details    This component provides access to the UART peripheries.
@@ -30,6 +30,8 @@
 // 1.3        2025-07-23    Ahmed Gazar     +    drv_uartDiag_t and drv_uartGetDiagData added
 //                                          -    drv_uartGetErrorFlags and drv_uartClearErrorFlags
 //                                               removed
+// 1.4        2026-10-19    Ahmed Gazar     +    drv_uartRxRingStart and drv_uartRxRingRead added
+// 1.5        2026-10-19    Ahmed Gazar     +    drv_uartSegment_t and drv_uartTransmitSegments added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -59,6 +61,14 @@
 #include <gos.h>
 #include <drv_dma.h>
 
+/*
+ * Macros
+ */
+/**
+ * Maximum number of segments of a segmented transmission.
+ */
+#define DRV_UART_TX_SEGMENTS_MAX ( 4u )
+
 /*
  * Type definitions
  */
@@ -105,6 +115,15 @@ typedef struct
     drv_dmaDescriptor_t*     dmaConfigTx;    //!< TX DMA configuration.
 }drv_uartDescriptor_t;
 
+/**
+ * UART transmit segment type.
+ */
+typedef struct
+{
+    u8_t* pData;                             //!< Segment data.
+    u16_t size;                              //!< Segment size.
+}drv_uartSegment_t;
+
 /**
  * UART service timeout configuration type.
  */
@@ -242,4 +261,71 @@ gos_result_t drv_uartReceiveIT (
         u32_t                    triggerTmo
         );
 
+/**
+ * @brief     Transmits a list of segments as one transmission.
+ * @details   The segments are sent back to back: the TX complete interrupt of a segment
+ *            starts the next one (by DMA if the instance has a TX DMA, otherwise
+ *            interrupt-driven), and the caller is woken up once, when the last segment
+ *            is sent. Empty segments are skipped.
+ *
+ * @param[in] instance     UART periphery instance.
+ * @param[in] pSegments    Segment list (copied, the data shall be kept until the call returns).
+ * @param[in] segmentCount Number of segments (up to #DRV_UART_TX_SEGMENTS_MAX).
+ * @param[in] mutexTmo     Mutex lock timeout.
+ * @param[in] triggerTmo   Trigger wait timeout.
+ *
+ * @return    Result of transmission.
+ *
+ * @retval    #GOS_SUCCESS All segments transmitted.
+ * @retval    #GOS_ERROR   Invalid parameters, mutex, HAL or trigger error.
+ */
+gos_result_t drv_uartTransmitSegments (
+        drv_uartPeriphInstance_t instance,     drv_uartSegment_t* pSegments,
+        u8_t                     segmentCount, u32_t              mutexTmo,
+        u32_t                    triggerTmo
+        );
+
+/**
+ * @brief     Starts continuous interrupt-driven reception into a ring buffer.
+ * @details   Every received byte is placed in the given ring buffer from the RX
+ *            complete interrupt and the RX ready trigger is incremented. The reception
+ *            is restarted after errors. While the ring is active, the other receive
+ *            functions shall not be used on the instance.
+ *
+ * @param[in] instance    UART periphery instance.
+ * @param[in] pRingBuffer Ring buffer (owned by the driver after the call).
+ * @param[in] ringSize    Size of the ring buffer.
+ *
+ * @return    Result of reception start.
+ *
+ * @retval    #GOS_SUCCESS Reception started.
+ * @retval    #GOS_ERROR   Invalid instance, buffer NULL pointer, size below 2 or HAL error.
+ */
+gos_result_t drv_uartRxRingStart (
+        drv_uartPeriphInstance_t instance,  u8_t* pRingBuffer,
+        u16_t                    ringSize
+        );
+
+/**
+ * @brief      Reads every buffered byte from the RX ring.
+ * @details    If the ring is empty, it waits for the RX ready trigger until the given
+ *             timeout, then copies the available bytes (up to the given size).
+ *
+ * @param[in]  instance   UART periphery instance.
+ * @param[out] pData      Buffer to store the bytes in.
+ * @param[in]  size       Size of the buffer.
+ * @param[out] pReadSize  Number of bytes read (0 on timeout).
+ * @param[in]  triggerTmo Trigger wait timeout.
+ *
+ * @return     Result of reading.
+ *
+ * @retval     #GOS_SUCCESS Reading successful (even if no data arrived).
+ * @retval     #GOS_ERROR   Invalid instance, ring not started or NULL pointer.
+ */
+gos_result_t drv_uartRxRingRead (
+        drv_uartPeriphInstance_t instance,  u8_t*  pData,
+        u16_t                    size,      u16_t* pReadSize,
+        u32_t                    triggerTmo
+        );
+
 #endif
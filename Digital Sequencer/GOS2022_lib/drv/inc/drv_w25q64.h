@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_w25q64.h
 //! @author     Ahmed Gazar
-//! @date       2024-12-24
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.4
 //!
 //! @brief      GOS2022 Library / W25Q64 driver header.
 //! @details    This component provides the interface for the W25Q64 EEPROM chip.
@@ -25,6 +25,11 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-12-24    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    drv_w25q64EraseData and drv_w25q64ProgramData added
+// 1.2        2026-10-19    Ahmed Gazar     +    Read stream functions added
+//                                          +    useDma and streamPending descriptor fields added
+// 1.3        2026-10-19    Ahmed Gazar     *    drv_w25q64EraseData description updated
+// 1.4        2026-10-19    Ahmed Gazar     *    Read stream descriptions updated (SPI bus lock)
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -82,6 +87,8 @@ typedef struct
     u32_t                   writeMutexTmo;   //!< Write mutex timeout [ms].
     u32_t                   writeTriggerTmo; //!< Write trigger timeout [ms].
     u32_t                   errorFlags;      //!< Error flags of the device [ms].
+    bool_t                  useDma;          //!< Receive data via DMA (SPI RX and TX DMA needed).
+    bool_t                  streamPending;   //!< Read stream reception in progress (internal).
 }drv_w25q64Descriptor_t;
 
 /*
@@ -162,7 +169,9 @@ void_t drv_w25q64ReadData (void_t* pDevice, u32_t address, u8_t* pData, u32_t si
 /**
  * @brief   Writes to the device.
  * @details Writes the given number of bytes from the given buffer starting
- *          at the given address to the given device.
+ *          at the given address to the given device. The target bytes are
+ *          programmed directly if they are erased (or the data only clears
+ *          bits), and a sector is only erased and rewritten if needed.
  *
  * @param   pDevice : Pointer to the device descriptor structure.
  * @param   address : Address to start writing at.
@@ -176,4 +185,78 @@ void_t drv_w25q64ReadData (void_t* pDevice, u32_t address, u8_t* pData, u32_t si
  */
 void_t drv_w25q64WriteData (void_t* pDevice, u32_t address, /*u32_t startPage, u8_t offset,*/ u8_t* pData, u32_t size);
 
+/**
+ * @brief   Erases an area of the device.
+ * @details Erases the sectors that are entirely within the given area, so data
+ *          sharing the first and last sector with the area is kept. Aligned 64 kB
+ *          blocks within the area are erased with a single block erase. Intended to
+ *          prepare an area for sequential writing. Sets DRV_ERROR_W25Q64_ERASE if
+ *          the chip does not finish an erase in time.
+ *
+ * @param   pDevice : Pointer to the device descriptor structure.
+ * @param   address : Start address of the area.
+ * @param   size    : Size of the area in bytes.
+ *
+ * @return  -
+ */
+void_t drv_w25q64EraseData (void_t* pDevice, u32_t address, u32_t size);
+
+/**
+ * @brief   Programs erased area of the device.
+ * @details Programs the given data page by page without reading or erasing
+ *          the target area (see #drv_w25q64EraseData).
+ *
+ * @param   pDevice : Pointer to the device descriptor structure.
+ * @param   address : Address to start programming at.
+ * @param   pData   : Data buffer.
+ * @param   size    : Number of bytes to program.
+ *
+ * @return  -
+ */
+void_t drv_w25q64ProgramData (void_t* pDevice, u32_t address, u8_t* pData, u32_t size);
+
+/**
+ * @brief   Starts a continuous read from the device.
+ * @details Locks the device, sends a single fast read command for the given
+ *          address and starts filling the first buffer. The following buffers
+ *          are filled with the consecutive bytes by #drv_w25q64ReadStreamNext.
+ *          With DMA enabled a buffer (of at most 32 kB) is filled in the
+ *          background, so the caller can process the previous one meanwhile.
+ *          The device and the SPI bus (see #drv_spiBusLock) are locked until
+ *          #drv_w25q64ReadStreamStop is called, so other devices on the bus
+ *          cannot be accessed while chip select is low.
+ *
+ * @param   pDevice : Pointer to the device descriptor structure.
+ * @param   address : Address to start reading from.
+ * @param   pData   : First buffer to fill.
+ * @param   size    : Number of bytes to read into the first buffer.
+ *
+ * @return  -
+ */
+void_t drv_w25q64ReadStreamStart (void_t* pDevice, u32_t address, u8_t* pData, u32_t size);
+
+/**
+ * @brief   Continues a read stream.
+ * @details Waits until the buffer given in the previous call is filled, then
+ *          starts filling the given buffer with the next bytes.
+ *
+ * @param   pDevice : Pointer to the device descriptor structure.
+ * @param   pData   : Next buffer to fill.
+ * @param   size    : Number of bytes to read into the next buffer.
+ *
+ * @return  -
+ */
+void_t drv_w25q64ReadStreamNext (void_t* pDevice, u8_t* pData, u32_t size);
+
+/**
+ * @brief   Stops a read stream.
+ * @details Waits until the last buffer is filled and releases the SPI bus
+ *          and the device.
+ *
+ * @param   pDevice : Pointer to the device descriptor structure.
+ *
+ * @return  -
+ */
+void_t drv_w25q64ReadStreamStop (void_t* pDevice);
+
 #endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_crc.c
 //! @author     Ahmed Gazar
-//! @date       2024-02-01
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.3
 //!
 //! @brief      GOS2022 Library / Cyclic Redundancy Check driver source.
 //! @details    For a more detailed description of this driver, please refer to
@@ -26,6 +26,10 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-02-01    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    Table-driven and slice-by-4/8 CRC calculation added
+// 1.2        2026-10-19    Ahmed Gazar     +    Hardware CRC unit backend with software fallback added
+//                                          +    drv_crcInit added
+// 1.3        2026-10-19    Ahmed Gazar     +    Streaming CRC API (start/update/finish) added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -50,6 +54,9 @@
  * Includes
  */
 #include <drv_crc.h>
+#if DRV_CRC_BACKEND == DRV_CRC_BACKEND_HARDWARE
+#include "stm32f4xx_hal.h"
+#endif
 
 /*
  * Macros
@@ -105,6 +112,412 @@
  */
 #define DRV_CRC_POLYNOMIAL_CRC64    ( 0x3A7FF201D298EE14u )
 
+#if (DRV_CRC_BACKEND == DRV_CRC_BACKEND_HARDWARE) && \
+    (DRV_CRC_POLYNOMIAL_CRC32 == 0x04C11DB7u) && (DRV_CRC_INIT_VALUE_CRC32 == 0xFFFFFFFFu)
+/**
+ * 32-bit CRC hardware support flag. The CRC unit uses the same polynomial and initial value
+ * without reflection, and a 32-bit word written to it shifts the whole register, just like
+ * one byte step of the software algorithm.
+ */
+#define DRV_CRC_HW_CRC32            ( 1 )
+#else
+/**
+ * 32-bit CRC hardware support flag.
+ */
+#define DRV_CRC_HW_CRC32            ( 0 )
+#endif
+
+/**
+ * Minimum buffer size to use the hardware unit for (below this the software engine is faster
+ * than locking and resetting the unit).
+ */
+#define DRV_CRC_HW_MIN_SIZE         ( 16u )
+
+/**
+ * Number of bytes processed in one slice by the 8-bit CRC calculation.
+ */
+#define DRV_CRC_SLICE_CRC8          ( DRV_CRC_METHOD_CRC8  )
+/**
+ * Number of bytes processed in one slice by the 16-bit CRC calculation.
+ */
+#define DRV_CRC_SLICE_CRC16         ( DRV_CRC_METHOD_CRC16 )
+/**
+ * Number of bytes processed in one slice by the 32-bit CRC calculation.
+ */
+#define DRV_CRC_SLICE_CRC32         ( DRV_CRC_METHOD_CRC32 )
+/**
+ * Number of bytes processed in one slice by the 64-bit CRC calculation.
+ */
+#define DRV_CRC_SLICE_CRC64         ( DRV_CRC_METHOD_CRC64 )
+
+/**
+ * Lookup table entry generator. Entry a of a table is the XOR of the basis values selected
+ * by the set bits of a (a * X^m mod polynomial for the basis of X^m).
+ */
+#define DRV_CRC_TABLE_ENTRY(a, b0, b1, b2, b3, b4, b5, b6, b7)                                  \
+    ( (((a) & 0x01u) ? (b0) : 0u) ^ (((a) & 0x02u) ? (b1) : 0u) ^                              \
+      (((a) & 0x04u) ? (b2) : 0u) ^ (((a) & 0x08u) ? (b3) : 0u) ^                              \
+      (((a) & 0x10u) ? (b4) : 0u) ^ (((a) & 0x20u) ? (b5) : 0u) ^                              \
+      (((a) & 0x40u) ? (b6) : 0u) ^ (((a) & 0x80u) ? (b7) : 0u) )
+/**
+ * Lookup table generator for 4 consecutive entries.
+ */
+#define DRV_CRC_TABLE_ROW4(a, ...)                                                              \
+    DRV_CRC_TABLE_ENTRY((a), __VA_ARGS__),         DRV_CRC_TABLE_ENTRY((a) + 1u, __VA_ARGS__), \
+    DRV_CRC_TABLE_ENTRY((a) + 2u, __VA_ARGS__),    DRV_CRC_TABLE_ENTRY((a) + 3u, __VA_ARGS__)
+/**
+ * Lookup table generator for 16 consecutive entries.
+ */
+#define DRV_CRC_TABLE_ROW16(a, ...)                                                             \
+    DRV_CRC_TABLE_ROW4((a), __VA_ARGS__),          DRV_CRC_TABLE_ROW4((a) + 4u, __VA_ARGS__),  \
+    DRV_CRC_TABLE_ROW4((a) + 8u, __VA_ARGS__),     DRV_CRC_TABLE_ROW4((a) + 12u, __VA_ARGS__)
+/**
+ * Lookup table generator for 64 consecutive entries.
+ */
+#define DRV_CRC_TABLE_ROW64(a, ...)                                                             \
+    DRV_CRC_TABLE_ROW16((a), __VA_ARGS__),         DRV_CRC_TABLE_ROW16((a) + 16u, __VA_ARGS__),\
+    DRV_CRC_TABLE_ROW16((a) + 32u, __VA_ARGS__),   DRV_CRC_TABLE_ROW16((a) + 48u, __VA_ARGS__)
+/**
+ * Lookup table generator for a complete 256-entry table.
+ */
+#define DRV_CRC_TABLE(...)                                                                      \
+    DRV_CRC_TABLE_ROW64(0u, __VA_ARGS__),          DRV_CRC_TABLE_ROW64(64u, __VA_ARGS__),      \
+    DRV_CRC_TABLE_ROW64(128u, __VA_ARGS__),        DRV_CRC_TABLE_ROW64(192u, __VA_ARGS__)
+
+/**
+ * 8-bit CRC basis values (X^m ... X^(m+7) mod polynomial) for table generation.
+ */
+#define DRV_CRC_BASIS_CRC8_X8            0x07u, 0x0Eu, 0x1Cu, 0x38u, 0x70u, 0xE0u, 0xC7u, 0x89u
+#define DRV_CRC_BASIS_CRC8_X16           0x15u, 0x2Au, 0x54u, 0xA8u, 0x57u, 0xAEu, 0x5Bu, 0xB6u
+#define DRV_CRC_BASIS_CRC8_X24           0x6Bu, 0xD6u, 0xABu, 0x51u, 0xA2u, 0x43u, 0x86u, 0x0Bu
+#define DRV_CRC_BASIS_CRC8_X32           0x16u, 0x2Cu, 0x58u, 0xB0u, 0x67u, 0xCEu, 0x9Bu, 0x31u
+#define DRV_CRC_BASIS_CRC8_X40           0x62u, 0xC4u, 0x8Fu, 0x19u, 0x32u, 0x64u, 0xC8u, 0x97u
+#define DRV_CRC_BASIS_CRC8_X48           0x29u, 0x52u, 0xA4u, 0x4Fu, 0x9Eu, 0x3Bu, 0x76u, 0xECu
+#define DRV_CRC_BASIS_CRC8_X56           0xDFu, 0xB9u, 0x75u, 0xEAu, 0xD3u, 0xA1u, 0x45u, 0x8Au
+#define DRV_CRC_BASIS_CRC8_X64           0x13u, 0x26u, 0x4Cu, 0x98u, 0x37u, 0x6Eu, 0xDCu, 0xBFu
+
+/**
+ * 16-bit CRC basis values (X^m ... X^(m+7) mod polynomial) for table generation.
+ */
+#define DRV_CRC_BASIS_CRC16_X16          0x8005u, 0x800Fu, 0x801Bu, 0x8033u, 0x8063u, 0x80C3u, 0x8183u, 0x8303u
+#define DRV_CRC_BASIS_CRC16_X32          0x8017u, 0x802Bu, 0x8053u, 0x80A3u, 0x8143u, 0x8283u, 0x8503u, 0x8A03u
+#define DRV_CRC_BASIS_CRC16_X48          0x807Bu, 0x80F3u, 0x81E3u, 0x83C3u, 0x8783u, 0x8F03u, 0x9E03u, 0xBC03u
+#define DRV_CRC_BASIS_CRC16_X64          0x8113u, 0x8223u, 0x8443u, 0x8883u, 0x9103u, 0xA203u, 0xC403u, 0x0803u
+#define DRV_CRC_BASIS_CRC16_X72          0x1006u, 0x200Cu, 0x4018u, 0x8030u, 0x8065u, 0x80CFu, 0x819Bu, 0x8333u
+#define DRV_CRC_BASIS_CRC16_X80          0x8663u, 0x8CC3u, 0x9983u, 0xB303u, 0xE603u, 0x4C03u, 0x9806u, 0xB009u
+#define DRV_CRC_BASIS_CRC16_X96          0x9543u, 0xAA83u, 0xD503u, 0x2A03u, 0x5406u, 0xA80Cu, 0xD01Du, 0x203Fu
+#define DRV_CRC_BASIS_CRC16_X112         0xFF83u, 0x7F03u, 0xFE06u, 0x7C09u, 0xF812u, 0x7021u, 0xE042u, 0x4081u
+#define DRV_CRC_BASIS_CRC16_X128         0x0106u, 0x020Cu, 0x0418u, 0x0830u, 0x1060u, 0x20C0u, 0x4180u, 0x8300u
+#define DRV_CRC_BASIS_CRC16_X136         0x8605u, 0x8C0Fu, 0x981Bu, 0xB033u, 0xE063u, 0x40C3u, 0x8186u, 0x8309u
+
+/**
+ * 32-bit CRC basis values (X^m ... X^(m+7) mod polynomial) for table generation.
+ */
+#define DRV_CRC_BASIS_CRC32_X32          0x04C11DB7u, 0x09823B6Eu, 0x130476DCu, 0x2608EDB8u, \
+                                         0x4C11DB70u, 0x9823B6E0u, 0x34867077u, 0x690CE0EEu
+#define DRV_CRC_BASIS_CRC32_X64          0x490D678Du, 0x921ACF1Au, 0x20F48383u, 0x41E90706u, \
+                                         0x83D20E0Cu, 0x036501AFu, 0x06CA035Eu, 0x0D9406BCu
+#define DRV_CRC_BASIS_CRC32_X96          0xF200AA66u, 0xE0C0497Bu, 0xC5418F41u, 0x8E420335u, \
+                                         0x18451BDDu, 0x308A37BAu, 0x61146F74u, 0xC228DEE8u
+#define DRV_CRC_BASIS_CRC32_X128         0xE8A45605u, 0xD589B1BDu, 0xAFD27ECDu, 0x5B65E02Du, \
+                                         0xB6CBC05Au, 0x69569D03u, 0xD2AD3A06u, 0xA19B69BBu
+#define DRV_CRC_BASIS_CRC32_X136         0x47F7CEC1u, 0x8FEF9D82u, 0x1B1E26B3u, 0x363C4D66u, \
+                                         0x6C789ACCu, 0xD8F13598u, 0xB5237687u, 0x6E87F0B9u
+#define DRV_CRC_BASIS_CRC32_X144         0xDD0FE172u, 0xBEDEDF53u, 0x797CA311u, 0xF2F94622u, \
+                                         0xE13391F3u, 0xC6A63E51u, 0x898D6115u, 0x17DBDF9Du
+#define DRV_CRC_BASIS_CRC32_X152         0x2FB7BF3Au, 0x5F6F7E74u, 0xBEDEFCE8u, 0x797CE467u, \
+                                         0xF2F9C8CEu, 0xE1328C2Bu, 0xC6A405E1u, 0x89891675u
+#define DRV_CRC_BASIS_CRC32_X160         0x17D3315Du, 0x2FA662BAu, 0x5F4CC574u, 0xBE998AE8u, \
+                                         0x79F20867u, 0xF3E410CEu, 0xE3093C2Bu, 0xC2D365E1u
+#define DRV_CRC_BASIS_CRC32_X192         0xC5B9CD4Cu, 0x8FB2872Fu, 0x1BA413E9u, 0x374827D2u, \
+                                         0x6E904FA4u, 0xDD209F48u, 0xBE802327u, 0x79C15BF9u
+#define DRV_CRC_BASIS_CRC32_X224         0xCD8C54B5u, 0x9FD9B4DDu, 0x3B72740Du, 0x76E4E81Au, \
+                                         0xEDC9D034u, 0xDF52BDDFu, 0xBA646609u, 0x7009D1A5u
+#define DRV_CRC_BASIS_CRC32_X256         0x75BE46B7u, 0xEB7C8D6Eu, 0xD238076Bu, 0xA0B11361u, \
+                                         0x45A33B75u, 0x8B4676EAu, 0x124DF063u, 0x249BE0C6u
+#define DRV_CRC_BASIS_CRC32_X264         0x4937C18Cu, 0x926F8318u, 0x201E1B87u, 0x403C370Eu, \
+                                         0x80786E1Cu, 0x0431C18Fu, 0x0863831Eu, 0x10C7063Cu
+#define DRV_CRC_BASIS_CRC32_X272         0x218E0C78u, 0x431C18F0u, 0x863831E0u, 0x08B17E77u, \
+                                         0x1162FCEEu, 0x22C5F9DCu, 0x458BF3B8u, 0x8B17E770u
+#define DRV_CRC_BASIS_CRC32_X280         0x12EED357u, 0x25DDA6AEu, 0x4BBB4D5Cu, 0x97769AB8u, \
+                                         0x2A2C28C7u, 0x5458518Eu, 0xA8B0A31Cu, 0x55A05B8Fu
+
+/**
+ * 64-bit CRC basis values (X^m ... X^(m+7) mod polynomial) for table generation.
+ */
+#define DRV_CRC_BASIS_CRC64_X64          0x3A7FF201D298EE14u, 0x74FFE403A531DC28u, 0xE9FFC8074A63B850u, 0xE980620F465F9EB4u, \
+                                         0xE97F361F5E27D37Cu, 0xE8819E3F6ED748ECu, 0xEB7CCE7F0F367FCCu, 0xEC866EFFCCF4118Cu
+#define DRV_CRC_BASIS_CRC64_X128         0x7AB4D202F60C5E18u, 0xF569A405EC18BC30u, 0xD0ACBA0A0AA99674u, 0x9B268615C7CBC2FCu, \
+                                         0x0C32FE2A5D0F6BECu, 0x1865FC54BA1ED7D8u, 0x30CBF8A9743DAFB0u, 0x6197F152E87B5F60u
+#define DRV_CRC_BASIS_CRC64_X192         0x2ED1CCF4D8069A6Cu, 0x5DA399E9B00D34D8u, 0xBB4733D3601A69B0u, 0x4CF195A712AC3D74u, \
+                                         0x99E32B4E25587AE8u, 0x09B9A49D98281BC4u, 0x1373493B30503788u, 0x26E6927660A06F10u
+#define DRV_CRC_BASIS_CRC64_X256         0x844D1E162E500E0Cu, 0x32E5CE2D8E38F20Cu, 0x65CB9C5B1C71E418u, 0xCB9738B638E3C830u, \
+                                         0xAD51836DA35F7E74u, 0x60DCF4DA942612FCu, 0xC1B9E9B5284C25F8u, 0xB90C216B8200A5E4u
+#define DRV_CRC_BASIS_CRC64_X264         0x4867B0D6D699A5DCu, 0x90CF61ADAD334BB8u, 0x1BE1315A88FE7964u, 0x37C262B511FCF2C8u, \
+                                         0x6F84C56A23F9E590u, 0xDF098AD447F3CB20u, 0x846CE7A95D7F7854u, 0x32A63D5368661EBCu
+#define DRV_CRC_BASIS_CRC64_X272         0x654C7AA6D0CC3D78u, 0xCA98F54DA1987AF0u, 0xAF4E189A91A81BF4u, 0x64E3C334F1C8D9FCu, \
+                                         0xC9C78669E391B3F8u, 0xA9F0FED215BB89E4u, 0x699E0FA5F9EFFDDCu, 0xD33C1F4BF3DFFBB8u
+#define DRV_CRC_BASIS_CRC64_X280         0x9C07CC9635271964u, 0x02706B2DB8D6DCDCu, 0x04E0D65B71ADB9B8u, 0x09C1ACB6E35B7370u, \
+                                         0x1383596DC6B6E6E0u, 0x2706B2DB8D6DCDC0u, 0x4E0D65B71ADB9B80u, 0x9C1ACB6E35B73700u
+#define DRV_CRC_BASIS_CRC64_X288         0x024A64DDB9F68014u, 0x0494C9BB73ED0028u, 0x09299376E7DA0050u, 0x125326EDCFB400A0u, \
+                                         0x24A64DDB9F680140u, 0x494C9BB73ED00280u, 0x9299376E7DA00500u, 0x1F4D9CDD29D8E414u
+#define DRV_CRC_BASIS_CRC64_X296         0x3E9B39BA53B1C828u, 0x7D367374A7639050u, 0xFA6CE6E94EC720A0u, 0xCEA63FD34F16AF54u, \
+                                         0xA7338DA74CB5B0BCu, 0x7418E94F4BF38F6Cu, 0xE831D29E97E71ED8u, 0xEA1C573CFD56D3A4u
+#define DRV_CRC_BASIS_CRC64_X304         0xEE475C782835495Cu, 0xE6F14AF182F27CACu, 0xF79D67E2D77C174Cu, 0xD5453DC47C60C08Cu, \
+                                         0x90F589892A596F0Cu, 0x1B94E113862A300Cu, 0x3729C2270C546018u, 0x6E53844E18A8C030u
+#define DRV_CRC_BASIS_CRC64_X312         0xDCA7089C31518060u, 0x8331E339B03BEED4u, 0x3C1C3472B2EF33BCu, 0x783868E565DE6778u, \
+                                         0xF070D1CACBBCCEF0u, 0xDA9E519445E173F4u, 0x8F435129595A09FCu, 0x24F95053602CFDECu
+#define DRV_CRC_BASIS_CRC64_X320         0x49F2A0A6C059FBD8u, 0x93E5414D80B3F7B0u, 0x1DB5709AD3FF0174u, 0x3B6AE135A7FE02E8u, \
+                                         0x76D5C26B4FFC05D0u, 0xEDAB84D69FF80BA0u, 0xE128FBACED68F954u, 0xF82E055808491CBCu
+#define DRV_CRC_BASIS_CRC64_X384         0x8ADAEBBA8F6893C8u, 0x2FCA2574CC49C984u, 0x5F944AE998939308u, 0xBF2895D331272610u, \
+                                         0x442ED9A7B0D6A234u, 0x885DB34F61AD4468u, 0x2AC4949F11C266C4u, 0x5589293E2384CD88u
+#define DRV_CRC_BASIS_CRC64_X448         0xBD263BE51818EEF4u, 0x403385CBE2A933FCu, 0x80670B97C55267F8u, 0x3AB1E52E583C21E4u, \
+                                         0x7563CA5CB07843C8u, 0xEAC794B960F08790u, 0xEFF0DB731379E134u, 0xE59E44E7F46B2C7Cu
+#define DRV_CRC_BASIS_CRC64_X512         0xBE392CDF1176E738u, 0x460DABBFF0752064u, 0x8C1B577FE0EA40C8u, 0x22495CFE134C6F84u, \
+                                         0x4492B9FC2698DF08u, 0x892573F84D31BE10u, 0x283515F148FB9234u, 0x506A2BE291F72468u
+#define DRV_CRC_BASIS_CRC64_X520         0xA0D457C523EE48D0u, 0x7BD75D8B95447FB4u, 0xF7AEBB172A88FF68u, 0xD522842F878910C4u, \
+                                         0x903AFA5EDD8ACF9Cu, 0x1A0A06BC698D712Cu, 0x34140D78D31AE258u, 0x68281AF1A635C4B0u
+#define DRV_CRC_BASIS_CRC64_X528         0xD05035E34C6B8960u, 0x9ADF99C74A4FFCD4u, 0x0FC0C18F460717BCu, 0x1F81831E8C0E2F78u, \
+                                         0x3F03063D181C5EF0u, 0x7E060C7A3038BDE0u, 0xFC0C18F460717BC0u, 0xC267C3E9127A1994u
+#define DRV_CRC_BASIS_CRC64_X536         0xBEB075D3F66CDD3Cu, 0x471F19A63E41546Cu, 0x8E3E334C7C82A8D8u, 0x260394992B9DBFA4u, \
+                                         0x4C072932573B7F48u, 0x980E5264AE76FE90u, 0x0A6356C88E751334u, 0x14C6AD911CEA2668u
+#define DRV_CRC_BASIS_CRC64_X544         0x298D5B2239D44CD0u, 0x531AB64473A899A0u, 0xA6356C88E7513340u, 0x76152B101C3A8894u, \
+                                         0xEC2A562038751128u, 0xE22B5E41A272CC44u, 0xFE294E82967D769Cu, 0xC62D6F04FE62032Cu
+#define DRV_CRC_BASIS_CRC64_X552         0xB6252C082E5CE84Cu, 0x5635AA118E213E8Cu, 0xAC6B54231C427D18u, 0x62A95A47EA1C1424u, \
+                                         0xC552B48FD4382848u, 0xB0DA9B1E7AE8BE84u, 0x5BCAC43D2749931Cu, 0xB795887A4E932638u
+#define DRV_CRC_BASIS_CRC64_X560         0x5554E2F54FBEA264u, 0xAAA9C5EA9F7D44C8u, 0x6F2C79D4EC626784u, 0xDE58F3A9D8C4CF08u, \
+                                         0x86CE155263117004u, 0x37E3D8A514BA0E1Cu, 0x6FC7B14A29741C38u, 0xDF8F629452E83870u
+#define DRV_CRC_BASIS_CRC64_X568         0x8561372977489EF4u, 0x30BD9C533C09D3FCu, 0x617B38A67813A7F8u, 0xC2F6714CF0274FF0u, \
+                                         0xBF93109832D671F4u, 0x4559D331B7340DFCu, 0x8AB3A6636E681BF8u, 0x2F18BEC70E48D9E4u
+
+/*
+ * Configuration checks
+ */
+#if (DRV_CRC_METHOD_CRC8  != DRV_CRC_METHOD_BITWISE) && (DRV_CRC_METHOD_CRC8  != DRV_CRC_METHOD_TABLE) && \
+    (DRV_CRC_METHOD_CRC8  != DRV_CRC_METHOD_SLICE4)  && (DRV_CRC_METHOD_CRC8  != DRV_CRC_METHOD_SLICE8)
+#error "DRV_CRC_METHOD_CRC8: invalid CRC calculation method."
+#endif
+#if (DRV_CRC_METHOD_CRC16 != DRV_CRC_METHOD_BITWISE) && (DRV_CRC_METHOD_CRC16 != DRV_CRC_METHOD_TABLE) && \
+    (DRV_CRC_METHOD_CRC16 != DRV_CRC_METHOD_SLICE4)  && (DRV_CRC_METHOD_CRC16 != DRV_CRC_METHOD_SLICE8)
+#error "DRV_CRC_METHOD_CRC16: invalid CRC calculation method."
+#endif
+#if (DRV_CRC_METHOD_CRC32 != DRV_CRC_METHOD_BITWISE) && (DRV_CRC_METHOD_CRC32 != DRV_CRC_METHOD_TABLE) && \
+    (DRV_CRC_METHOD_CRC32 != DRV_CRC_METHOD_SLICE4)  && (DRV_CRC_METHOD_CRC32 != DRV_CRC_METHOD_SLICE8)
+#error "DRV_CRC_METHOD_CRC32: invalid CRC calculation method."
+#endif
+#if (DRV_CRC_METHOD_CRC64 != DRV_CRC_METHOD_BITWISE) && (DRV_CRC_METHOD_CRC64 != DRV_CRC_METHOD_TABLE) && \
+    (DRV_CRC_METHOD_CRC64 != DRV_CRC_METHOD_SLICE4)  && (DRV_CRC_METHOD_CRC64 != DRV_CRC_METHOD_SLICE8)
+#error "DRV_CRC_METHOD_CRC64: invalid CRC calculation method."
+#endif
+
+/*
+ * Static variables
+ */
+/**
+ * 8-bit CRC lookup table(s).
+ */
+#if DRV_CRC_METHOD_CRC8 == DRV_CRC_METHOD_TABLE
+GOS_STATIC GOS_CONST u8_t  crc8Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X8) }
+};
+#elif DRV_CRC_METHOD_CRC8 == DRV_CRC_METHOD_SLICE4
+GOS_STATIC GOS_CONST u8_t  crc8Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X8) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X16) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X24) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X32) }
+};
+#elif DRV_CRC_METHOD_CRC8 == DRV_CRC_METHOD_SLICE8
+GOS_STATIC GOS_CONST u8_t  crc8Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X8) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X16) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X24) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X32) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X40) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X48) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X56) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC8_X64) }
+};
+#else
+// Bitwise calculation, no table needed.
+#endif
+
+/**
+ * 16-bit CRC lookup table(s).
+ */
+#if DRV_CRC_METHOD_CRC16 == DRV_CRC_METHOD_TABLE
+GOS_STATIC GOS_CONST u16_t crc16Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X16) }
+};
+#elif DRV_CRC_METHOD_CRC16 == DRV_CRC_METHOD_SLICE4
+GOS_STATIC GOS_CONST u16_t crc16Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X16) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X32) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X48) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X64) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X72) }
+};
+#elif DRV_CRC_METHOD_CRC16 == DRV_CRC_METHOD_SLICE8
+GOS_STATIC GOS_CONST u16_t crc16Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X16) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X32) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X48) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X64) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X80) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X96) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X112) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X128) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC16_X136) }
+};
+#else
+// Bitwise calculation, no table needed.
+#endif
+
+/**
+ * 32-bit CRC lookup table(s).
+ */
+#if DRV_CRC_METHOD_CRC32 == DRV_CRC_METHOD_TABLE
+GOS_STATIC GOS_CONST u32_t crc32Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X32) }
+};
+#elif DRV_CRC_METHOD_CRC32 == DRV_CRC_METHOD_SLICE4
+GOS_STATIC GOS_CONST u32_t crc32Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X32) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X64) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X96) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X128) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X136) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X144) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X152) }
+};
+#elif DRV_CRC_METHOD_CRC32 == DRV_CRC_METHOD_SLICE8
+GOS_STATIC GOS_CONST u32_t crc32Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X32) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X64) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X96) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X128) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X160) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X192) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X224) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X256) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X264) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X272) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC32_X280) }
+};
+#else
+// Bitwise calculation, no table needed.
+#endif
+
+/**
+ * 64-bit CRC lookup table(s).
+ */
+#if DRV_CRC_METHOD_CRC64 == DRV_CRC_METHOD_TABLE
+GOS_STATIC GOS_CONST u64_t crc64Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X64) }
+};
+#elif DRV_CRC_METHOD_CRC64 == DRV_CRC_METHOD_SLICE4
+GOS_STATIC GOS_CONST u64_t crc64Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X64) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X128) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X192) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X256) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X264) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X272) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X280) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X288) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X296) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X304) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X312) }
+};
+#elif DRV_CRC_METHOD_CRC64 == DRV_CRC_METHOD_SLICE8
+GOS_STATIC GOS_CONST u64_t crc64Table [][256u] =
+{
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X64) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X128) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X192) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X256) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X320) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X384) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X448) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X512) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X520) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X528) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X536) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X544) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X552) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X560) },
+    { DRV_CRC_TABLE(DRV_CRC_BASIS_CRC64_X568) }
+};
+#else
+// Bitwise calculation, no table needed.
+#endif
+
+#if DRV_CRC_HW_CRC32
+/**
+ * Hardware CRC unit mutex.
+ */
+GOS_STATIC gos_mutex_t crcHwMutex;
+
+/**
+ * Hardware CRC unit ready flag (set by the initializer).
+ */
+GOS_STATIC bool_t      crcHwReady = GOS_FALSE;
+#endif
+
+/*
+ * Function prototypes
+ */
+GOS_STATIC u8_t         drv_crcSwUpdateCrc8     (u8_t  crcValue, u8_t* pData, u32_t dataSize);
+GOS_STATIC u16_t        drv_crcSwUpdateCrc16    (u16_t crcValue, u8_t* pData, u32_t dataSize);
+GOS_STATIC u32_t        drv_crcSwUpdateCrc32    (u32_t crcValue, u8_t* pData, u32_t dataSize);
+GOS_STATIC u64_t        drv_crcSwUpdateCrc64    (u64_t crcValue, u8_t* pData, u32_t dataSize);
+GOS_STATIC u32_t        drv_crcUpdateCrc32Value (u32_t crcValue, u8_t* pData, u32_t dataSize);
+#if DRV_CRC_HW_CRC32
+GOS_STATIC gos_result_t drv_crcHwUpdateCrc32    (u32_t crcValue, u8_t* pData, u32_t dataSize, u32_t* pCrc);
+#endif
+
+/*
+ * Function: drv_crcInit
+ */
+gos_result_t drv_crcInit (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcInitResult = GOS_SUCCESS;
+
+    /*
+     * Function code.
+     */
+#if DRV_CRC_HW_CRC32
+    __HAL_RCC_CRC_CLK_ENABLE();
+
+    if (gos_mutexInit(&crcHwMutex) == GOS_SUCCESS)
+    {
+        crcHwReady = GOS_TRUE;
+    }
+    else
+    {
+        crcInitResult = GOS_ERROR;
+    }
+#else
+    // Software backend, nothing to initialize.
+#endif
+
+    return crcInitResult;
+}
+
 /*
  * Function: drv_crcGetCrc8
  */
@@ -114,183 +527,419 @@ gos_result_t drv_crcGetCrc8 (u8_t* pData, u32_t dataSize, u8_t* pCrc)
      * Local variables.
      */
     gos_result_t crcGetResult = GOS_ERROR;
-    u32_t        index        = 0u;
-    u8_t         bitCounter   = 0u;
-    u8_t         crcValue     = DRV_CRC_INIT_VALUE_CRC8;
 
     /*
      * Function code.
      */
     if (pData != NULL && pCrc != NULL)
     {
-        for (index = 0u; index < dataSize; index++)
-        {
-            crcValue ^= pData[index];
+        *pCrc = drv_crcSwUpdateCrc8(DRV_CRC_INIT_VALUE_CRC8, pData, dataSize);
+        crcGetResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
 
-            for (bitCounter = 0; bitCounter < 8u; bitCounter++)
-            {
-                if (0 != (DRV_CRC_MASK_CRC8 & crcValue))
-                {
-                    crcValue <<= 1u;
-                    crcValue ^= DRV_CRC_POLYNOMIAL_CRC8;
-                }
-                else
-                {
-                    crcValue <<= 1u;
-                }
-            }
-        }
+    return crcGetResult;
+}
+
+/*
+ * Function: drv_crcGetCrc16
+ */
+gos_result_t drv_crcGetCrc16 (u8_t* pData, u32_t dataSize, u16_t* pCrc)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcGetResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pData != NULL && pCrc != NULL)
+    {
+        *pCrc = drv_crcSwUpdateCrc16(DRV_CRC_INIT_VALUE_CRC16, pData, dataSize);
+        crcGetResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcGetResult;
+}
+
+/*
+ * Function: drv_crcGetCrc32
+ */
+gos_result_t drv_crcGetCrc32 (u8_t* pData, u32_t dataSize, u32_t* pCrc)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcGetResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pData != NULL && pCrc != NULL)
+    {
+        *pCrc = drv_crcUpdateCrc32Value(DRV_CRC_INIT_VALUE_CRC32, pData, dataSize);
+        crcGetResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcGetResult;
+}
+
+/*
+ * Function: drv_crcGetCrc64
+ */
+gos_result_t drv_crcGetCrc64 (u8_t* pData, u32_t dataSize, u64_t* pCrc)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcGetResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pData != NULL && pCrc != NULL)
+    {
+        *pCrc = drv_crcSwUpdateCrc64(DRV_CRC_INIT_VALUE_CRC64, pData, dataSize);
+        crcGetResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcGetResult;
+}
+
+/*
+ * Function: drv_crcStartCrc8
+ */
+gos_result_t drv_crcStartCrc8 (drv_crcContext8_t* pContext)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcStartResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pContext != NULL)
+    {
+        pContext->crcValue = DRV_CRC_INIT_VALUE_CRC8;
+        pContext->dataSize = 0u;
+        crcStartResult     = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcStartResult;
+}
+
+/*
+ * Function: drv_crcUpdateCrc8
+ */
+gos_result_t drv_crcUpdateCrc8 (drv_crcContext8_t* pContext, u8_t* pData, u32_t dataSize)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcUpdateResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pContext != NULL && pData != NULL)
+    {
+        pContext->crcValue  = drv_crcSwUpdateCrc8(pContext->crcValue, pData, dataSize);
+        pContext->dataSize += dataSize;
+        crcUpdateResult     = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcUpdateResult;
+}
+
+/*
+ * Function: drv_crcFinishCrc8
+ */
+gos_result_t drv_crcFinishCrc8 (drv_crcContext8_t* pContext, u8_t* pCrc)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcFinishResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pContext != NULL && pCrc != NULL)
+    {
+        *pCrc           = pContext->crcValue;
+        crcFinishResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcFinishResult;
+}
+
+/*
+ * Function: drv_crcStartCrc16
+ */
+gos_result_t drv_crcStartCrc16 (drv_crcContext16_t* pContext)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcStartResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pContext != NULL)
+    {
+        pContext->crcValue = DRV_CRC_INIT_VALUE_CRC16;
+        pContext->dataSize = 0u;
+        crcStartResult     = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcStartResult;
+}
+
+/*
+ * Function: drv_crcUpdateCrc16
+ */
+gos_result_t drv_crcUpdateCrc16 (drv_crcContext16_t* pContext, u8_t* pData, u32_t dataSize)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcUpdateResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pContext != NULL && pData != NULL)
+    {
+        pContext->crcValue  = drv_crcSwUpdateCrc16(pContext->crcValue, pData, dataSize);
+        pContext->dataSize += dataSize;
+        crcUpdateResult     = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcUpdateResult;
+}
+
+/*
+ * Function: drv_crcFinishCrc16
+ */
+gos_result_t drv_crcFinishCrc16 (drv_crcContext16_t* pContext, u16_t* pCrc)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcFinishResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pContext != NULL && pCrc != NULL)
+    {
+        *pCrc           = pContext->crcValue;
+        crcFinishResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcFinishResult;
+}
+
+/*
+ * Function: drv_crcStartCrc32
+ */
+gos_result_t drv_crcStartCrc32 (drv_crcContext32_t* pContext)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcStartResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pContext != NULL)
+    {
+        pContext->crcValue = DRV_CRC_INIT_VALUE_CRC32;
+        pContext->dataSize = 0u;
+        crcStartResult     = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcStartResult;
+}
+
+/*
+ * Function: drv_crcUpdateCrc32
+ */
+gos_result_t drv_crcUpdateCrc32 (drv_crcContext32_t* pContext, u8_t* pData, u32_t dataSize)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcUpdateResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pContext != NULL && pData != NULL)
+    {
+        pContext->crcValue  = drv_crcUpdateCrc32Value(pContext->crcValue, pData, dataSize);
+        pContext->dataSize += dataSize;
+        crcUpdateResult     = GOS_SUCCESS;
+    }
+    else
+    {
+        // Error.
+    }
+
+    return crcUpdateResult;
+}
+
+/*
+ * Function: drv_crcFinishCrc32
+ */
+gos_result_t drv_crcFinishCrc32 (drv_crcContext32_t* pContext, u32_t* pCrc)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t crcFinishResult = GOS_ERROR;
 
-        *pCrc = crcValue;
-        crcGetResult = GOS_SUCCESS;
+    /*
+     * Function code.
+     */
+    if (pContext != NULL && pCrc != NULL)
+    {
+        *pCrc           = pContext->crcValue;
+        crcFinishResult = GOS_SUCCESS;
     }
     else
     {
         // Error.
     }
 
-    return crcGetResult;
+    return crcFinishResult;
 }
 
 /*
- * Function: drv_crcGetCrc16
+ * Function: drv_crcStartCrc64
  */
-gos_result_t drv_crcGetCrc16 (u8_t* pData, u32_t dataSize, u16_t* pCrc)
+gos_result_t drv_crcStartCrc64 (drv_crcContext64_t* pContext)
 {
     /*
      * Local variables.
      */
-    gos_result_t crcGetResult = GOS_ERROR;
-    u32_t        index        = 0u;
-    u8_t         bitCounter   = 0u;
-    u16_t        crcValue     = DRV_CRC_INIT_VALUE_CRC16;
+    gos_result_t crcStartResult = GOS_ERROR;
 
     /*
      * Function code.
      */
-    if (pData != NULL && pCrc != NULL)
+    if (pContext != NULL)
     {
-        for (index = 0u; index < dataSize; index++)
-        {
-            crcValue ^= pData[index];
-
-            for (bitCounter = 0; bitCounter < 16u; bitCounter++)
-            {
-                if (0 != (DRV_CRC_MASK_CRC16 & crcValue))
-                {
-                    crcValue <<= 1u;
-                    crcValue ^= DRV_CRC_POLYNOMIAL_CRC16;
-                }
-                else
-                {
-                    crcValue <<= 1u;
-                }
-            }
-        }
-
-        *pCrc = crcValue;
-        crcGetResult = GOS_SUCCESS;
+        pContext->crcValue = DRV_CRC_INIT_VALUE_CRC64;
+        pContext->dataSize = 0u;
+        crcStartResult     = GOS_SUCCESS;
     }
     else
     {
         // Error.
     }
 
-    return crcGetResult;
+    return crcStartResult;
 }
 
 /*
- * Function: drv_crcGetCrc32
+ * Function: drv_crcUpdateCrc64
  */
-gos_result_t drv_crcGetCrc32 (u8_t* pData, u32_t dataSize, u32_t* pCrc)
+gos_result_t drv_crcUpdateCrc64 (drv_crcContext64_t* pContext, u8_t* pData, u32_t dataSize)
 {
     /*
      * Local variables.
      */
-    gos_result_t crcGetResult = GOS_ERROR;
-    u32_t        index        = 0u;
-    u8_t         bitCounter   = 0u;
-    u32_t        crcValue     = DRV_CRC_INIT_VALUE_CRC32;
+    gos_result_t crcUpdateResult = GOS_ERROR;
 
     /*
      * Function code.
      */
-    if (pData != NULL && pCrc != NULL)
+    if (pContext != NULL && pData != NULL)
     {
-        for (index = 0u; index < dataSize; index++)
-        {
-            crcValue ^= pData[index];
-
-            for (bitCounter = 0; bitCounter < 32u; bitCounter++)
-            {
-                if (0 != (DRV_CRC_MASK_CRC32 & crcValue))
-                {
-                    crcValue <<= 1u;
-                    crcValue ^= DRV_CRC_POLYNOMIAL_CRC32;
-                }
-                else
-                {
-                    crcValue <<= 1u;
-                }
-            }
-        }
-
-        *pCrc = crcValue;
-        crcGetResult = GOS_SUCCESS;
+        pContext->crcValue  = drv_crcSwUpdateCrc64(pContext->crcValue, pData, dataSize);
+        pContext->dataSize += dataSize;
+        crcUpdateResult     = GOS_SUCCESS;
     }
     else
     {
         // Error.
     }
 
-    return crcGetResult;
+    return crcUpdateResult;
 }
 
 /*
- * Function: drv_crcGetCrc64
+ * Function: drv_crcFinishCrc64
  */
-gos_result_t drv_crcGetCrc64 (u8_t* pData, u32_t dataSize, u64_t* pCrc)
+gos_result_t drv_crcFinishCrc64 (drv_crcContext64_t* pContext, u64_t* pCrc)
 {
     /*
      * Local variables.
      */
-    gos_result_t crcGetResult = GOS_ERROR;
-    u32_t        index        = 0u;
-    u8_t         bitCounter   = 0u;
-    u64_t        crcValue     = DRV_CRC_INIT_VALUE_CRC64;
+    gos_result_t crcFinishResult = GOS_ERROR;
 
     /*
      * Function code.
      */
-    if (pData != NULL && pCrc != NULL)
+    if (pContext != NULL && pCrc != NULL)
     {
-        for (index = 0u; index < dataSize; index++)
-        {
-            crcValue ^= pData[index];
-
-            for (bitCounter = 0; bitCounter < 64u; bitCounter++)
-            {
-                if (0 != (DRV_CRC_MASK_CRC64 & crcValue))
-                {
-                    crcValue <<= 1u;
-                    crcValue ^= DRV_CRC_POLYNOMIAL_CRC64;
-                }
-                else
-                {
-                    crcValue <<= 1u;
-                }
-            }
-        }
-
-        *pCrc = crcValue;
-        crcGetResult = GOS_SUCCESS;
+        *pCrc           = pContext->crcValue;
+        crcFinishResult = GOS_SUCCESS;
     }
     else
     {
         // Error.
     }
 
-    return crcGetResult;
+    return crcFinishResult;
 }
 
 /*
@@ -776,3 +1425,438 @@ drv_crcChkSumCheckResult_t drv_crcCheckChkSum64 (u8_t* pData, u32_t dataSize, u6
 
     return chkSumCheckResult;
 }
+
+/**
+ * @brief   8-bit CRC software engine.
+ * @details Continues the 8-bit CRC calculation from the given register value with the
+ *          configured calculation method.
+ *
+ * @param   crcValue : Current CRC register value.
+ * @param   pData    : Pointer to the buffer.
+ * @param   dataSize : Size of the buffer.
+ *
+ * @return  Updated CRC register value.
+ */
+GOS_STATIC u8_t drv_crcSwUpdateCrc8 (u8_t crcValue, u8_t* pData, u32_t dataSize)
+{
+    /*
+     * Local variables.
+     */
+    u32_t index       = 0u;
+#if DRV_CRC_METHOD_CRC8 == DRV_CRC_METHOD_BITWISE
+    u8_t  bitCounter  = 0u;
+#elif DRV_CRC_METHOD_CRC8 != DRV_CRC_METHOD_TABLE
+    u8_t  byteCounter = 0u;
+    u8_t  sliceValue  = 0u;
+#endif
+
+    /*
+     * Function code.
+     */
+#if DRV_CRC_METHOD_CRC8 == DRV_CRC_METHOD_BITWISE
+    for (index = 0u; index < dataSize; index++)
+    {
+        crcValue ^= pData[index];
+
+        for (bitCounter = 0; bitCounter < 8u; bitCounter++)
+        {
+            if (0 != (DRV_CRC_MASK_CRC8 & crcValue))
+            {
+                crcValue <<= 1u;
+                crcValue ^= DRV_CRC_POLYNOMIAL_CRC8;
+            }
+            else
+            {
+                crcValue <<= 1u;
+            }
+        }
+    }
+#else
+#if DRV_CRC_METHOD_CRC8 != DRV_CRC_METHOD_TABLE
+    // Process complete slices: the register (with the first byte) and the
+    // remaining bytes of the slice are shifted through independent tables.
+    for (; (dataSize - index) >= DRV_CRC_SLICE_CRC8; index += DRV_CRC_SLICE_CRC8)
+    {
+        sliceValue = crcValue ^ pData[index];
+        crcValue   = 0u;
+
+        for (byteCounter = 0u; byteCounter < 1u; byteCounter++)
+        {
+            crcValue ^= crc8Table[DRV_CRC_SLICE_CRC8 - 1u + byteCounter][(sliceValue >> (8u * byteCounter)) & 0xFFu];
+        }
+
+        for (byteCounter = 1u; byteCounter < DRV_CRC_SLICE_CRC8; byteCounter++)
+        {
+            crcValue ^= crc8Table[DRV_CRC_SLICE_CRC8 - 1u - byteCounter][pData[index + byteCounter]];
+        }
+    }
+#endif
+    // Process the remaining bytes one by one.
+    for (; index < dataSize; index++)
+    {
+        crcValue = crc8Table[0][crcValue ^ pData[index]];
+    }
+#endif
+
+    return crcValue;
+}
+
+/**
+ * @brief   16-bit CRC software engine.
+ * @details Continues the 16-bit CRC calculation from the given register value with the
+ *          configured calculation method.
+ *
+ * @param   crcValue : Current CRC register value.
+ * @param   pData    : Pointer to the buffer.
+ * @param   dataSize : Size of the buffer.
+ *
+ * @return  Updated CRC register value.
+ */
+GOS_STATIC u16_t drv_crcSwUpdateCrc16 (u16_t crcValue, u8_t* pData, u32_t dataSize)
+{
+    /*
+     * Local variables.
+     */
+    u32_t index       = 0u;
+#if DRV_CRC_METHOD_CRC16 == DRV_CRC_METHOD_BITWISE
+    u8_t  bitCounter  = 0u;
+#else
+    u8_t  byteCounter = 0u;
+#endif
+#if (DRV_CRC_METHOD_CRC16 == DRV_CRC_METHOD_SLICE4) || (DRV_CRC_METHOD_CRC16 == DRV_CRC_METHOD_SLICE8)
+    u16_t sliceValue  = 0u;
+#endif
+
+    /*
+     * Function code.
+     */
+#if DRV_CRC_METHOD_CRC16 == DRV_CRC_METHOD_BITWISE
+    for (index = 0u; index < dataSize; index++)
+    {
+        crcValue ^= pData[index];
+
+        for (bitCounter = 0; bitCounter < 16u; bitCounter++)
+        {
+            if (0 != (DRV_CRC_MASK_CRC16 & crcValue))
+            {
+                crcValue <<= 1u;
+                crcValue ^= DRV_CRC_POLYNOMIAL_CRC16;
+            }
+            else
+            {
+                crcValue <<= 1u;
+            }
+        }
+    }
+#else
+#if DRV_CRC_METHOD_CRC16 != DRV_CRC_METHOD_TABLE
+    // Process complete slices: the register (with the first byte) and the
+    // remaining bytes of the slice are shifted through independent tables.
+    for (; (dataSize - index) >= DRV_CRC_SLICE_CRC16; index += DRV_CRC_SLICE_CRC16)
+    {
+        sliceValue = crcValue ^ pData[index];
+        crcValue   = 0u;
+
+        for (byteCounter = 0u; byteCounter < 2u; byteCounter++)
+        {
+            crcValue ^= crc16Table[DRV_CRC_SLICE_CRC16 - 1u + byteCounter][(sliceValue >> (8u * byteCounter)) & 0xFFu];
+        }
+
+        for (byteCounter = 1u; byteCounter < DRV_CRC_SLICE_CRC16; byteCounter++)
+        {
+            crcValue ^= crc16Table[DRV_CRC_SLICE_CRC16 - 1u - byteCounter][pData[index + byteCounter]];
+        }
+    }
+#endif
+    // Process the remaining bytes one by one.
+    for (; index < dataSize; index++)
+    {
+        crcValue ^= pData[index];
+
+        for (byteCounter = 0u; byteCounter < 2u; byteCounter++)
+        {
+            crcValue = (crcValue << 8u) ^ crc16Table[0][crcValue >> 8u];
+        }
+    }
+#endif
+
+    return crcValue;
+}
+
+/**
+ * @brief   32-bit CRC software engine.
+ * @details Continues the 32-bit CRC calculation from the given register value with the
+ *          configured calculation method.
+ *
+ * @param   crcValue : Current CRC register value.
+ * @param   pData    : Pointer to the buffer.
+ * @param   dataSize : Size of the buffer.
+ *
+ * @return  Updated CRC register value.
+ */
+GOS_STATIC u32_t drv_crcSwUpdateCrc32 (u32_t crcValue, u8_t* pData, u32_t dataSize)
+{
+    /*
+     * Local variables.
+     */
+    u32_t index       = 0u;
+#if DRV_CRC_METHOD_CRC32 == DRV_CRC_METHOD_BITWISE
+    u8_t  bitCounter  = 0u;
+#else
+    u8_t  byteCounter = 0u;
+#endif
+#if (DRV_CRC_METHOD_CRC32 == DRV_CRC_METHOD_SLICE4) || (DRV_CRC_METHOD_CRC32 == DRV_CRC_METHOD_SLICE8)
+    u32_t sliceValue  = 0u;
+#endif
+
+    /*
+     * Function code.
+     */
+#if DRV_CRC_METHOD_CRC32 == DRV_CRC_METHOD_BITWISE
+    for (index = 0u; index < dataSize; index++)
+    {
+        crcValue ^= pData[index];
+
+        for (bitCounter = 0; bitCounter < 32u; bitCounter++)
+        {
+            if (0 != (DRV_CRC_MASK_CRC32 & crcValue))
+            {
+                crcValue <<= 1u;
+                crcValue ^= DRV_CRC_POLYNOMIAL_CRC32;
+            }
+            else
+            {
+                crcValue <<= 1u;
+            }
+        }
+    }
+#else
+#if DRV_CRC_METHOD_CRC32 != DRV_CRC_METHOD_TABLE
+    // Process complete slices: the register (with the first byte) and the
+    // remaining bytes of the slice are shifted through independent tables.
+    for (; (dataSize - index) >= DRV_CRC_SLICE_CRC32; index += DRV_CRC_SLICE_CRC32)
+    {
+        sliceValue = crcValue ^ pData[index];
+        crcValue   = 0u;
+
+        for (byteCounter = 0u; byteCounter < 4u; byteCounter++)
+        {
+            crcValue ^= crc32Table[DRV_CRC_SLICE_CRC32 - 1u + byteCounter][(sliceValue >> (8u * byteCounter)) & 0xFFu];
+        }
+
+        for (byteCounter = 1u; byteCounter < DRV_CRC_SLICE_CRC32; byteCounter++)
+        {
+            crcValue ^= crc32Table[DRV_CRC_SLICE_CRC32 - 1u - byteCounter][pData[index + byteCounter]];
+        }
+    }
+#endif
+    // Process the remaining bytes one by one.
+    for (; index < dataSize; index++)
+    {
+        crcValue ^= pData[index];
+
+        for (byteCounter = 0u; byteCounter < 4u; byteCounter++)
+        {
+            crcValue = (crcValue << 8u) ^ crc32Table[0][crcValue >> 24u];
+        }
+    }
+#endif
+
+    return crcValue;
+}
+
+/**
+ * @brief   64-bit CRC software engine.
+ * @details Continues the 64-bit CRC calculation from the given register value with the
+ *          configured calculation method.
+ *
+ * @param   crcValue : Current CRC register value.
+ * @param   pData    : Pointer to the buffer.
+ * @param   dataSize : Size of the buffer.
+ *
+ * @return  Updated CRC register value.
+ */
+GOS_STATIC u64_t drv_crcSwUpdateCrc64 (u64_t crcValue, u8_t* pData, u32_t dataSize)
+{
+    /*
+     * Local variables.
+     */
+    u32_t index       = 0u;
+#if DRV_CRC_METHOD_CRC64 == DRV_CRC_METHOD_BITWISE
+    u8_t  bitCounter  = 0u;
+#else
+    u8_t  byteCounter = 0u;
+#endif
+#if (DRV_CRC_METHOD_CRC64 == DRV_CRC_METHOD_SLICE4) || (DRV_CRC_METHOD_CRC64 == DRV_CRC_METHOD_SLICE8)
+    u64_t sliceValue  = 0u;
+#endif
+
+    /*
+     * Function code.
+     */
+#if DRV_CRC_METHOD_CRC64 == DRV_CRC_METHOD_BITWISE
+    for (index = 0u; index < dataSize; index++)
+    {
+        crcValue ^= pData[index];
+
+        for (bitCounter = 0; bitCounter < 64u; bitCounter++)
+        {
+            if (0 != (DRV_CRC_MASK_CRC64 & crcValue))
+            {
+                crcValue <<= 1u;
+                crcValue ^= DRV_CRC_POLYNOMIAL_CRC64;
+            }
+            else
+            {
+                crcValue <<= 1u;
+            }
+        }
+    }
+#else
+#if DRV_CRC_METHOD_CRC64 != DRV_CRC_METHOD_TABLE
+    // Process complete slices: the register (with the first byte) and the
+    // remaining bytes of the slice are shifted through independent tables.
+    for (; (dataSize - index) >= DRV_CRC_SLICE_CRC64; index += DRV_CRC_SLICE_CRC64)
+    {
+        sliceValue = crcValue ^ pData[index];
+        crcValue   = 0u;
+
+        for (byteCounter = 0u; byteCounter < 8u; byteCounter++)
+        {
+            crcValue ^= crc64Table[DRV_CRC_SLICE_CRC64 - 1u + byteCounter][(sliceValue >> (8u * byteCounter)) & 0xFFu];
+        }
+
+        for (byteCounter = 1u; byteCounter < DRV_CRC_SLICE_CRC64; byteCounter++)
+        {
+            crcValue ^= crc64Table[DRV_CRC_SLICE_CRC64 - 1u - byteCounter][pData[index + byteCounter]];
+        }
+    }
+#endif
+    // Process the remaining bytes one by one.
+    for (; index < dataSize; index++)
+    {
+        crcValue ^= pData[index];
+
+        for (byteCounter = 0u; byteCounter < 8u; byteCounter++)
+        {
+            crcValue = (crcValue << 8u) ^ crc64Table[0][crcValue >> 56u];
+        }
+    }
+#endif
+
+    return crcValue;
+}
+
+/**
+ * @brief   32-bit CRC engine selector.
+ * @details Continues the 32-bit CRC calculation on the hardware unit if it is available
+ *          and worth it, otherwise with the software engine.
+ *
+ * @param   crcValue : Current CRC register value.
+ * @param   pData    : Pointer to the buffer.
+ * @param   dataSize : Size of the buffer.
+ *
+ * @return  Updated CRC register value.
+ */
+GOS_STATIC u32_t drv_crcUpdateCrc32Value (u32_t crcValue, u8_t* pData, u32_t dataSize)
+{
+    /*
+     * Local variables.
+     */
+    u32_t crcResult = 0u;
+
+    /*
+     * Function code.
+     */
+#if DRV_CRC_HW_CRC32
+    if ((dataSize < DRV_CRC_HW_MIN_SIZE) ||
+        (drv_crcHwUpdateCrc32(crcValue, pData, dataSize, &crcResult) != GOS_SUCCESS))
+    {
+        crcResult = drv_crcSwUpdateCrc32(crcValue, pData, dataSize);
+    }
+    else
+    {
+        // Calculated by hardware.
+    }
+#else
+    crcResult = drv_crcSwUpdateCrc32(crcValue, pData, dataSize);
+#endif
+
+    return crcResult;
+}
+
+#if DRV_CRC_HW_CRC32
+/**
+ * @brief   32-bit CRC hardware engine.
+ * @details Continues the 32-bit CRC calculation from the given register value on the CRC
+ *          unit. The unit is only used if it is initialized and free (it is never waited for),
+ *          so the caller can fall back to the software engine otherwise.
+ *
+ * @param   crcValue : Current CRC register value.
+ * @param   pData    : Pointer to the buffer.
+ * @param   dataSize : Size of the buffer.
+ * @param   pCrc     : Variable to store the updated register value in.
+ *
+ * @return  Result of hardware calculation.
+ *
+ * @retval  GOS_SUCCESS : Calculation successful.
+ * @retval  GOS_ERROR   : CRC unit is not initialized or busy.
+ */
+GOS_STATIC gos_result_t drv_crcHwUpdateCrc32 (u32_t crcValue, u8_t* pData, u32_t dataSize, u32_t* pCrc)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t hwUpdateResult = GOS_ERROR;
+    u32_t        index          = 0u;
+    u8_t         bitCounter     = 0u;
+
+    /*
+     * Function code.
+     */
+    if (crcHwReady == GOS_TRUE && gos_mutexLock(&crcHwMutex, GOS_MUTEX_NO_TMO) == GOS_SUCCESS)
+    {
+        CRC->CR = CRC_CR_RESET;
+
+        // The unit can only restart from the initial value: load any other register
+        // value by feeding its pre-image (crcValue * X^-32) first.
+        if (crcValue != DRV_CRC_INIT_VALUE_CRC32)
+        {
+            for (bitCounter = 0u; bitCounter < 32u; bitCounter++)
+            {
+                if ((crcValue & 1u) != 0u)
+                {
+                    crcValue = ((crcValue ^ DRV_CRC_POLYNOMIAL_CRC32) >> 1u) | DRV_CRC_MASK_CRC32;
+                }
+                else
+                {
+                    crcValue >>= 1u;
+                }
+            }
+
+            CRC->DR = crcValue ^ DRV_CRC_INIT_VALUE_CRC32;
+        }
+        else
+        {
+            // Unit starts from the initial value.
+        }
+
+        // Each byte is written as a full word, matching the byte step of the software engine.
+        for (index = 0u; index < dataSize; index++)
+        {
+            CRC->DR = (u32_t)pData[index];
+        }
+
+        *pCrc = CRC->DR;
+
+        (void_t) gos_mutexUnlock(&crcHwMutex);
+        hwUpdateResult = GOS_SUCCESS;
+    }
+    else
+    {
+        // Unit is not available.
+    }
+
+    return hwUpdateResult;
+}
+#endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_shell.c
 //! @author     Ahmed Gazar
-//! @date       2024-12-20
-//! @version    1.1
+//! @date       2026-10-19
+//! @version    1.2
 //!
 //! @brief      GOS2022 Library / Shell driver source.
 //! @details    For a more detailed description of this driver, please refer to @ref drv_shell.h
@@ -26,6 +26,7 @@
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-03-15    Ahmed Gazar     Initial version created.
 // 1.1        2024-12-20    Ahmed Gazar     +    Instance validity check added.
+// 1.2        2026-10-19    Ahmed Gazar     +    Interrupt-driven buffer reception added.
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -53,6 +54,27 @@
 #include <drv_uart.h>
 #include <string.h>
 
+/*
+ * Macros
+ */
+/**
+ * Shell RX ring size.
+ */
+#define DRV_SHELL_RX_RING_SIZE ( 128u )
+
+/*
+ * Static variables
+ */
+/**
+ * Shell RX ring buffer.
+ */
+GOS_STATIC u8_t   shellRxRing [DRV_SHELL_RX_RING_SIZE];
+
+/**
+ * Shell RX ring started flag.
+ */
+GOS_STATIC bool_t shellRxRingStarted = GOS_FALSE;
+
 /*
  * External variables
  */
@@ -137,3 +159,56 @@ GOS_INLINE gos_result_t drv_shellReceiveChar (char_t* pBuffer)
 
     return uartReceiveResult;
 }
+
+/*
+ * Function: drv_shellReceiveBuffer
+ */
+gos_result_t drv_shellReceiveBuffer (char_t* pBuffer, u16_t bufferSize, u16_t* pReceivedSize)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t             uartReceiveResult  = GOS_ERROR;
+    drv_uartPeriphInstance_t instance           = 0u;
+
+    /*
+     * Function code.
+     */
+    if (uartServiceConfig != NULL)
+    {
+        instance = uartServiceConfig[DRV_UART_SHELL_INSTANCE];
+
+        if (instance < DRV_UART_NUM_OF_INSTANCES)
+        {
+            if (shellRxRingStarted == GOS_FALSE &&
+                drv_uartRxRingStart(instance, shellRxRing, DRV_SHELL_RX_RING_SIZE) == GOS_SUCCESS)
+            {
+                shellRxRingStarted = GOS_TRUE;
+            }
+            else
+            {
+                // Already started or start error.
+            }
+
+            if (shellRxRingStarted == GOS_TRUE)
+            {
+                uartReceiveResult = drv_uartRxRingRead(instance, (u8_t*)pBuffer, bufferSize,
+                        pReceivedSize, GOS_TRIGGER_ENDLESS_TMO);
+            }
+            else
+            {
+                // Ring not started.
+            }
+        }
+        else
+        {
+        	// Invalid instance.
+        }
+    }
+    else
+    {
+        // Configuration array is NULL.
+    }
+
+    return uartReceiveResult;
+}
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_spi.c
 //! @author     Ahmed Gazar
-//! @date       2025-07-24
-//! @version    1.2
+//! @date       2026-10-19
+//! @version    1.4
 //!
 //! @brief      GOS2022 Library / SPI driver source.
 //! @details    For a more detailed description of this driver, please refer to @ref drv_spi.h
@@ -29,6 +29,10 @@
 //                                          *    Trigger usage made optional by 0 timeout
 //                                          *    Inline macros removed from functions
 // 1.2        2025-07-24    Ahmed Gazar     +    Diagnostics implemented
+// 1.3        2026-10-19    Ahmed Gazar     +    drv_spiReceiveDMAWait added
+// 1.4        2026-10-19    Ahmed Gazar     +    drv_spiBusLock and drv_spiBusUnlock added
+//                                          *    Transfers skip the mutex while the caller holds
+//                                               the bus lock
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -82,6 +86,11 @@ GOS_STATIC SPI_HandleTypeDef hspis                [DRV_SPI_NUM_OF_INSTANCES];
  */
 GOS_STATIC gos_mutex_t       spiMutexes           [DRV_SPI_NUM_OF_INSTANCES];
 
+/**
+ * SPI bus lock flags (mutex held by its owner across transfers).
+ */
+GOS_STATIC bool_t            spiBusLocks          [DRV_SPI_NUM_OF_INSTANCES];
+
 /**
  * SPI RX ready triggers.
  */
@@ -115,6 +124,13 @@ GOS_EXTERN GOS_CONST drv_spiDescriptor_t     spiConfig [];
  */
 GOS_EXTERN u32_t                             spiConfigSize;
 
+/*
+ * Function prototypes
+ */
+GOS_STATIC bool_t       drv_spiIsBusOwner   (drv_spiPeriphInstance_t instance);
+GOS_STATIC gos_result_t drv_spiAccessLock   (drv_spiPeriphInstance_t instance, u32_t mutexTmo);
+GOS_STATIC void_t       drv_spiAccessUnlock (drv_spiPeriphInstance_t instance);
+
 /*
  * Function: drv_spiInit
  */
@@ -278,6 +294,71 @@ gos_result_t drv_spiGetDiagData (
     return spiGetDiagResult;
 }
 
+/*
+ * Function: drv_spiBusLock
+ */
+gos_result_t drv_spiBusLock (
+        drv_spiPeriphInstance_t instance, u32_t mutexTmo
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t busLockResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (instance < DRV_SPI_NUM_OF_INSTANCES)
+    {
+        if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+        {
+            spiBusLocks[instance] = GOS_TRUE;
+            busLockResult         = GOS_SUCCESS;
+            DRV_ERROR_CLEAR(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_BUS_LOCK);
+        }
+        else
+        {
+            // Mutex error.
+            DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_BUS_LOCK);
+        }
+    }
+    else
+    {
+        // Wrong instance.
+    }
+
+    return busLockResult;
+}
+
+/*
+ * Function: drv_spiBusUnlock
+ */
+gos_result_t drv_spiBusUnlock (
+        drv_spiPeriphInstance_t instance
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t busUnlockResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (instance < DRV_SPI_NUM_OF_INSTANCES && drv_spiIsBusOwner(instance) == GOS_TRUE)
+    {
+        spiBusLocks[instance] = GOS_FALSE;
+        busUnlockResult       = gos_mutexUnlock(&spiMutexes[instance]);
+    }
+    else
+    {
+        // Wrong instance or bus is not locked by the caller.
+    }
+
+    return busUnlockResult;
+}
+
 /*
  * Function: drv_spiTransmitBlocking
  */
@@ -295,7 +376,7 @@ gos_result_t drv_spiTransmitBlocking (
     /*
      * Function code.
      */
-    if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+    if (drv_spiAccessLock(instance, mutexTmo) == GOS_SUCCESS)
     {
         if (HAL_SPI_Transmit(&hspis[instance], pData, size, transmitTmo) == HAL_OK)
         {
@@ -314,7 +395,7 @@ gos_result_t drv_spiTransmitBlocking (
     	DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_TX_BLOCKING_MUTEX);
     }
 
-    (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    drv_spiAccessUnlock(instance);
 
     return spiDriverTransmitResult;
 }
@@ -335,7 +416,7 @@ gos_result_t drv_spiReceiveBlocking (
     /*
      * Function code.
      */
-    if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+    if (drv_spiAccessLock(instance, mutexTmo) == GOS_SUCCESS)
     {
         if (HAL_SPI_Receive(&hspis[instance], pBuffer, size, receiveTmo) == HAL_OK)
         {
@@ -354,7 +435,7 @@ gos_result_t drv_spiReceiveBlocking (
     	DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_RX_BLOCKING_MUTEX);
     }
 
-    (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    drv_spiAccessUnlock(instance);
 
     return spiDriverReceiveResult;
 }
@@ -375,7 +456,7 @@ gos_result_t drv_spiTransmitIT (
     /*
      * Function code.
      */
-    if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+    if (drv_spiAccessLock(instance, mutexTmo) == GOS_SUCCESS)
     {
     	(void_t) HAL_SPI_Abort_IT(&hspis[instance]);
 
@@ -412,7 +493,7 @@ gos_result_t drv_spiTransmitIT (
     	DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_TX_IT_MUTEX);
     }
 
-    (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    drv_spiAccessUnlock(instance);
 
     return spiDriverTransmitResult;
 }
@@ -433,7 +514,7 @@ gos_result_t drv_spiReceiveIT (
     /*
      * Function code.
      */
-    if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+    if (drv_spiAccessLock(instance, mutexTmo) == GOS_SUCCESS)
     {
     	(void_t) HAL_SPI_Abort_IT(&hspis[instance]);
 
@@ -470,7 +551,7 @@ gos_result_t drv_spiReceiveIT (
     	DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_RX_IT_MUTEX);
     }
 
-    (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    drv_spiAccessUnlock(instance);
 
     return spiDriverReceiveResult;
 }
@@ -491,7 +572,7 @@ gos_result_t drv_spiTransmitDMA (
     /*
      * Function code.
      */
-    if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+    if (drv_spiAccessLock(instance, mutexTmo) == GOS_SUCCESS)
     {
         if (HAL_SPI_Transmit_DMA(&hspis[instance], pData, size) == HAL_OK)
         {
@@ -527,7 +608,7 @@ gos_result_t drv_spiTransmitDMA (
     	DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_TX_DMA_MUTEX);
     }
 
-    (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    drv_spiAccessUnlock(instance);
 
     return spiDriverTransmitResult;
 }
@@ -548,7 +629,7 @@ gos_result_t drv_spiReceiveDMA (
     /*
      * Function code.
      */
-    if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+    if (drv_spiAccessLock(instance, mutexTmo) == GOS_SUCCESS)
     {
         if (HAL_SPI_Receive_DMA(&hspis[instance], pBuffer, size) == HAL_OK)
         {
@@ -583,11 +664,50 @@ gos_result_t drv_spiReceiveDMA (
     	DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_RX_DMA_MUTEX);
     }
 
-    (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    drv_spiAccessUnlock(instance);
 
     return spiDriverReceiveResult;
 }
 
+/*
+ * Function: drv_spiReceiveDMAWait
+ */
+gos_result_t drv_spiReceiveDMAWait (
+        drv_spiPeriphInstance_t instance, u32_t triggerTmo
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t spiDriverWaitResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (instance < DRV_SPI_NUM_OF_INSTANCES)
+    {
+        if (gos_triggerWait (&spiRxReadyTriggers[instance], 1, triggerTmo) == GOS_SUCCESS &&
+            gos_triggerReset(&spiRxReadyTriggers[instance])                == GOS_SUCCESS)
+        {
+            spiDriverWaitResult = GOS_SUCCESS;
+            DRV_ERROR_CLEAR(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_RX_DMA_TRIG);
+        }
+        else
+        {
+            // Trigger error, stop the transfer.
+            (void_t) HAL_SPI_Abort(&hspis[instance]);
+            (void_t) gos_triggerReset(&spiRxReadyTriggers[instance]);
+            DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_RX_DMA_TRIG);
+        }
+    }
+    else
+    {
+        // Wrong instance.
+    }
+
+    return spiDriverWaitResult;
+}
+
 /*
  * Function: drv_spiTransmitReceiveBlocking
  */
@@ -604,7 +724,7 @@ gos_result_t drv_spiTransmitReceiveBlocking (
     /*
      * Function code.
      */
-    if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+    if (drv_spiAccessLock(instance, mutexTmo) == GOS_SUCCESS)
     {
         if (HAL_SPI_TransmitReceive(&hspis[instance], pTxData, pRxData, size, transmitReceiveTmo) == HAL_OK)
         {
@@ -623,7 +743,7 @@ gos_result_t drv_spiTransmitReceiveBlocking (
     	DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_TX_RX_BLOCKING_MUTEX);
     }
 
-    (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    drv_spiAccessUnlock(instance);
 
     return spiDriverTransmitReceiveResult;
 }
@@ -644,7 +764,7 @@ gos_result_t drv_spiTransmitReceiveIT (
     /*
      * Function code.
      */
-    if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+    if (drv_spiAccessLock(instance, mutexTmo) == GOS_SUCCESS)
     {
         if (HAL_SPI_TransmitReceive_IT(&hspis[instance], pTxData, pRxData, size) == HAL_OK)
         {
@@ -679,7 +799,7 @@ gos_result_t drv_spiTransmitReceiveIT (
     	DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_TX_RX_IT_MUTEX);
     }
 
-    (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    drv_spiAccessUnlock(instance);
 
     return spiDriverTransmitReceiveResult;
 }
@@ -700,7 +820,7 @@ gos_result_t drv_spiTransmitReceiveDMA (
     /*
      * Function code.
      */
-    if (gos_mutexLock(&spiMutexes[instance], mutexTmo) == GOS_SUCCESS)
+    if (drv_spiAccessLock(instance, mutexTmo) == GOS_SUCCESS)
     {
         if (HAL_SPI_TransmitReceive_DMA(&hspis[instance], pTxData, pRxData, size) == HAL_OK)
         {
@@ -735,7 +855,7 @@ gos_result_t drv_spiTransmitReceiveDMA (
     	DRV_ERROR_SET(spiDiag.instanceErrorFlags[instance], DRV_ERROR_SPI_TX_RX_DMA_MUTEX);
     }
 
-    (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    drv_spiAccessUnlock(instance);
 
     return spiDriverTransmitReceiveResult;
 }
@@ -927,3 +1047,98 @@ void_t HAL_SPI_MspInit (SPI_HandleTypeDef* hspi)
         }
     }
 }
+
+/**
+ * @brief   Checks whether the caller holds the bus lock.
+ * @details Returns true if the bus is locked and the mutex is owned by the
+ *          current task.
+ *
+ * @param[in] instance SPI instance.
+ *
+ * @return  Result of the check.
+ *
+ * @retval  #GOS_TRUE  Caller holds the bus lock.
+ * @retval  #GOS_FALSE Bus is not locked or locked by another task.
+ */
+GOS_STATIC bool_t drv_spiIsBusOwner (drv_spiPeriphInstance_t instance)
+{
+    /*
+     * Local variables.
+     */
+    bool_t    isOwner   = GOS_FALSE;
+    gos_tid_t currentId = GOS_INVALID_TASK_ID;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_taskGetCurrentId(&currentId);
+
+    if (spiBusLocks[instance] == GOS_TRUE && spiMutexes[instance].owner == currentId)
+    {
+        isOwner = GOS_TRUE;
+    }
+    else
+    {
+        // Bus is not locked by the caller.
+    }
+
+    return isOwner;
+}
+
+/**
+ * @brief   Gets access to the bus for a transfer.
+ * @details Succeeds immediately if the caller holds the bus lock, otherwise
+ *          locks the instance mutex.
+ *
+ * @param[in] instance SPI instance.
+ * @param[in] mutexTmo Mutex timeout [ms].
+ *
+ * @return  Result of locking.
+ *
+ * @retval  #GOS_SUCCESS Access granted.
+ * @retval  #GOS_ERROR   Mutex timeout.
+ */
+GOS_STATIC gos_result_t drv_spiAccessLock (drv_spiPeriphInstance_t instance, u32_t mutexTmo)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t accessLockResult = GOS_SUCCESS;
+
+    /*
+     * Function code.
+     */
+    if (drv_spiIsBusOwner(instance) == GOS_FALSE)
+    {
+        accessLockResult = gos_mutexLock(&spiMutexes[instance], mutexTmo);
+    }
+    else
+    {
+        // Bus is locked by the caller.
+    }
+
+    return accessLockResult;
+}
+
+/**
+ * @brief   Releases the bus after a transfer.
+ * @details Keeps the mutex if the caller holds the bus lock.
+ *
+ * @param[in] instance SPI instance.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t drv_spiAccessUnlock (drv_spiPeriphInstance_t instance)
+{
+    /*
+     * Function code.
+     */
+    if (drv_spiIsBusOwner(instance) == GOS_FALSE)
+    {
+        (void_t) gos_mutexUnlock(&spiMutexes[instance]);
+    }
+    else
+    {
+        // Bus is locked by the caller.
+    }
+}
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_sysmon.c
 //! @author     Ahmed Gazar
-//! @date       2024-03-15
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.2
 //!
 //! @brief      GOS2022 Library / Sysmon driver source.
 //! @details    For a more detailed description of this driver, please refer to @ref drv_sysmon.h
@@ -25,6 +25,9 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-03-15    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    Vectored transmit functions added
+// 1.2        2026-10-19    Ahmed Gazar     *    Wireless vectored transmit falls back to sequential
+//                                               transmissions
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -65,6 +68,11 @@ GOS_EXTERN GOS_CONST drv_uartPeriphInstance_t uartServiceConfig [];
  */
 GOS_EXTERN drv_uartServiceTimeoutConfig_t     uartServiceTmoConfig;
 
+/*
+ * Function prototypes
+ */
+GOS_STATIC gos_result_t drv_sysmonTransmitSegments (drv_uartServiceInstance_t serviceInstance, gos_gcpSegment_t* pSegments, u8_t segmentCount);
+
 /*
  * Function: drv_sysmonWiredTransmit
  */
@@ -94,6 +102,17 @@ GOS_INLINE gos_result_t drv_sysmonWiredTransmit (u8_t* pData, u16_t size)
     return uartTransmitResult;
 }
 
+/*
+ * Function: drv_sysmonWiredTransmitVector
+ */
+GOS_INLINE gos_result_t drv_sysmonWiredTransmitVector (gos_gcpSegment_t* pSegments, u8_t segmentCount)
+{
+    /*
+     * Function code.
+     */
+    return drv_sysmonTransmitSegments(DRV_UART_SYSMON_WIRED_INSTANCE, pSegments, segmentCount);
+}
+
 /*
  * Function: drv_sysmonWiredReceive
  */
@@ -152,6 +171,44 @@ GOS_INLINE gos_result_t drv_sysmonWirelessTransmit (u8_t* pData, u16_t size)
     return uartTransmitResult;
 }
 
+/*
+ * Function: drv_sysmonWirelessTransmitVector
+ */
+GOS_INLINE gos_result_t drv_sysmonWirelessTransmitVector (gos_gcpSegment_t* pSegments, u8_t segmentCount)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t uartTransmitResult = GOS_ERROR;
+    u8_t         segmentIndex       = 0u;
+
+    /*
+     * Function code.
+     */
+    if (pSegments != NULL)
+    {
+        uartTransmitResult = GOS_SUCCESS;
+
+        for (segmentIndex = 0u; segmentIndex < segmentCount && uartTransmitResult == GOS_SUCCESS; segmentIndex++)
+        {
+            if (pSegments[segmentIndex].pData != NULL && pSegments[segmentIndex].size > 0u)
+            {
+                uartTransmitResult = drv_sysmonWirelessTransmit(pSegments[segmentIndex].pData, pSegments[segmentIndex].size);
+            }
+            else
+            {
+                // Empty segment.
+            }
+        }
+    }
+    else
+    {
+        // NULL pointer.
+    }
+
+    return uartTransmitResult;
+}
+
 /*
  * Function: drv_sysmonWirelessReceive
  */
@@ -180,3 +237,52 @@ GOS_INLINE gos_result_t drv_sysmonWirelessReceive (u8_t* pBuffer, u16_t size)
 
     return uartReceiveResult;
 }
+
+/**
+ * @brief   Transmits GCP frame segments on the given sysmon UART instance.
+ * @details Converts the segment list and passes it to the UART driver, which sends
+ *          the segments back to back.
+ *
+ * @param   serviceInstance : Sysmon UART service instance.
+ * @param   pSegments       : Segments to be transmitted.
+ * @param   segmentCount    : Number of segments.
+ *
+ * @return  Result of transmission.
+ *
+ * @retval  GOS_SUCCESS : Transmit successful.
+ * @retval  GOS_ERROR   : Empty UART service configuration, too many
+ *                        segments or low-level driver error.
+ */
+GOS_STATIC gos_result_t drv_sysmonTransmitSegments (drv_uartServiceInstance_t serviceInstance, gos_gcpSegment_t* pSegments, u8_t segmentCount)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t             uartTransmitResult = GOS_ERROR;
+    drv_uartPeriphInstance_t instance           = 0u;
+    drv_uartSegment_t        uartSegments [DRV_UART_TX_SEGMENTS_MAX];
+    u8_t                     segmentIndex       = 0u;
+
+    /*
+     * Function code.
+     */
+    if (uartServiceConfig != NULL && pSegments != NULL && segmentCount <= DRV_UART_TX_SEGMENTS_MAX)
+    {
+        instance = uartServiceConfig[serviceInstance];
+
+        for (segmentIndex = 0u; segmentIndex < segmentCount; segmentIndex++)
+        {
+            uartSegments[segmentIndex].pData = pSegments[segmentIndex].pData;
+            uartSegments[segmentIndex].size  = pSegments[segmentIndex].size;
+        }
+
+        uartTransmitResult = drv_uartTransmitSegments(instance, uartSegments, segmentCount,
+                uartServiceTmoConfig.sysmonTxMutexTmo, uartServiceTmoConfig.sysmonTxTriggerTmo);
+    }
+    else
+    {
+        // Configuration array is NULL or invalid segments.
+    }
+
+    return uartTransmitResult;
+}
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_trace.c
 //! @author     Ahmed Gazar
-//! @date       2024-03-15
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.1
 //!
 //! @brief      GOS2022 Library / Trace driver source.
 //! @details    For a more detailed description of this driver, please refer to @ref drv_trace.h
@@ -25,6 +25,7 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-03-15    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    drv_traceTransmitBinary added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -162,6 +163,35 @@ GOS_INLINE gos_result_t drv_traceTransmit (char_t* pMessage)
     return uartTransmitResult;
 }
 
+/*
+ * Function: drv_traceTransmitBinary
+ */
+gos_result_t drv_traceTransmitBinary (u8_t* pData, u16_t size)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t             uartTransmitResult = GOS_ERROR;
+    drv_uartPeriphInstance_t instance           = 0u;
+
+    /*
+     * Function code.
+     */
+    if (uartServiceConfig != NULL)
+    {
+        instance = uartServiceConfig[DRV_UART_TRACE_INSTANCE];
+
+        uartTransmitResult = drv_uartTransmitDMA(instance, pData, size,
+                uartServiceTmoConfig.traceMutexTmo, uartServiceTmoConfig.traceTriggerTmo);
+    }
+    else
+    {
+        // Configuration array is NULL.
+    }
+
+    return uartTransmitResult;
+}
+
 /*
  * Function: drv_traceEnqueueTraceMessage
  */
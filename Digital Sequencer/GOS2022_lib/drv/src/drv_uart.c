@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_uart.c
 //! @author     Ahmed Gazar
-//! @date       2025-07-23
-//! @version    1.2
+//! @date       2026-10-19
+//! @version    1.6
 //!
 //! @brief      GOS2022 Library / UART driver source.
 //! @details    For a more detailed description of this driver, please refer to @ref drv_uart.h
@@ -27,6 +27,9 @@
 // 1.0        2024-02-01    Ahmed Gazar     Initial version created.
 // 1.1        2024-04-24    Ahmed Gazar     +    Error reporting added
 // 1.3        2025-07-22    Ahmed Gazar     *    Error reporting replaced by diagnostics
+// 1.4        2026-10-19    Ahmed Gazar     +    Interrupt-driven RX ring added
+// 1.5        2026-10-19    Ahmed Gazar     +    Segmented transmission added
+// 1.6        2026-10-19    Ahmed Gazar     *    Segmented transmission start failure only aborts TX
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -96,6 +99,46 @@ GOS_STATIC gos_trigger_t      uartRxReadyTriggers [DRV_UART_NUM_OF_INSTANCES];
  */
 GOS_STATIC gos_trigger_t      uartTxReadyTriggers [DRV_UART_NUM_OF_INSTANCES];
 
+/**
+ * UART RX ring buffers (NULL if the ring is not active).
+ */
+GOS_STATIC u8_t*              uartRxRingBuffers   [DRV_UART_NUM_OF_INSTANCES];
+
+/**
+ * UART RX ring sizes.
+ */
+GOS_STATIC u16_t              uartRxRingSizes     [DRV_UART_NUM_OF_INSTANCES];
+
+/**
+ * UART RX ring write indexes (written by the RX interrupt).
+ */
+GOS_STATIC u16_t              uartRxRingHeads     [DRV_UART_NUM_OF_INSTANCES];
+
+/**
+ * UART RX ring read indexes (written by the reader).
+ */
+GOS_STATIC u16_t              uartRxRingTails     [DRV_UART_NUM_OF_INSTANCES];
+
+/**
+ * UART RX ring reception bytes.
+ */
+GOS_STATIC u8_t               uartRxRingBytes     [DRV_UART_NUM_OF_INSTANCES];
+
+/**
+ * UART TX segment lists of segmented transmissions.
+ */
+GOS_STATIC drv_uartSegment_t  uartTxSegments       [DRV_UART_NUM_OF_INSTANCES][DRV_UART_TX_SEGMENTS_MAX];
+
+/**
+ * UART TX segment counts (0 if no segmented transmission is active).
+ */
+GOS_STATIC u8_t               uartTxSegmentCounts  [DRV_UART_NUM_OF_INSTANCES];
+
+/**
+ * UART TX indexes of the next segment to start.
+ */
+GOS_STATIC u8_t               uartTxSegmentIndexes [DRV_UART_NUM_OF_INSTANCES];
+
 /**
  * UART diagnostics.
  */
@@ -124,6 +167,11 @@ GOS_EXTERN GOS_CONST drv_uartPeriphInstance_t uartServiceConfig [];
  */
 GOS_EXTERN drv_uartServiceTimeoutConfig_t     uartServiceTmoConfig;
 
+/*
+ * Function prototypes
+ */
+GOS_STATIC HAL_StatusTypeDef drv_uartStartSegment (drv_uartPeriphInstance_t instance);
+
 /*
  * Function: drv_uartInit
  */
@@ -590,6 +638,198 @@ GOS_INLINE gos_result_t drv_uartReceiveIT (drv_uartPeriphInstance_t instance, u8
     return uartReceiveResult;
 }
 
+/*
+ * Function: drv_uartTransmitSegments
+ */
+gos_result_t drv_uartTransmitSegments (
+        drv_uartPeriphInstance_t instance,     drv_uartSegment_t* pSegments,
+        u8_t                     segmentCount, u32_t              mutexTmo,
+        u32_t                    triggerTmo
+        )
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t uartTransmitResult = GOS_ERROR;
+    u8_t         segmentIndex       = 0u;
+    u8_t         chainLength        = 0u;
+    bool_t       chainFinished      = GOS_FALSE;
+
+    /*
+     * Function code.
+     */
+    if (instance < DRV_UART_NUM_OF_INSTANCES && pSegments != NULL &&
+        segmentCount <= DRV_UART_TX_SEGMENTS_MAX && triggerTmo > 0u)
+    {
+        if (gos_mutexLock(&uartTxMutexes[instance], mutexTmo) == GOS_SUCCESS)
+        {
+            for (segmentIndex = 0u; segmentIndex < segmentCount; segmentIndex++)
+            {
+                if (pSegments[segmentIndex].pData != NULL && pSegments[segmentIndex].size > 0u)
+                {
+                    uartTxSegments[instance][chainLength++] = pSegments[segmentIndex];
+                }
+                else
+                {
+                    // Empty segment.
+                }
+            }
+
+            uartTxSegmentIndexes[instance] = 0u;
+            uartTxSegmentCounts[instance]  = chainLength;
+
+            if (chainLength == 0u)
+            {
+                uartTransmitResult = GOS_SUCCESS;
+            }
+            else if (drv_uartStartSegment(instance) == HAL_OK)
+            {
+                DRV_ERROR_CLEAR(uartDiag.instanceErrorFlags[instance], DRV_ERROR_UART_TX_SEG_HAL);
+
+                // The TX complete interrupt starts the rest of the segments.
+                if (gos_triggerWait(&uartTxReadyTriggers[instance], 1u, triggerTmo) == GOS_SUCCESS &&
+                    gos_triggerReset(&uartTxReadyTriggers[instance])                == GOS_SUCCESS)
+                {
+                    GOS_ATOMIC_ENTER
+                    chainFinished = (uartTxSegmentCounts[instance]  == chainLength &&
+                                     uartTxSegmentIndexes[instance] == chainLength) ? GOS_TRUE : GOS_FALSE;
+                    uartTxSegmentCounts[instance] = 0u;
+                    GOS_ATOMIC_EXIT
+                }
+                else
+                {
+                    // Trigger error, stop the chain.
+                    GOS_ATOMIC_ENTER
+                    uartTxSegmentCounts[instance] = 0u;
+                    GOS_ATOMIC_EXIT
+                }
+
+                if (chainFinished == GOS_TRUE)
+                {
+                    uartTransmitResult = GOS_SUCCESS;
+                    DRV_ERROR_CLEAR(uartDiag.instanceErrorFlags[instance], DRV_ERROR_UART_TX_SEG_TRIG);
+                }
+                else
+                {
+                    // Trigger or chained segment error.
+                    (void_t) HAL_UART_AbortTransmit_IT(&huarts[instance]);
+                    DRV_ERROR_SET(uartDiag.instanceErrorFlags[instance], DRV_ERROR_UART_TX_SEG_TRIG);
+                }
+            }
+            else
+            {
+                // Transmit error (only abort TX, the RX ring keeps running).
+                (void_t) HAL_UART_AbortTransmit_IT(&huarts[instance]);
+                DRV_ERROR_SET(uartDiag.instanceErrorFlags[instance], DRV_ERROR_UART_TX_SEG_HAL);
+            }
+        }
+        else
+        {
+            // Mutex error.
+            DRV_ERROR_SET(uartDiag.instanceErrorFlags[instance], DRV_ERROR_UART_TX_SEG_MUTEX);
+        }
+
+        (void_t) gos_mutexUnlock(&uartTxMutexes[instance]);
+    }
+    else
+    {
+        // Invalid parameters.
+    }
+
+    return uartTransmitResult;
+}
+
+/*
+ * Function: drv_uartRxRingStart
+ */
+gos_result_t drv_uartRxRingStart (drv_uartPeriphInstance_t instance, u8_t* pRingBuffer, u16_t ringSize)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t rxRingStartResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (instance < DRV_UART_NUM_OF_INSTANCES && pRingBuffer != NULL && ringSize > 1u)
+    {
+        uartRxRingSizes[instance]   = ringSize;
+        uartRxRingHeads[instance]   = 0u;
+        uartRxRingTails[instance]   = 0u;
+        uartRxRingBuffers[instance] = pRingBuffer;
+
+        if (HAL_UART_Receive_IT(&huarts[instance], &uartRxRingBytes[instance], 1u) == HAL_OK)
+        {
+            DRV_ERROR_CLEAR(uartDiag.instanceErrorFlags[instance], DRV_ERROR_UART_RX_RING_HAL);
+            rxRingStartResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Receive error.
+            uartRxRingBuffers[instance] = NULL;
+            DRV_ERROR_SET(uartDiag.instanceErrorFlags[instance], DRV_ERROR_UART_RX_RING_HAL);
+        }
+    }
+    else
+    {
+        // Invalid parameters.
+    }
+
+    return rxRingStartResult;
+}
+
+/*
+ * Function: drv_uartRxRingRead
+ */
+gos_result_t drv_uartRxRingRead (drv_uartPeriphInstance_t instance, u8_t* pData, u16_t size, u16_t* pReadSize, u32_t triggerTmo)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t rxRingReadResult = GOS_ERROR;
+    u16_t        readSize         = 0u;
+    u16_t        tail             = 0u;
+
+    /*
+     * Function code.
+     */
+    if (instance < DRV_UART_NUM_OF_INSTANCES && uartRxRingBuffers[instance] != NULL &&
+        pData != NULL && pReadSize != NULL)
+    {
+        // Reset before the check: a byte received after the check
+        // increments the trigger and releases the wait.
+        (void_t) gos_triggerReset(&uartRxReadyTriggers[instance]);
+
+        if (uartRxRingHeads[instance] == uartRxRingTails[instance] && triggerTmo > 0u)
+        {
+            (void_t) gos_triggerWait(&uartRxReadyTriggers[instance], 1u, triggerTmo);
+        }
+        else
+        {
+            // Data already available.
+        }
+
+        tail = uartRxRingTails[instance];
+
+        while (tail != uartRxRingHeads[instance] && readSize < size)
+        {
+            pData[readSize++] = uartRxRingBuffers[instance][tail];
+            tail = (tail + 1u < uartRxRingSizes[instance]) ? (tail + 1u) : 0u;
+        }
+
+        uartRxRingTails[instance] = tail;
+        *pReadSize                = readSize;
+        rxRingReadResult          = GOS_SUCCESS;
+    }
+    else
+    {
+        // Invalid parameters or ring not started.
+    }
+
+    return rxRingReadResult;
+}
+
 /*
  * Function: USART1_IRQHandler
  */
@@ -679,7 +919,15 @@ void_t HAL_UART_TxCpltCallback (UART_HandleTypeDef *pHuart)
     {
         if (uartInstanceLut[instance] == pHuart->Instance)
         {
-            (void_t) gos_triggerIncrement(&uartTxReadyTriggers[instance]);
+            if (uartTxSegmentIndexes[instance] < uartTxSegmentCounts[instance] &&
+                drv_uartStartSegment(instance) == HAL_OK)
+            {
+                // Next segment started.
+            }
+            else
+            {
+                (void_t) gos_triggerIncrement(&uartTxReadyTriggers[instance]);
+            }
             break;
         }
         else
@@ -698,6 +946,7 @@ void_t HAL_UART_RxCpltCallback (UART_HandleTypeDef *pHuart)
      * Local variables.
      */
     drv_uartPeriphInstance_t instance = DRV_UART_INSTANCE_1;
+    u16_t                    nextHead = 0u;
 
     /*
      * Function code.
@@ -706,6 +955,30 @@ void_t HAL_UART_RxCpltCallback (UART_HandleTypeDef *pHuart)
     {
         if (uartInstanceLut[instance] == pHuart->Instance)
         {
+            if (uartRxRingBuffers[instance] != NULL)
+            {
+                nextHead = (uartRxRingHeads[instance] + 1u < uartRxRingSizes[instance]) ?
+                        (uartRxRingHeads[instance] + 1u) : 0u;
+
+                if (nextHead != uartRxRingTails[instance])
+                {
+                    uartRxRingBuffers[instance][uartRxRingHeads[instance]] = uartRxRingBytes[instance];
+                    uartRxRingHeads[instance] = nextHead;
+                }
+                else
+                {
+                    // Ring full, byte is dropped.
+                    DRV_ERROR_SET(uartDiag.instanceErrorFlags[instance], DRV_ERROR_UART_RX_RING_OVERFLOW);
+                }
+
+                // Re-arm reception of the next byte.
+                (void_t) HAL_UART_Receive_IT(pHuart, &uartRxRingBytes[instance], 1u);
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
             (void_t) gos_triggerIncrement(&uartRxReadyTriggers[instance]);
             break;
         }
@@ -814,6 +1087,16 @@ void_t HAL_UART_ErrorCallback (UART_HandleTypeDef* pHuart)
         	__HAL_UART_CLEAR_FEFLAG(pHuart);
         	__HAL_UART_CLEAR_NEFLAG(pHuart);
         	__HAL_UART_CLEAR_OREFLAG(pHuart);
+
+        	// Restart the RX ring reception (aborted above).
+        	if (uartRxRingBuffers[instance] != NULL)
+        	{
+        	    (void_t) HAL_UART_Receive_IT(pHuart, &uartRxRingBytes[instance], 1u);
+        	}
+        	else
+        	{
+        	    // Nothing to do.
+        	}
         	break;
         }
         else
@@ -822,3 +1105,46 @@ void_t HAL_UART_ErrorCallback (UART_HandleTypeDef* pHuart)
         }
     }
 }
+
+/**
+ * @brief   Starts the next segment of a segmented transmission.
+ * @details Uses DMA if a TX DMA is linked to the instance, interrupt-driven transmission
+ *          otherwise. If the segment cannot be started, the chain is stopped.
+ *
+ * @param[in] instance UART periphery instance.
+ *
+ * @return  HAL status of the transmission start.
+ */
+GOS_STATIC HAL_StatusTypeDef drv_uartStartSegment (drv_uartPeriphInstance_t instance)
+{
+    /*
+     * Local variables.
+     */
+    HAL_StatusTypeDef  startStatus = HAL_ERROR;
+    drv_uartSegment_t* pSegment    = &uartTxSegments[instance][uartTxSegmentIndexes[instance]];
+
+    /*
+     * Function code.
+     */
+    uartTxSegmentIndexes[instance]++;
+
+    if (huarts[instance].hdmatx != NULL)
+    {
+        startStatus = HAL_UART_Transmit_DMA(&huarts[instance], pSegment->pData, pSegment->size);
+    }
+    else
+    {
+        startStatus = HAL_UART_Transmit_IT(&huarts[instance], pSegment->pData, pSegment->size);
+    }
+
+    if (startStatus != HAL_OK)
+    {
+        uartTxSegmentCounts[instance] = 0u;
+    }
+    else
+    {
+        // Segment started.
+    }
+
+    return startStatus;
+}
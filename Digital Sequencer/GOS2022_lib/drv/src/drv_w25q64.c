@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       drv_w25q64.c
 //! @author     Ahmed Gazar
-//! @date       2024-12-24
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.4
 //!
 //! @brief      GOS2022 Library / W25Q64 driver source.
 //! @details    For a more detailed description of this driver, please refer to @ref drv_w25q64.h
@@ -25,6 +25,17 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-12-24    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    drv_w25q64EraseData and drv_w25q64ProgramData added
+//                                          *    drv_w25q64WriteData only erases if the target
+//                                               bytes cannot be programmed directly
+// 1.2        2026-10-19    Ahmed Gazar     +    Double-buffered read stream added
+//                                          +    Optional DMA reception for data reads
+//                                          *    Reads longer than 64 kB split into blocks
+// 1.3        2026-10-19    Ahmed Gazar     +    drv_w25q64EraseData uses 64 kB block erase for
+//                                               whole blocks
+//                                          *    Erase waits for the busy flag instead of a fixed
+//                                               delay and sets DRV_ERROR_W25Q64_ERASE on failure
+// 1.4        2026-10-19    Ahmed Gazar     *    Read stream locks the SPI bus from start to stop
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -61,7 +72,45 @@
 /**
  * Size of a sector.
  */
-#define SECTOR_SIZE ( 4096u )
+#define SECTOR_SIZE     ( 4096u )
+
+/**
+ * Maximum size of a single SPI reception.
+ */
+#define READ_BLOCK_SIZE ( 32768u )
+
+/**
+ * Number of sectors in an erase block.
+ */
+#define BLOCK_SECTORS   ( 16u )
+
+/**
+ * Maximum sector erase time [ms].
+ */
+#define SECTOR_ERASE_TMO ( 400u )
+
+/**
+ * Maximum block erase time [ms].
+ */
+#define BLOCK_ERASE_TMO ( 2000u )
+
+/**
+ * Status register busy bit.
+ */
+#define STATUS_BUSY     ( 0x01u )
+
+/*
+ * Type definitions
+ */
+/**
+ * Write mode of a sector segment.
+ */
+typedef enum
+{
+	W25Q64_WRITE_SKIP,      //!< Target bytes already equal to the data.
+	W25Q64_WRITE_PROGRAM,   //!< Data can be programmed directly (only 1 -> 0 bit changes).
+	W25Q64_WRITE_ERASE      //!< Sector has to be erased and rewritten.
+}drv_w25q64WriteMode_t;
 
 /*
  * Static variables
@@ -81,6 +130,8 @@ GOS_STATIC u8_t pageWriteBuffer [266];
  */
 GOS_STATIC void_t drv_w25q64ReadDataFast   (void_t* pDevice, u32_t startPage, u8_t offset, u8_t* pData, u32_t size);
 GOS_STATIC void_t drv_w25q64WriteDataClean (void_t* pDevice, u32_t startPage, u8_t offset, u8_t* pData, u32_t size);
+GOS_STATIC void_t drv_w25q64ProgramPages   (void_t* pDevice, u32_t startPage, u8_t offset, u8_t* pData, u32_t size);
+GOS_STATIC drv_w25q64WriteMode_t drv_w25q64GetWriteMode (u8_t* pCurrent, u8_t* pData, u32_t size);
 GOS_STATIC u32_t  drv_w25q64BytesToWrite   (u32_t size, u16_t offset);
 GOS_STATIC u32_t  drv_w25q64BytesToModify  (u32_t size, u16_t offset);
 GOS_STATIC void_t drv_w25q64ChipSelectLow  (void_t* pDevice);
@@ -88,8 +139,12 @@ GOS_STATIC void_t drv_w25q64ChipSelectHigh (void_t* pDevice);
 GOS_STATIC void_t drv_w25q64WriteEnable    (void_t* pDevice);
 GOS_STATIC void_t drv_w25q64WriteDisable   (void_t* pDevice);
 GOS_STATIC void_t drv_w25q64Write          (void_t* pDevice, u8_t* pData, u16_t size);
-GOS_STATIC void_t drv_w25q64Read           (void_t* pDevice, u8_t* pData, u16_t size);
+GOS_STATIC void_t drv_w25q64Read           (void_t* pDevice, u8_t* pData, u32_t size);
+GOS_STATIC void_t drv_w25q64StreamFill     (void_t* pDevice, u8_t* pData, u32_t size);
+GOS_STATIC void_t drv_w25q64StreamComplete (void_t* pDevice);
 GOS_STATIC void_t drv_w25q64EraseSector    (void_t* pDevice, u16_t sector);
+GOS_STATIC void_t drv_w25q64EraseBlock     (void_t* pDevice, u16_t block);
+GOS_STATIC void_t drv_w25q64WaitReady      (void_t* pDevice, u32_t timeout);
 
 /*
  * Function: drv_w25q64Init
@@ -305,19 +360,39 @@ GOS_INLINE void_t drv_w25q64WriteData (void_t* pDevice, u32_t address, u8_t* pDa
 		{
 			u32_t _startPage = startSector * 16;
 
-			//(void_t) memset(sectorBuffer, 0, SECTOR_SIZE);
-
-			drv_w25q64ReadDataFast(pDevice, _startPage, 0, sectorBuffer, SECTOR_SIZE);
-
 			u16_t bytesRem = drv_w25q64BytesToModify(size, sectorOffset);
 
-			for (u16_t j = 0u; j < bytesRem; j++)
+			// Only read the target bytes to check if they can be programmed directly.
+			drv_w25q64ReadDataFast(pDevice, _startPage + (sectorOffset / W25Q64_PAGE_SIZE),
+					(u8_t)(sectorOffset % W25Q64_PAGE_SIZE), sectorBuffer, bytesRem);
+
+			switch (drv_w25q64GetWriteMode(sectorBuffer, &pData[dataIndx], bytesRem))
 			{
-				sectorBuffer[j + sectorOffset] = pData[j + dataIndx];
+				case W25Q64_WRITE_PROGRAM:
+				{
+					drv_w25q64ProgramPages(pDevice, _startPage + (sectorOffset / W25Q64_PAGE_SIZE),
+							(u8_t)(sectorOffset % W25Q64_PAGE_SIZE), &pData[dataIndx], bytesRem);
+					break;
+				}
+				case W25Q64_WRITE_ERASE:
+				{
+					drv_w25q64ReadDataFast(pDevice, _startPage, 0, sectorBuffer, SECTOR_SIZE);
+
+					for (u16_t j = 0u; j < bytesRem; j++)
+					{
+						sectorBuffer[j + sectorOffset] = pData[j + dataIndx];
+					}
+
+					drv_w25q64WriteDataClean(pDevice, _startPage, 0, sectorBuffer, SECTOR_SIZE);
+					break;
+				}
+				default:
+				{
+					// Data already in place.
+					break;
+				}
 			}
 
-			drv_w25q64WriteDataClean(pDevice, _startPage, 0, sectorBuffer, SECTOR_SIZE);
-
 			startSector++;
 			sectorOffset = 0;
 			dataIndx = dataIndx + bytesRem;
@@ -332,6 +407,166 @@ GOS_INLINE void_t drv_w25q64WriteData (void_t* pDevice, u32_t address, u8_t* pDa
 	}
 }
 
+/*
+ * Function: drv_w25q64EraseData
+ */
+GOS_INLINE void_t drv_w25q64EraseData (void_t* pDevice, u32_t address, u32_t size)
+{
+	/*
+	 * Local variables.
+	 */
+	u32_t startSector = (address + SECTOR_SIZE - 1) / SECTOR_SIZE;
+	u32_t endSector   = (address + size) / SECTOR_SIZE;
+	u32_t sector      = 0u;
+
+    /*
+     * Function code.
+     */
+	if (pDevice != NULL)
+	{
+        DRV_ERROR_CHK_SET(
+                gos_mutexLock(&((drv_w25q64Descriptor_t*)pDevice)->deviceMutex, ((drv_w25q64Descriptor_t*)pDevice)->writeMutexTmo),
+				((drv_w25q64Descriptor_t*)pDevice)->errorFlags,
+                DRV_ERROR_W25Q64_MUTEX_LOCK
+                );
+
+		// Only the sectors that are entirely in the range are erased.
+		// Whole blocks are erased at once.
+		sector = startSector;
+
+		while (sector < endSector)
+		{
+			if (((sector % BLOCK_SECTORS) == 0u) && ((sector + BLOCK_SECTORS) <= endSector))
+			{
+				drv_w25q64EraseBlock(pDevice, (u16_t)(sector / BLOCK_SECTORS));
+				sector += BLOCK_SECTORS;
+			}
+			else
+			{
+				drv_w25q64EraseSector(pDevice, (u16_t)sector);
+				sector++;
+			}
+		}
+
+		(void_t) gos_mutexUnlock(&((drv_w25q64Descriptor_t*)pDevice)->deviceMutex);
+	}
+	else
+	{
+		// Device is NULL pointer.
+	}
+}
+
+/*
+ * Function: drv_w25q64ProgramData
+ */
+GOS_INLINE void_t drv_w25q64ProgramData (void_t* pDevice, u32_t address, u8_t* pData, u32_t size)
+{
+    /*
+     * Function code.
+     */
+	if ((pDevice != NULL) && (pData != NULL) && (size > 0u))
+	{
+        DRV_ERROR_CHK_SET(
+                gos_mutexLock(&((drv_w25q64Descriptor_t*)pDevice)->deviceMutex, ((drv_w25q64Descriptor_t*)pDevice)->writeMutexTmo),
+				((drv_w25q64Descriptor_t*)pDevice)->errorFlags,
+                DRV_ERROR_W25Q64_MUTEX_LOCK
+                );
+
+		drv_w25q64ProgramPages(pDevice, address / W25Q64_PAGE_SIZE, (u8_t)(address % W25Q64_PAGE_SIZE), pData, size);
+
+		(void_t) gos_mutexUnlock(&((drv_w25q64Descriptor_t*)pDevice)->deviceMutex);
+	}
+	else
+	{
+		// Device or data is NULL pointer.
+	}
+}
+
+/*
+ * Function: drv_w25q64ReadStreamStart
+ */
+GOS_INLINE void_t drv_w25q64ReadStreamStart (void_t* pDevice, u32_t address, u8_t* pData, u32_t size)
+{
+	/*
+	 * Local variables.
+	 */
+	u8_t command [] = { 0x0b, (u8_t)((address >> 16) & 0xFF),
+						(u8_t)((address >> 8) & 0xFF), (u8_t)(address & 0xFF), 0x00 };
+
+    /*
+     * Function code.
+     */
+	if (pDevice != NULL)
+	{
+        DRV_ERROR_CHK_SET(
+                gos_mutexLock(&((drv_w25q64Descriptor_t*)pDevice)->deviceMutex, ((drv_w25q64Descriptor_t*)pDevice)->readMutexTmo),
+				((drv_w25q64Descriptor_t*)pDevice)->errorFlags,
+                DRV_ERROR_W25Q64_MUTEX_LOCK
+                );
+
+		((drv_w25q64Descriptor_t*)pDevice)->streamPending = GOS_FALSE;
+
+		// The chip keeps clocking out consecutive bytes as long as chip select is low,
+		// so no other device on the bus may be accessed until the stream is stopped.
+		if (drv_spiBusLock(((drv_w25q64Descriptor_t*)pDevice)->spiInstance,
+				((drv_w25q64Descriptor_t*)pDevice)->readMutexTmo) == GOS_SUCCESS)
+		{
+			drv_w25q64ChipSelectLow(pDevice);
+			drv_w25q64Write(pDevice, command, 5);
+			drv_w25q64StreamFill(pDevice, pData, size);
+		}
+		else
+		{
+			DRV_ERROR_SET(((drv_w25q64Descriptor_t*)pDevice)->errorFlags, DRV_ERROR_W25Q64_READ);
+		}
+	}
+	else
+	{
+		// Device is NULL pointer.
+	}
+}
+
+/*
+ * Function: drv_w25q64ReadStreamNext
+ */
+GOS_INLINE void_t drv_w25q64ReadStreamNext (void_t* pDevice, u8_t* pData, u32_t size)
+{
+    /*
+     * Function code.
+     */
+	if (pDevice != NULL)
+	{
+		drv_w25q64StreamComplete(pDevice);
+		drv_w25q64StreamFill(pDevice, pData, size);
+	}
+	else
+	{
+		// Device is NULL pointer.
+	}
+}
+
+/*
+ * Function: drv_w25q64ReadStreamStop
+ */
+GOS_INLINE void_t drv_w25q64ReadStreamStop (void_t* pDevice)
+{
+    /*
+     * Function code.
+     */
+	if (pDevice != NULL)
+	{
+		drv_w25q64StreamComplete(pDevice);
+		drv_w25q64ChipSelectHigh(pDevice);
+
+		(void_t) drv_spiBusUnlock(((drv_w25q64Descriptor_t*)pDevice)->spiInstance);
+		(void_t) gos_mutexUnlock(&((drv_w25q64Descriptor_t*)pDevice)->deviceMutex);
+	}
+	else
+	{
+		// Device is NULL pointer.
+	}
+}
+
 /**
  * @brief   Reads data in fast mode.
  * @details Sends a fast read command to the chip.
@@ -377,11 +612,9 @@ GOS_STATIC void_t drv_w25q64WriteDataClean (void_t* pDevice, u32_t startPage, u8
 	 * Local variables.
 	 */
 	u32_t endPage      = startPage + ((size + offset - 1) / W25Q64_PAGE_SIZE);
-	u32_t numOfPages   = endPage - startPage + 1;
 	u16_t startSector  = startPage / 16;
 	u16_t endSector    = endPage / 16;
 	u16_t numOfSectors = endSector - startSector + 1;
-	u32_t dataPosition = 0u;
 	u32_t idx;
 
     /*
@@ -392,6 +625,35 @@ GOS_STATIC void_t drv_w25q64WriteDataClean (void_t* pDevice, u32_t startPage, u8
 		drv_w25q64EraseSector(pDevice, (startSector + idx));
 	}
 
+	drv_w25q64ProgramPages(pDevice, startPage, offset, pData, size);
+}
+
+/**
+ * @brief   Programs data page by page.
+ * @details Sends page program commands without erasing. The target bytes
+ *          shall be erased (or only contain bits to be cleared).
+ *
+ * @param   pDevice   : Pointer to the device descriptor.
+ * @param   startPage : Page to start programming at.
+ * @param   offset    : Byte offset within the start page.
+ * @param   pData     : Data to be programmed.
+ * @param   size      : Size of data to be programmed.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t drv_w25q64ProgramPages (void_t* pDevice, u32_t startPage, u8_t offset, u8_t* pData, u32_t size)
+{
+	/*
+	 * Local variables.
+	 */
+	u32_t endPage      = startPage + ((size + offset - 1) / W25Q64_PAGE_SIZE);
+	u32_t numOfPages   = endPage - startPage + 1;
+	u32_t dataPosition = 0u;
+	u32_t idx;
+
+    /*
+     * Function code.
+     */
 	(void_t) memset(pageWriteBuffer, 0, 266);
 
 	for (idx = 0; idx < numOfPages; idx++)
@@ -431,6 +693,48 @@ GOS_STATIC void_t drv_w25q64WriteDataClean (void_t* pDevice, u32_t startPage, u8
 	}
 }
 
+/**
+ * @brief   Determines how the data can be written.
+ * @details Compares the current content of the target bytes with the data. Programming
+ *          can only clear bits, so an erase is needed if any bit has to be set.
+ *
+ * @param   pCurrent : Current content of the target bytes.
+ * @param   pData    : Data to be written.
+ * @param   size     : Size of data.
+ *
+ * @return  Write mode.
+ */
+GOS_STATIC drv_w25q64WriteMode_t drv_w25q64GetWriteMode (u8_t* pCurrent, u8_t* pData, u32_t size)
+{
+	/*
+	 * Local variables.
+	 */
+	drv_w25q64WriteMode_t writeMode = W25Q64_WRITE_SKIP;
+	u32_t                 idx       = 0u;
+
+    /*
+     * Function code.
+     */
+	for (idx = 0u; idx < size; idx++)
+	{
+		if ((pCurrent[idx] & pData[idx]) != pData[idx])
+		{
+			writeMode = W25Q64_WRITE_ERASE;
+			break;
+		}
+		else if (pCurrent[idx] != pData[idx])
+		{
+			writeMode = W25Q64_WRITE_PROGRAM;
+		}
+		else
+		{
+			// Byte already in place.
+		}
+	}
+
+	return writeMode;
+}
+
 /**
  * @brief   Calculates the number of bytes to write.
  * @details Calculates the number of bytes to write.
@@ -601,37 +905,163 @@ GOS_STATIC void_t drv_w25q64Write (void_t* pDevice, u8_t* pData, u16_t size)
 }
 
 /**
- * @brief
- * @details TODO
+ * @brief   Receives data from the chip.
+ * @details Receives the given number of bytes in blocks of at most
+ *          READ_BLOCK_SIZE bytes, via DMA if it is enabled for the device.
  *
- * @param pDevice
- * @param pData
- * @param size
- * @return
+ * @param   pDevice : Pointer to the device descriptor.
+ * @param   pData   : Target buffer.
+ * @param   size    : Number of bytes to receive.
+ *
+ * @return  -
  */
-GOS_STATIC void_t drv_w25q64Read (void_t* pDevice, u8_t* pData, u16_t size)
+GOS_STATIC void_t drv_w25q64Read (void_t* pDevice, u8_t* pData, u32_t size)
 {
+	/*
+	 * Local variables.
+	 */
+	u16_t        blockSize     = 0u;
+	gos_result_t receiveResult = GOS_SUCCESS;
+
     /*
      * Function code.
      */
-    DRV_ERROR_CHK_SET(
-            drv_spiReceiveIT(
-            		((drv_w25q64Descriptor_t*)pDevice)->spiInstance,
+	while (size > 0u)
+	{
+		blockSize = (u16_t)(size > READ_BLOCK_SIZE ? READ_BLOCK_SIZE : size);
+
+		if (((drv_w25q64Descriptor_t*)pDevice)->useDma == GOS_TRUE)
+		{
+			receiveResult = drv_spiReceiveDMA(
+					((drv_w25q64Descriptor_t*)pDevice)->spiInstance,
 					pData,
-					size,
+					blockSize,
 					((drv_w25q64Descriptor_t*)pDevice)->readMutexTmo,
 					((drv_w25q64Descriptor_t*)pDevice)->readTriggerTmo
-					),
-			((drv_w25q64Descriptor_t*)pDevice)->errorFlags,
-			DRV_ERROR_W25Q64_READ
-            );
+					);
+		}
+		else
+		{
+			receiveResult = drv_spiReceiveIT(
+					((drv_w25q64Descriptor_t*)pDevice)->spiInstance,
+					pData,
+					blockSize,
+					((drv_w25q64Descriptor_t*)pDevice)->readMutexTmo,
+					((drv_w25q64Descriptor_t*)pDevice)->readTriggerTmo
+					);
+		}
+
+		DRV_ERROR_CHK_SET(
+				receiveResult,
+				((drv_w25q64Descriptor_t*)pDevice)->errorFlags,
+				DRV_ERROR_W25Q64_READ
+				);
+
+		pData = &pData[blockSize];
+		size  = size - blockSize;
+	}
 }
 
 /**
- * TODO
- * @param pDevice
- * @param sector
- * @return
+ * @brief   Starts filling a read stream buffer.
+ * @details If DMA is enabled for the device and the buffer fits in a single
+ *          reception, the reception is only started and completed later by
+ *          #drv_w25q64StreamComplete. Otherwise the buffer is filled before
+ *          the function returns.
+ *
+ * @param   pDevice : Pointer to the device descriptor.
+ * @param   pData   : Target buffer (NULL if no further data is needed).
+ * @param   size    : Number of bytes to read.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t drv_w25q64StreamFill (void_t* pDevice, u8_t* pData, u32_t size)
+{
+	/*
+	 * Local variables.
+	 */
+	gos_result_t receiveResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+	if ((pData != NULL) && (size > 0u))
+	{
+		if ((((drv_w25q64Descriptor_t*)pDevice)->useDma == GOS_TRUE) && (size <= READ_BLOCK_SIZE))
+		{
+			receiveResult = drv_spiReceiveDMA(
+					((drv_w25q64Descriptor_t*)pDevice)->spiInstance,
+					pData,
+					(u16_t)size,
+					((drv_w25q64Descriptor_t*)pDevice)->readMutexTmo,
+					0u
+					);
+
+			if (receiveResult == GOS_SUCCESS)
+			{
+				((drv_w25q64Descriptor_t*)pDevice)->streamPending = GOS_TRUE;
+			}
+			else
+			{
+				DRV_ERROR_CHK_SET(
+						receiveResult,
+						((drv_w25q64Descriptor_t*)pDevice)->errorFlags,
+						DRV_ERROR_W25Q64_READ
+						);
+			}
+		}
+		else
+		{
+			drv_w25q64Read(pDevice, pData, size);
+		}
+	}
+	else
+	{
+		// No data requested.
+	}
+}
+
+/**
+ * @brief   Completes the pending read stream buffer.
+ * @details Waits for the DMA reception started by #drv_w25q64StreamFill
+ *          (if there is any).
+ *
+ * @param   pDevice : Pointer to the device descriptor.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t drv_w25q64StreamComplete (void_t* pDevice)
+{
+    /*
+     * Function code.
+     */
+	if (((drv_w25q64Descriptor_t*)pDevice)->streamPending == GOS_TRUE)
+	{
+		((drv_w25q64Descriptor_t*)pDevice)->streamPending = GOS_FALSE;
+
+		DRV_ERROR_CHK_SET(
+				drv_spiReceiveDMAWait(
+						((drv_w25q64Descriptor_t*)pDevice)->spiInstance,
+						((drv_w25q64Descriptor_t*)pDevice)->readTriggerTmo
+						),
+				((drv_w25q64Descriptor_t*)pDevice)->errorFlags,
+				DRV_ERROR_W25Q64_READ
+				);
+	}
+	else
+	{
+		// No reception in progress.
+	}
+}
+
+/**
+ * @brief   Erases a sector.
+ * @details Sends a sector erase command and waits for the chip to finish.
+ *
+ * @param   pDevice : Pointer to the device descriptor.
+ * @param   sector  : Sector to erase.
+ *
+ * @return  -
  */
 GOS_STATIC void_t drv_w25q64EraseSector (void_t* pDevice, u16_t sector)
 {
@@ -650,7 +1080,81 @@ GOS_STATIC void_t drv_w25q64EraseSector (void_t* pDevice, u16_t sector)
 	drv_w25q64Write(pDevice, command, 4);
 	drv_w25q64ChipSelectHigh(pDevice);
 
-	(void_t) gos_taskSleep(450);
+	drv_w25q64WaitReady(pDevice, SECTOR_ERASE_TMO);
+
+	drv_w25q64WriteDisable(pDevice);
+}
+
+/**
+ * @brief   Erases a 64 kB block.
+ * @details Sends a block erase command and waits for the chip to finish.
+ *
+ * @param   pDevice : Pointer to the device descriptor.
+ * @param   block   : Block to erase.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t drv_w25q64EraseBlock (void_t* pDevice, u16_t block)
+{
+	/*
+	 * Local variables.
+	 */
+	u32_t memAddress = block * BLOCK_SECTORS * SECTOR_SIZE;
+	u8_t  command [] = { 0xD8, (u8_t)((memAddress >> 16) & 0xFF),
+		(u8_t)((memAddress >> 8) & 0xFF), (u8_t)(memAddress & 0xFF) };
+
+    /*
+     * Function code.
+     */
+	drv_w25q64WriteEnable(pDevice);
+	drv_w25q64ChipSelectLow(pDevice);
+	drv_w25q64Write(pDevice, command, 4);
+	drv_w25q64ChipSelectHigh(pDevice);
+
+	drv_w25q64WaitReady(pDevice, BLOCK_ERASE_TMO);
 
 	drv_w25q64WriteDisable(pDevice);
 }
+
+/**
+ * @brief   Waits for the chip to finish an operation.
+ * @details Polls the busy bit of the status register. Sets the erase error
+ *          flag if the chip is still busy after the given time.
+ *
+ * @param   pDevice : Pointer to the device descriptor.
+ * @param   timeout : Maximum time to wait [ms].
+ *
+ * @return  -
+ */
+GOS_STATIC void_t drv_w25q64WaitReady (void_t* pDevice, u32_t timeout)
+{
+	/*
+	 * Local variables.
+	 */
+	u8_t  command = 0x05;
+	u8_t  status  = STATUS_BUSY;
+	u32_t elapsed = 0u;
+
+    /*
+     * Function code.
+     */
+	while (((status & STATUS_BUSY) != 0u) && (elapsed <= timeout))
+	{
+		(void_t) gos_taskSleep(5);
+		elapsed += 5u;
+
+		drv_w25q64ChipSelectLow(pDevice);
+		drv_w25q64Write(pDevice, &command, 1);
+		drv_w25q64Read(pDevice, &status, 1);
+		drv_w25q64ChipSelectHigh(pDevice);
+	}
+
+	if ((status & STATUS_BUSY) != 0u)
+	{
+		DRV_ERROR_SET(((drv_w25q64Descriptor_t*)pDevice)->errorFlags, DRV_ERROR_W25Q64_ERASE);
+	}
+	else
+	{
+		// Operation finished.
+	}
+}
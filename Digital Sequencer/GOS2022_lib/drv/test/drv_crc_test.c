@@ -0,0 +1,388 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2026
+//
+//*************************************************************************************************
+//! @file       drv_crc_test.c
+//! @author     Ahmed Gazar
+//! @date       2026-10-19
+//! @version    1.0
+//!
+//! @brief      GOS2022 Library / Cyclic Redundancy Check driver host test and benchmark.
+//! @details    Checks the software CRC backend against known-answer vectors and a bitwise
+//!             reference model for all widths, unaligned buffers and split streaming updates,
+//!             then measures the throughput of the configured method. Built and run for every
+//!             method by the makefile in this directory.
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-19    Ahmed Gazar     Initial version created.
+//*************************************************************************************************
+/*
+ * Includes
+ */
+#include <drv_crc.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Macros
+ */
+/**
+ * Longest buffer checked against the reference model.
+ */
+#define TEST_MAX_LENGTH         ( 300u )
+/**
+ * Number of start offsets (alignments) checked.
+ */
+#define TEST_OFFSETS            ( 4u )
+/**
+ * Benchmark buffer size.
+ */
+#define BENCH_SIZE              ( 4096u )
+/**
+ * Benchmark iterations.
+ */
+#define BENCH_ITERATIONS        ( 20000u )
+
+/**
+ * Checks a condition and counts a failure.
+ */
+#define TEST_CHECK(cond, ...)   do { if (!(cond)) { failCounter++; printf("FAIL: " __VA_ARGS__); printf("\n"); } } while (0)
+
+/*
+ * Type definitions
+ */
+/**
+ * Known-answer vector.
+ */
+typedef struct
+{
+    const char_t* pInput; //!< Input string.
+    u8_t          crc8;   //!< Expected 8-bit CRC.
+    u16_t         crc16;  //!< Expected 16-bit CRC.
+    u32_t         crc32;  //!< Expected 32-bit CRC.
+    u64_t         crc64;  //!< Expected 64-bit CRC.
+}test_crcVector_t;
+
+/*
+ * Static variables
+ */
+/**
+ * Known-answer vectors. The driver XORs each byte into the low end of the register and
+ * shifts the full register width (no reflection, no final XOR); these values lock that
+ * format, which is shared with the bootloader and the download host.
+ */
+GOS_STATIC GOS_CONST test_crcVector_t testVectors [] =
+{
+    { "",          0xFFu, 0xFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFFFFFFFFFu },
+    { "123456789", 0xFBu, 0x3278u, 0x1556F485u, 0x0D5B28BF8F808678u },
+};
+
+/**
+ * Failure counter.
+ */
+GOS_STATIC u32_t testFailCounter = 0u;
+
+/**
+ * Test buffer (room for the longest buffer at every offset).
+ */
+GOS_STATIC u8_t testBuffer [TEST_MAX_LENGTH + TEST_OFFSETS];
+
+/**
+ * Benchmark buffer.
+ */
+GOS_STATIC u8_t benchBuffer [BENCH_SIZE];
+
+/*
+ * Function prototypes
+ */
+GOS_STATIC u64_t test_crcReference  (u8_t* pData, u32_t dataSize, u8_t width, u64_t polynomial, u64_t initValue);
+GOS_STATIC void_t test_crcVectors   (void_t);
+GOS_STATIC void_t test_crcReferenceEquivalence (void_t);
+GOS_STATIC void_t test_crcStreaming (void_t);
+GOS_STATIC void_t test_crcBenchmark (void_t);
+
+/*
+ * Function: main
+ */
+int main (void_t)
+{
+    /*
+     * Function code.
+     */
+    (void_t) drv_crcInit();
+
+    test_crcVectors();
+    test_crcReferenceEquivalence();
+    test_crcStreaming();
+
+    printf("drv_crc (method %u): %s (%u failures)\n", (u32_t)DRV_CRC_METHOD,
+            testFailCounter == 0u ? "PASS" : "FAIL", testFailCounter);
+
+    test_crcBenchmark();
+
+    return testFailCounter == 0u ? 0 : 1;
+}
+
+/**
+ * @brief   Bitwise reference CRC.
+ * @details Straightforward model of the driver CRC format for any width.
+ *
+ * @param   pData      : Data to calculate the CRC of.
+ * @param   dataSize   : Size of the data.
+ * @param   width      : CRC width in bits.
+ * @param   polynomial : Polynomial.
+ * @param   initValue  : Initial register value.
+ *
+ * @return  CRC value.
+ */
+GOS_STATIC u64_t test_crcReference (u8_t* pData, u32_t dataSize, u8_t width, u64_t polynomial, u64_t initValue)
+{
+    /*
+     * Local variables.
+     */
+    u64_t mask       = (width == 64u) ? 0xFFFFFFFFFFFFFFFFu : ((1ull << width) - 1u);
+    u64_t topBit     = 1ull << (width - 1u);
+    u64_t crcValue   = initValue & mask;
+    u32_t index      = 0u;
+    u8_t  bitCounter = 0u;
+
+    /*
+     * Function code.
+     */
+    for (index = 0u; index < dataSize; index++)
+    {
+        crcValue ^= pData[index];
+
+        for (bitCounter = 0u; bitCounter < width; bitCounter++)
+        {
+            crcValue = ((crcValue & topBit) != 0u) ? (((crcValue << 1u) ^ polynomial) & mask) : ((crcValue << 1u) & mask);
+        }
+    }
+
+    return crcValue;
+}
+
+/**
+ * @brief   Checks the known-answer vectors.
+ * @details Checks every width through the one-shot API.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t test_crcVectors (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u32_t vectorIndex = 0u;
+    u32_t dataSize    = 0u;
+    u8_t  crc8        = 0u;
+    u16_t crc16       = 0u;
+    u32_t crc32       = 0u;
+    u64_t crc64       = 0u;
+    u32_t failCounter = 0u;
+
+    /*
+     * Function code.
+     */
+    for (vectorIndex = 0u; vectorIndex < sizeof(testVectors) / sizeof(testVectors[0]); vectorIndex++)
+    {
+        dataSize = (u32_t)strlen(testVectors[vectorIndex].pInput);
+        (void_t) memcpy((void_t*)testBuffer, (const void_t*)testVectors[vectorIndex].pInput, dataSize);
+
+        TEST_CHECK(drv_crcGetCrc8(testBuffer, dataSize, &crc8) == GOS_SUCCESS &&
+                   crc8 == testVectors[vectorIndex].crc8, "vector %u crc8 %02X", vectorIndex, crc8);
+        TEST_CHECK(drv_crcGetCrc16(testBuffer, dataSize, &crc16) == GOS_SUCCESS &&
+                   crc16 == testVectors[vectorIndex].crc16, "vector %u crc16 %04X", vectorIndex, crc16);
+        TEST_CHECK(drv_crcGetCrc32(testBuffer, dataSize, &crc32) == GOS_SUCCESS &&
+                   crc32 == testVectors[vectorIndex].crc32, "vector %u crc32 %08X", vectorIndex, crc32);
+        TEST_CHECK(drv_crcGetCrc64(testBuffer, dataSize, &crc64) == GOS_SUCCESS &&
+                   crc64 == testVectors[vectorIndex].crc64, "vector %u crc64 %016llX", vectorIndex, (unsigned long long)crc64);
+    }
+
+    testFailCounter += failCounter;
+}
+
+/**
+ * @brief   Checks every width against the reference model.
+ * @details Covers lengths 0 to TEST_MAX_LENGTH - 1 at every start offset, so the
+ *          slice loops and their byte-wise tails run on unaligned data.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t test_crcReferenceEquivalence (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u32_t index       = 0u;
+    u32_t offset      = 0u;
+    u32_t dataSize    = 0u;
+    u8_t  crc8        = 0u;
+    u16_t crc16       = 0u;
+    u32_t crc32       = 0u;
+    u64_t crc64       = 0u;
+    u32_t failCounter = 0u;
+
+    /*
+     * Function code.
+     */
+    for (index = 0u; index < sizeof(testBuffer); index++)
+    {
+        testBuffer[index] = (u8_t)(index * 131u + 7u);
+    }
+
+    for (offset = 0u; offset < TEST_OFFSETS; offset++)
+    {
+        for (dataSize = 0u; dataSize < TEST_MAX_LENGTH; dataSize++)
+        {
+            (void_t) drv_crcGetCrc8(&testBuffer[offset], dataSize, &crc8);
+            (void_t) drv_crcGetCrc16(&testBuffer[offset], dataSize, &crc16);
+            (void_t) drv_crcGetCrc32(&testBuffer[offset], dataSize, &crc32);
+            (void_t) drv_crcGetCrc64(&testBuffer[offset], dataSize, &crc64);
+
+            TEST_CHECK(crc8 == (u8_t)test_crcReference(&testBuffer[offset], dataSize, 8u, 0x07u, 0xFFu),
+                    "crc8 offset %u size %u", offset, dataSize);
+            TEST_CHECK(crc16 == (u16_t)test_crcReference(&testBuffer[offset], dataSize, 16u, 0x8005u, 0xFFFFu),
+                    "crc16 offset %u size %u", offset, dataSize);
+            TEST_CHECK(crc32 == (u32_t)test_crcReference(&testBuffer[offset], dataSize, 32u, 0x04C11DB7u, 0xFFFFFFFFu),
+                    "crc32 offset %u size %u", offset, dataSize);
+            TEST_CHECK(crc64 == test_crcReference(&testBuffer[offset], dataSize, 64u, 0x3A7FF201D298EE14u, 0xFFFFFFFFFFFFFFFFu),
+                    "crc64 offset %u size %u", offset, dataSize);
+        }
+    }
+
+    testFailCounter += failCounter;
+}
+
+/**
+ * @brief   Checks the streaming API.
+ * @details Splits the buffer at every position (and once more into single bytes) and
+ *          compares the streamed result with the one-shot result.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t test_crcStreaming (void_t)
+{
+    /*
+     * Local variables.
+     */
+    u32_t              dataSize    = TEST_MAX_LENGTH - 1u;
+    u32_t              split       = 0u;
+    u32_t              index       = 0u;
+    drv_crcContext8_t  context8;
+    drv_crcContext16_t context16;
+    drv_crcContext32_t context32;
+    drv_crcContext64_t context64;
+    u8_t               crc8        = 0u;
+    u16_t              crc16       = 0u;
+    u32_t              crc32       = 0u;
+    u64_t              crc64       = 0u;
+    u8_t               stream8     = 0u;
+    u16_t              stream16    = 0u;
+    u32_t              stream32    = 0u;
+    u64_t              stream64    = 0u;
+    u32_t              failCounter = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) drv_crcGetCrc8(&testBuffer[1], dataSize, &crc8);
+    (void_t) drv_crcGetCrc16(&testBuffer[1], dataSize, &crc16);
+    (void_t) drv_crcGetCrc32(&testBuffer[1], dataSize, &crc32);
+    (void_t) drv_crcGetCrc64(&testBuffer[1], dataSize, &crc64);
+
+    for (split = 0u; split <= dataSize; split++)
+    {
+        (void_t) drv_crcStartCrc8(&context8);
+        (void_t) drv_crcStartCrc16(&context16);
+        (void_t) drv_crcStartCrc32(&context32);
+        (void_t) drv_crcStartCrc64(&context64);
+
+        (void_t) drv_crcUpdateCrc8(&context8, &testBuffer[1], split);
+        (void_t) drv_crcUpdateCrc16(&context16, &testBuffer[1], split);
+        (void_t) drv_crcUpdateCrc32(&context32, &testBuffer[1], split);
+        (void_t) drv_crcUpdateCrc64(&context64, &testBuffer[1], split);
+
+        (void_t) drv_crcUpdateCrc8(&context8, &testBuffer[1 + split], dataSize - split);
+        (void_t) drv_crcUpdateCrc16(&context16, &testBuffer[1 + split], dataSize - split);
+        (void_t) drv_crcUpdateCrc32(&context32, &testBuffer[1 + split], dataSize - split);
+        (void_t) drv_crcUpdateCrc64(&context64, &testBuffer[1 + split], dataSize - split);
+
+        (void_t) drv_crcFinishCrc8(&context8, &stream8);
+        (void_t) drv_crcFinishCrc16(&context16, &stream16);
+        (void_t) drv_crcFinishCrc32(&context32, &stream32);
+        (void_t) drv_crcFinishCrc64(&context64, &stream64);
+
+        TEST_CHECK(stream8 == crc8 && stream16 == crc16 && stream32 == crc32 && stream64 == crc64,
+                "stream split %u", split);
+    }
+
+    (void_t) drv_crcStartCrc32(&context32);
+
+    for (index = 0u; index < dataSize; index++)
+    {
+        (void_t) drv_crcUpdateCrc32(&context32, &testBuffer[1 + index], 1u);
+    }
+
+    (void_t) drv_crcFinishCrc32(&context32, &stream32);
+    TEST_CHECK(stream32 == crc32, "stream byte by byte");
+
+    testFailCounter += failCounter;
+}
+
+/**
+ * @brief   Measures the 32-bit CRC throughput.
+ * @details Prints the throughput of the configured method on a BENCH_SIZE buffer.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t test_crcBenchmark (void_t)
+{
+    /*
+     * Local variables.
+     */
+    struct timespec startTime;
+    struct timespec endTime;
+    u32_t           index     = 0u;
+    u32_t           crc32     = 0u;
+    u32_t           checksum  = 0u;
+    double          elapsedS  = 0.0;
+
+    /*
+     * Function code.
+     */
+    for (index = 0u; index < BENCH_SIZE; index++)
+    {
+        benchBuffer[index] = (u8_t)index;
+    }
+
+    (void_t) clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+    for (index = 0u; index < BENCH_ITERATIONS; index++)
+    {
+        (void_t) drv_crcGetCrc32(benchBuffer, BENCH_SIZE, &crc32);
+        checksum ^= crc32;
+        benchBuffer[0] = (u8_t)index;
+    }
+
+    (void_t) clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+    elapsedS = (double)(endTime.tv_sec - startTime.tv_sec) + (double)(endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+
+    printf("drv_crc (method %u): crc32 %u B x %u: %.1f MB/s (checksum %08X)\n", (u32_t)DRV_CRC_METHOD,
+            BENCH_SIZE, BENCH_ITERATIONS, ((double)BENCH_SIZE * BENCH_ITERATIONS) / elapsedS / 1e6, checksum);
+}
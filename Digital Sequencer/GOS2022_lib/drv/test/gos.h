@@ -0,0 +1,72 @@
+//*************************************************************************************************
+//
+//                            #####             #####             #####
+//                          #########         #########         #########
+//                         ##                ##       ##       ##
+//                        ##                ##         ##        #####
+//                        ##     #####      ##         ##           #####
+//                         ##       ##       ##       ##                ##
+//                          #########         #########         #########
+//                            #####             #####             #####
+//
+//                                      (c) Ahmed Gazar, 2026
+//
+//*************************************************************************************************
+//! @file       gos.h
+//! @author     Ahmed Gazar
+//! @date       2026-10-19
+//! @version    1.0
+//!
+//! @brief      GOS2022 Library / Host stub of the OS header for driver tests.
+//! @details    Provides the basic types and macros of gos_kernel.h that the pure software
+//!             drivers need, so they can be compiled and tested on the host without the OS.
+//*************************************************************************************************
+// History
+// ------------------------------------------------------------------------------------------------
+// Version    Date          Author          Description
+// ------------------------------------------------------------------------------------------------
+// 1.0        2026-10-19    Ahmed Gazar     Initial version created.
+//*************************************************************************************************
+#ifndef GOS_H
+#define GOS_H
+/*
+ * Includes
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Macros
+ */
+#define GOS_STATIC                     static
+#define GOS_CONST                      const
+#define GOS_INLINE                     inline __attribute__((always_inline))
+#define GOS_STATIC_INLINE              GOS_STATIC GOS_INLINE
+#define GOS_TRUE                       ( 0b00110110 )
+#define GOS_FALSE                      ( 0b01001001 )
+
+/*
+ * Type definitions
+ */
+typedef uint8_t  bool_t;
+typedef uint8_t  u8_t;
+typedef uint16_t u16_t;
+typedef uint32_t u32_t;
+typedef uint64_t u64_t;
+typedef int8_t   s8_t;
+typedef int16_t  s16_t;
+typedef int32_t  s32_t;
+typedef int64_t  s64_t;
+typedef char     char_t;
+typedef void     void_t;
+
+/**
+ * Result type (values match gos_kernel.h).
+ */
+typedef enum
+{
+    GOS_SUCCESS = 0b01010101,
+    GOS_ERROR   = 0b10101110,
+}gos_result_t;
+
+#endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       svl_cfg.h
 //! @author     Ahmed Gazar
-//! @date       2025-01-30
-//! @version    1.1
+//! @date       2026-10-19
+//! @version    1.4
 //!
 //! @brief      GOS2022 Library / Service Layer Configuration header.
 //! @details    This file contains the configurable parameters of the SVL.
@@ -27,6 +27,10 @@
 // 1.0        2024-06-27    Ahmed Gazar     Initial version created.
 // 1.1        2025-01-29    Ahmed Gazar     +    ERS and MDI parameters added
 //                                          -    FRS parameters removed
+// 1.2        2026-10-19    Ahmed Gazar     *    SDH and sysmon trace levels are runtime channel
+//                                               default levels
+// 1.3        2026-10-19    Ahmed Gazar     +    Sysmon worker parameters added
+// 1.4        2026-10-19    Ahmed Gazar     +    Sysmon telemetry parameters added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -84,13 +88,13 @@
  * SDH Service Configuration
  */
 /**
- * Trace level for SDH debugging.
+ * Default runtime trace level of the SDH trace channel ("sdh").
  *
- * 0 : Debug messages disabled.
- * 1 : Only state machine state info.
- * 2 : All debug info.
+ * GOS_TRACE_LEVEL_OFF   : Debug messages disabled.
+ * GOS_TRACE_LEVEL_INFO  : Only state machine state info.
+ * GOS_TRACE_LEVEL_DEBUG : All debug info.
  */
-#define SVL_SDH_TRACE_LEVEL                  ( 2 )
+#define SVL_SDH_TRACE_LEVEL                  ( GOS_TRACE_LEVEL_DEBUG )
 
 //! SDH daemon task priority.
 #define SVL_SDH_DAEMON_PRIORITY              ( 189 )
@@ -150,12 +154,52 @@
 #define SVL_SYSMON_WIRELESS_RX_BUFF_SIZE     ( 1024u )
 
 /**
- * Trace level for sysmon debugging.
+ * Number of sysmon request worker tasks (requests served concurrently).
+ */
+#define SVL_SYSMON_WORKER_NUMBER             ( 2u )
+
+/**
+ * Sysmon request worker task priority.
+ */
+#define SVL_SYSMON_WORKER_PRIO               ( 192u )
+
+/**
+ * Sysmon request worker task stack size.
+ */
+#define SVL_SYSMON_WORKER_STACK              ( 0x800 )
+
+/**
+ * Sysmon telemetry publisher task priority.
+ */
+#define SVL_SYSMON_TELEMETRY_PRIO            ( 195u )
+
+/**
+ * Sysmon telemetry publisher task stack size.
+ */
+#define SVL_SYSMON_TELEMETRY_STACK           ( 0x600 )
+
+/**
+ * Size of the telemetry frame buffer (and of the previous sample buffer).
+ */
+#define SVL_SYSMON_TELEMETRY_BUFF_SIZE       ( 256u )
+
+/**
+ * Minimum telemetry publishing period [ms].
+ */
+#define SVL_SYSMON_TELEMETRY_MIN_PERIOD      ( 20u )
+
+/**
+ * Number of telemetry frames between two key frames (full samples).
+ */
+#define SVL_SYSMON_TELEMETRY_KEYFRAME_PERIOD ( 50u )
+
+/**
+ * Default runtime trace level of the sysmon trace channel ("sysmon").
  *
- * 0 : Debug messages disabled.
- * 1 : Only state machine state info.
- * 2 : All debug info.
+ * GOS_TRACE_LEVEL_OFF   : Debug messages disabled.
+ * GOS_TRACE_LEVEL_INFO  : Only state machine state info.
+ * GOS_TRACE_LEVEL_DEBUG : All debug info.
  */
-#define SVL_SYSMON_TRACE_LEVEL               ( 2 )
+#define SVL_SYSMON_TRACE_LEVEL               ( GOS_TRACE_LEVEL_DEBUG )
 
 #endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       svl_sdh.h
 //! @author     Ahmed Gazar
-//! @date       2024-12-24
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.2
 //!
 //! @brief      GOS2022 Library / Software Download Handler
 //! @details    This component implements the software download service to store new application
@@ -26,6 +26,8 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2024-12-24    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    Optional erase function added to the configuration
+// 1.2        2026-10-19    Ahmed Gazar     +    Read stream functions added
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -69,13 +71,33 @@
  */
 typedef gos_result_t (*svl_sdhReadWriteFunc_t)(u32_t address, u8_t* pData, u32_t size);
 
+/**
+ * SDH erase function type (erases the storage sectors entirely within the area).
+ */
+typedef gos_result_t (*svl_sdhEraseFunc_t)(u32_t address, u32_t size);
+
+/**
+ * SDH read stream start function type (starts a continuous read at the address
+ * and starts filling the first buffer).
+ */
+typedef gos_result_t (*svl_sdhReadStreamStartFunc_t)(u32_t address, u8_t* pData, u32_t size);
+
+/**
+ * SDH read stream next function type (completes the previous buffer and starts
+ * filling the given one, NULL buffer stops the stream).
+ */
+typedef gos_result_t (*svl_sdhReadStreamNextFunc_t)(u8_t* pData, u32_t size);
+
 /**
  * SDH configuration structure.
  */
 typedef struct
 {
-	svl_sdhReadWriteFunc_t readFunction;  //!< Read function pointer.
-	svl_sdhReadWriteFunc_t writeFunction; //!< Write function pointer.
+	svl_sdhReadWriteFunc_t       readFunction;            //!< Read function pointer.
+	svl_sdhReadWriteFunc_t       writeFunction;           //!< Write function pointer.
+	svl_sdhEraseFunc_t           eraseFunction;           //!< Erase function pointer (optional, used during download).
+	svl_sdhReadStreamStartFunc_t readStreamStartFunction; //!< Read stream start function pointer (optional).
+	svl_sdhReadStreamNextFunc_t  readStreamNextFunction;  //!< Read stream next function pointer (optional).
 }svl_sdhCfg_t;
 
 /**
@@ -104,4 +126,49 @@ gos_result_t svl_sdhSetBinaryData (u16_t index, svl_sdhBinaryDesc_t* pDesc);
 // TODO
 gos_result_t svl_sdhReadBytesFromMemory (u32_t address, u8_t* pBuffer, u32_t size);
 
+/**
+ * @brief   Starts a continuous read from the memory.
+ * @details Starts filling the first buffer with the bytes at the given address.
+ *          Consecutive bytes are read by #svl_sdhReadStreamNext. If the board
+ *          provides stream functions, a buffer is filled while the caller
+ *          processes the previous one, otherwise the buffers are read by the
+ *          read function one by one.
+ *
+ * @param   address : Memory address to start reading from.
+ * @param   pBuffer : First buffer to fill.
+ * @param   size    : Number of bytes to read into the first buffer.
+ *
+ * @return  Result of stream start.
+ *
+ * @retval  GOS_SUCCESS : Stream started.
+ * @retval  GOS_ERROR   : Buffer is NULL or SDH is not configured.
+ */
+gos_result_t svl_sdhReadStreamStart (u32_t address, u8_t* pBuffer, u32_t size);
+
+/**
+ * @brief   Continues a read stream.
+ * @details Completes the buffer given in the previous call and starts filling
+ *          the given buffer with the next bytes.
+ *
+ * @param   pBuffer : Next buffer to fill.
+ * @param   size    : Number of bytes to read into the next buffer.
+ *
+ * @return  Result of reading.
+ *
+ * @retval  GOS_SUCCESS : Previous buffer filled, next one started.
+ * @retval  GOS_ERROR   : Buffer is NULL or reading failed.
+ */
+gos_result_t svl_sdhReadStreamNext (u8_t* pBuffer, u32_t size);
+
+/**
+ * @brief   Stops a read stream.
+ * @details Completes the last buffer and releases the memory.
+ *
+ * @return  Result of reading.
+ *
+ * @retval  GOS_SUCCESS : Last buffer filled.
+ * @retval  GOS_ERROR   : Reading failed.
+ */
+gos_result_t svl_sdhReadStreamStop (void_t);
+
 #endif
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       svl_sysmon.h
 //! @author     Ahmed Gazar
-//! @date       2025-06-18
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.3
 //!
 //! @brief      GOS2022 Library / System Monitoring Service header.
 //! @details    This service is used to send and receive system information to an external client
@@ -26,6 +26,9 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2025-06-18    Ahmed Gazar     Initial version created
+// 1.1        2026-10-19    Ahmed Gazar     +    Vectored TX functions added to the configuration
+// 1.2        2026-10-19    Ahmed Gazar     +    Telemetry sources added
+// 1.3        2026-10-19    Ahmed Gazar     +    Service mutex added to the user message descriptor
 //*************************************************************************************************
 //
 // Copyright (c) 2025 Ahmed Gazar
@@ -61,12 +64,14 @@
  */
 typedef struct
 {
-    gos_gcpChannelNumber_t    wiredChannelNumber;      //!< GCP channel number for wired connection.
-    gos_gcpTransmitFunction_t wiredTxFunction;         //!< TX function for wired connection.
-    gos_gcpReceiveFunction_t  wiredRxFunction;         //!< RX function for wired connection.
-    gos_gcpChannelNumber_t    wirelessChannelNumber;   //!< GCP channel number for wireless connection.
-    gos_gcpTransmitFunction_t wirelessTxFunction;      //!< TX function for wireless connection.
-    gos_gcpReceiveFunction_t  wirelessRxFunction;      //!< RX function for wireless connection.
+    gos_gcpChannelNumber_t          wiredChannelNumber;       //!< GCP channel number for wired connection.
+    gos_gcpTransmitFunction_t       wiredTxFunction;          //!< TX function for wired connection.
+    gos_gcpTransmitVectorFunction_t wiredTxVectorFunction;    //!< Vectored TX function for wired connection (optional).
+    gos_gcpReceiveFunction_t        wiredRxFunction;          //!< RX function for wired connection.
+    gos_gcpChannelNumber_t          wirelessChannelNumber;    //!< GCP channel number for wireless connection.
+    gos_gcpTransmitFunction_t       wirelessTxFunction;       //!< TX function for wireless connection.
+    gos_gcpTransmitVectorFunction_t wirelessTxVectorFunction; //!< Vectored TX function for wireless connection (optional).
+    gos_gcpReceiveFunction_t        wirelessRxFunction;       //!< RX function for wireless connection.
 }svl_sysmonServiceConfig_t;
 
 /**
@@ -83,8 +88,38 @@ typedef struct
 	void_t*                           payload;         //!< Pointer to payload target.
 	u32_t                             payloadSize;     //!< Size of payload.
 	svl_sysmonMessageReceivedCallback callback;        //!< Callback function pointer.
+	gos_mutex_t*                      pServiceMutex;   //!< Lock of the registering service (optional).
 }svl_sysmonUserMessageDescriptor_t;
 
+/**
+ * Sysmon telemetry item IDs (bit positions in the subscription item mask).
+ */
+typedef enum
+{
+	SVL_SYSMON_TELEMETRY_ITEM_CPU      = 0,            //!< CPU usage.
+	SVL_SYSMON_TELEMETRY_ITEM_TASKS    = 1,            //!< Task variable data (one record per task).
+	SVL_SYSMON_TELEMETRY_ITEM_MDI      = 2,            //!< MDI variable values (one record per variable).
+	SVL_SYSMON_TELEMETRY_ITEM_DRV_DIAG = 3,            //!< Driver diagnostic data.
+	SVL_SYSMON_TELEMETRY_ITEM_USER     = 4,            //!< First user telemetry item.
+	SVL_SYSMON_TELEMETRY_ITEM_NUM      = 32            //!< Number of telemetry items.
+}svl_sysmonTelemetryItem_t;
+
+/**
+ * Sysmon telemetry record fill function type. It is called with increasing record
+ * indexes from 0, and shall return the number of bytes written to the buffer (0 if
+ * there is no record with the given index or it does not fit in the buffer).
+ */
+typedef u16_t (*svl_sysmonTelemetryFillFunction_t) (u8_t, u8_t*, u16_t);
+
+/**
+ * Sysmon telemetry source descriptor.
+ */
+typedef struct
+{
+	svl_sysmonTelemetryItem_t         itemId;          //!< Telemetry item ID.
+	svl_sysmonTelemetryFillFunction_t fillFunction;    //!< Record fill function.
+}svl_sysmonTelemetrySourceDescriptor_t;
+
 /**
  * @brief   Initializes the system monitoring service.
  * @details Initializes the internal user message array, registers the GCP
@@ -106,6 +141,11 @@ gos_result_t svl_sysmonInit (void_t);
  *          will be copied into the buffer defined in the descriptor structure, and
  *          the registered callback function will be called.
  *
+ *          The payload copy and the callback run under the service mutex of
+ *          the descriptor, so messages of a service sharing buffers or state
+ *          shall use the same (initialized) service mutex. Messages without a
+ *          service mutex are served under a common user message lock.
+ *
  *          Recommended ID range: 0x6000 ... 0x9999.
  *
  * @param[in] pDesc Pointer to a sysmon user message descriptor.
@@ -118,4 +158,21 @@ gos_result_t svl_sysmonInit (void_t);
  */
 gos_result_t svl_sysmonRegisterUserMessage (svl_sysmonUserMessageDescriptor_t* pDesc);
 
+/**
+ * @brief   This function registers a telemetry source.
+ * @details Registers the record fill function of a telemetry item. When a client
+ *          subscribes to the item, the publisher task calls the fill function
+ *          periodically and streams the records in batched frames. CPU usage and
+ *          task data items are registered by the service itself.
+ *
+ * @param[in] pDesc Pointer to a sysmon telemetry source descriptor.
+ *
+ * @return  Result of registration.
+ *
+ * @retval  #GOS_SUCCESS Telemetry source registered successfully.
+ * @retval  #GOS_ERROR   Descriptor or fill function is NULL, item ID is invalid or
+ *                       already registered.
+ */
+gos_result_t svl_sysmonRegisterTelemetrySource (svl_sysmonTelemetrySourceDescriptor_t* pDesc);
+
 #endif
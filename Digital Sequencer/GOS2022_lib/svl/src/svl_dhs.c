@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       svl_dhs.c
 //! @author     Ahmed Gazar
-//! @date       2025-07-28
-//! @version    1.2
+//! @date       2026-10-19
+//! @version    1.3
 //!
 //! @brief      GOS2022 Library / Device Handler Service source.
 //! @details    For a more detailed description of this service, please refer to @ref svl_dhs.h
@@ -27,6 +27,7 @@
 // 1.0        2024-04-13    Ahmed Gazar     Initial version created.
 // 1.1        2025-07-22    Ahmed Gazar     +    Error handling introduced
 // 1.2        2025-07-28    Ahmed Gazar     +    Driver diagnostics added to sysmon callbacks
+// 1.3        2026-10-19    Ahmed Gazar     +    Driver diagnostics registered as sysmon telemetry source
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -121,6 +122,7 @@ GOS_STATIC void_t svl_dhsDaemon (void_t);
 GOS_STATIC void_t svl_dhsSysmonDeviceNumReqCallback  (gos_gcpChannelNumber_t gcpChannel);
 GOS_STATIC void_t svl_dhsSysmonDeviceInfoReqCallback (gos_gcpChannelNumber_t gcpChannel);
 GOS_STATIC void_t svl_dhsSysmonDriverDiagReqCallback (gos_gcpChannelNumber_t gcpChannel);
+GOS_STATIC u16_t  svl_dhsDriverDiagTelemetryFill     (u8_t index, u8_t* pBuffer, u16_t bufferSize);
 
 /**
  * DHS daemon task descriptor.
@@ -167,6 +169,15 @@ GOS_STATIC svl_sysmonUserMessageDescriptor_t sysmonDriverDiagReqMsg =
 	.payloadSize     = 0u
 };
 
+/**
+ * Sysmon driver diagnostics telemetry source.
+ */
+GOS_STATIC svl_sysmonTelemetrySourceDescriptor_t sysmonDriverDiagTelemetrySource =
+{
+	.itemId          = SVL_SYSMON_TELEMETRY_ITEM_DRV_DIAG,
+	.fillFunction    = svl_dhsDriverDiagTelemetryFill
+};
+
 /*
  * Function: svl_dhsInit
  */
@@ -184,6 +195,7 @@ gos_result_t svl_dhsInit (void_t)
     GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&sysmonDeviceNumReqMsg));
     GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&sysmonDeviceInfoReqMsg));
     GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&sysmonDriverDiagReqMsg));
+    GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterTelemetrySource(&sysmonDriverDiagTelemetrySource));
 
     return initResult;
 }
@@ -830,3 +842,38 @@ GOS_STATIC void_t svl_dhsSysmonDriverDiagReqCallback (gos_gcpChannelNumber_t gcp
             sizeof(drv_diagData_t),
             0xFFFF);
 }
+
+/**
+ * @brief   Driver diagnostics telemetry record fill function.
+ * @details Copies the driver diagnostics information to the record buffer.
+ *
+ * @param[in]  index      Record index.
+ * @param[out] pBuffer    Record buffer.
+ * @param[in]  bufferSize Size of the record buffer.
+ *
+ * @return  Size of the record (0 if there is no record with the given index).
+ */
+GOS_STATIC u16_t svl_dhsDriverDiagTelemetryFill (u8_t index, u8_t* pBuffer, u16_t bufferSize)
+{
+	/*
+	 * Local variables.
+	 */
+	drv_diagData_t diagData;
+	u16_t          recordSize = 0u;
+
+	/*
+	 * Function code.
+	 */
+	if ((index == 0u) && (bufferSize >= sizeof(drv_diagData_t)))
+	{
+		(void_t) drv_errorGetDiagData(&diagData);
+		(void_t) memcpy((void_t*)pBuffer, (void_t*)&diagData, sizeof(drv_diagData_t));
+		recordSize = sizeof(drv_diagData_t);
+	}
+	else
+	{
+		// No more records.
+	}
+
+	return recordSize;
+}
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       svl_mdi.c
 //! @author     Ahmed Gazar
-//! @date       2025-01-27
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.2
 //!
 //! @brief      GOS2022 Library / Monitoring Data Interface source.
 //! @details    For a more detailed description of this service, please refer to @ref svl_mdi.h
@@ -25,6 +25,8 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2025-01-27    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    MDI variables registered as sysmon telemetry source
+// 1.2        2026-10-19    Ahmed Gazar     -    Always true array check removed from telemetry fill
 //*************************************************************************************************
 //
 // Copyright (c) 2025 Ahmed Gazar
@@ -50,6 +52,7 @@
  */
 #include <svl_mdi.h>
 #include <svl_sysmon.h>
+#include <string.h>
 
 /*
  * Type definitions
@@ -72,6 +75,7 @@ GOS_STATIC u16_t mdiVariableIndex = 0u;
  */
 GOS_STATIC void_t svl_mdiNumReqCallback (gos_gcpChannelNumber_t gcpChannel);
 GOS_STATIC void_t svl_mdiReqCallback    (gos_gcpChannelNumber_t gcpChannel);
+GOS_STATIC u16_t  svl_mdiTelemetryFill  (u8_t index, u8_t* pBuffer, u16_t bufferSize);
 
 /**
  * Sysmon MDI variable number request message.
@@ -95,6 +99,15 @@ GOS_STATIC svl_sysmonUserMessageDescriptor_t mdiRequestMsg =
 	.payload         = &mdiVariableIndex
 };
 
+/**
+ * Sysmon MDI telemetry source.
+ */
+GOS_STATIC svl_sysmonTelemetrySourceDescriptor_t mdiTelemetrySource =
+{
+	.itemId          = SVL_SYSMON_TELEMETRY_ITEM_MDI,
+	.fillFunction    = svl_mdiTelemetryFill
+};
+
 /**
  * Monitoring variable array.
  */
@@ -120,6 +133,7 @@ gos_result_t svl_mdiInit (void_t)
 	 */
 	GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&mdiNumRequestMsg));
 	GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&mdiRequestMsg));
+	GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterTelemetrySource(&mdiTelemetrySource));
 
 	return initResult;
 }
@@ -176,3 +190,37 @@ GOS_STATIC void_t svl_mdiReqCallback (gos_gcpChannelNumber_t gcpChannel)
 		// Nothing to send.
 	}
 }
+
+/**
+ * @brief   Fills the MDI telemetry record.
+ * @details Copies the type and value of the MDI variable determined by the record
+ *          index (the names can be read by the data get request).
+ *
+ * @param[in]  index      Record (variable) index.
+ * @param[out] pBuffer    Record buffer.
+ * @param[in]  bufferSize Size of the record buffer.
+ *
+ * @return  Size of the record (0 if there is no variable with the given index).
+ */
+GOS_STATIC u16_t svl_mdiTelemetryFill (u8_t index, u8_t* pBuffer, u16_t bufferSize)
+{
+	/*
+	 * Local variables.
+	 */
+	u16_t recordSize = sizeof(svl_mdiValueType_t) + sizeof(svl_mdiValueConvert_t);
+
+	/*
+	 * Function code.
+	 */
+	if ((index < (mdiVariablesSize / sizeof(svl_mdiVariable_t))) && (bufferSize >= recordSize))
+	{
+		// Type and value are adjacent in the packed variable structure.
+		(void_t) memcpy((void_t*)pBuffer, (void_t*)&mdiVariables[index].type, recordSize);
+	}
+	else
+	{
+		recordSize = 0u;
+	}
+
+	return recordSize;
+}
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       svl_sdh.c
 //! @author     Ahmed Gazar
-//! @date       2025-07-22
-//! @version    1.2
+//! @date       2026-10-19
+//! @version    1.10
 //!
 //! @brief      GOS2022 Library / Software Download Handler
 //! @details    For a more detailed description of this service, please refer to @ref svl_sdh.h
@@ -31,6 +31,18 @@
 // 1.2        2025-07-22    Ahmed Gazar     +    FLASH buffer introduced to make actually FLASH
 //                                               writings in bigger chunks separately from
 //                                               received binary chunk size
+// 1.3        2026-10-19    Ahmed Gazar     *    Compile-time trace levels replaced by the sdh
+//                                               trace channel
+// 1.4        2026-10-19    Ahmed Gazar     +    Downloaded binary CRC verified on the fly with the
+//                                               streaming CRC API
+// 1.5        2026-10-19    Ahmed Gazar     +    Binary area erased before download
+// 1.6        2026-10-19    Ahmed Gazar     +    Read stream functions added
+// 1.7        2026-10-19    Ahmed Gazar     *    Binary area erased block by block during download
+//                                               instead of before the download response
+// 1.8        2026-10-19    Ahmed Gazar     *    Binary CRC checked before the last chunk response
+//                                               and its result reported in the response
+// 1.9        2026-10-19    Ahmed Gazar     +    Out-of-order binary chunks rejected
+// 1.10       2026-10-19    Ahmed Gazar     +    Sysmon messages served under the SDH service mutex
 //*************************************************************************************************
 //
 // Copyright (c) 2024 Ahmed Gazar
@@ -113,6 +125,11 @@
  */
 #define SVL_SDH_FLASH_BUFFER_SIZE           ( 4096u )
 
+/**
+ * SDH erase block size (the binary area is erased ahead in units of this size).
+ */
+#define SVL_SDH_ERASE_BLOCK_SIZE            ( 65536u )
+
 /**
  * SDH daemon expected trigger value.
  */
@@ -150,6 +167,16 @@ typedef enum
     SDH_DOWNLOAD_REQ_FILE_SIZE_ERR = 4  //!< File does not fit.
 }svl_sdhDownloadReqRes_t;
 
+/**
+ * SDH chunk results.
+ */
+typedef enum
+{
+    SDH_CHUNK_OK      = 1,              //!< Chunk processed.
+    SDH_CHUNK_CRC_ERR = 2,              //!< Last chunk processed, binary CRC mismatch.
+    SDH_CHUNK_IDX_ERR = 4               //!< Chunk rejected, index is not the expected one.
+}svl_sdhChunkRes_t;
+
 /**
  * SDH chunk descriptor.
  */
@@ -181,6 +208,11 @@ typedef enum
 /*
  * Static variables
  */
+/**
+ * SDH trace channel.
+ */
+GOS_STATIC gos_traceChannel_t     sdhTraceChannel = GOS_TRACE_CHANNEL_INIT("sdh", SVL_SDH_TRACE_LEVEL);
+
 /**
  * Read function pointer.
  */
@@ -191,11 +223,36 @@ GOS_STATIC svl_sdhReadWriteFunc_t sdhReadFunction = NULL;
  */
 GOS_STATIC svl_sdhReadWriteFunc_t sdhWriteFunction = NULL;
 
+/**
+ * Erase function pointer.
+ */
+GOS_STATIC svl_sdhEraseFunc_t     sdhEraseFunction = NULL;
+
+/**
+ * Read stream start function pointer.
+ */
+GOS_STATIC svl_sdhReadStreamStartFunc_t sdhReadStreamStartFunction = NULL;
+
+/**
+ * Read stream next function pointer.
+ */
+GOS_STATIC svl_sdhReadStreamNextFunc_t  sdhReadStreamNextFunction  = NULL;
+
+/**
+ * Next address of the read stream (used without stream functions).
+ */
+GOS_STATIC u32_t                  sdhReadStreamAddress = 0u;
+
 /**
  * SDH buffer for sysmon messages.
  */
 GOS_STATIC u8_t sdhBuffer [SVL_SDH_BUFFER_SIZE];
 
+/**
+ * SDH sysmon mutex (sysmon callbacks share the SDH buffer and triggers).
+ */
+GOS_STATIC gos_mutex_t sdhSysmonMutex;
+
 /**
  * SDH FLASH buffer for collecting bytes before saving in FLASH memory.
  */
@@ -241,6 +298,7 @@ GOS_STATIC svl_sysmonUserMessageDescriptor_t sysmonBinaryNumReqMsg =
     .messageId       = SVL_SDH_SYSMON_MSG_BINARY_NUM_REQ,
     .payload         = NULL,
     .payloadSize     = 0u,
+    .pServiceMutex   = &sdhSysmonMutex,
 };
 
 /**
@@ -252,6 +310,7 @@ GOS_STATIC svl_sysmonUserMessageDescriptor_t sysmonBinaryInfoReqMsg =
     .messageId       = SVL_SDH_SYSMON_MSG_BINARY_INFO_REQ,
     .payload         = (void_t*)sdhBuffer,
     .payloadSize     = sizeof(u16_t),
+    .pServiceMutex   = &sdhSysmonMutex,
 };
 
 /**
@@ -263,6 +322,7 @@ GOS_STATIC svl_sysmonUserMessageDescriptor_t sysmonDownloadReqMsg =
     .messageId       = SVL_SDH_SYSMON_MSG_DOWNLOAD_REQ,
     .payload         = (void_t*)sdhBuffer,
     .payloadSize     = sizeof(svl_sdhBinaryDesc_t),
+    .pServiceMutex   = &sdhSysmonMutex,
 };
 
 /**
@@ -274,6 +334,7 @@ GOS_STATIC svl_sysmonUserMessageDescriptor_t sysmonBinaryChunkReqMsg =
     .messageId       = SVL_SDH_SYSMON_MSG_BINARY_CHUNK_REQ,
     .payload         = (void_t*)sdhBuffer,
     .payloadSize     = sizeof(svl_sdhChunkDesc_t) + SVL_SDH_CHUNK_SIZE,
+    .pServiceMutex   = &sdhSysmonMutex,
 };
 
 /**
@@ -285,6 +346,7 @@ GOS_STATIC svl_sysmonUserMessageDescriptor_t sysmonSoftwareInstallReqMsg =
     .messageId       = SVL_SDH_SYSMON_MSG_SOFTWARE_INSTALL_REQ,
     .payload         = (void_t*)sdhBuffer,
     .payloadSize     = sizeof(u16_t),
+    .pServiceMutex   = &sdhSysmonMutex,
 };
 
 /**
@@ -296,6 +358,7 @@ GOS_STATIC svl_sysmonUserMessageDescriptor_t sysmonBinaryEraseReqMsg =
     .messageId       = SVL_SDH_SYSMON_MSG_BINARY_ERASE_REQ,
     .payload         = (void_t*)sdhBuffer,
     .payloadSize     = sizeof(u16_t) + sizeof(bool_t),
+    .pServiceMutex   = &sdhSysmonMutex,
 };
 
 /**
@@ -324,6 +387,7 @@ gos_result_t svl_sdhInit (void_t)
      * Function code.
      */
     // Register sysmon callbacks.
+    GOS_CONCAT_RESULT(initResult, gos_mutexInit(&sdhSysmonMutex));
     GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&sysmonBinaryNumReqMsg));
     GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&sysmonBinaryInfoReqMsg));
     GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&sysmonDownloadReqMsg));
@@ -331,6 +395,7 @@ gos_result_t svl_sdhInit (void_t)
     GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&sysmonSoftwareInstallReqMsg));
     GOS_CONCAT_RESULT(initResult, svl_sysmonRegisterUserMessage(&sysmonBinaryEraseReqMsg));
 
+    GOS_CONCAT_RESULT(initResult, gos_traceChannelRegister(&sdhTraceChannel));
     GOS_CONCAT_RESULT(initResult, gos_taskRegister(&svlSdhTaskDesc, NULL));
     GOS_CONCAT_RESULT(initResult, gos_triggerInit(&sdhControlTrigger));
     GOS_CONCAT_RESULT(initResult, gos_triggerInit(&sdhControlFeedbackTrigger));
@@ -355,7 +420,20 @@ gos_result_t svl_sdhConfigure (svl_sdhCfg_t* pCfg)
     {
         sdhReadFunction  = pCfg->readFunction;
         sdhWriteFunction = pCfg->writeFunction;
+        sdhEraseFunction = pCfg->eraseFunction;
         cfgResult        = GOS_SUCCESS;
+
+        // Stream functions are only used in pair.
+        if (pCfg->readStreamStartFunction != NULL && pCfg->readStreamNextFunction != NULL)
+        {
+            sdhReadStreamStartFunction = pCfg->readStreamStartFunction;
+            sdhReadStreamNextFunction  = pCfg->readStreamNextFunction;
+        }
+        else
+        {
+            sdhReadStreamStartFunction = NULL;
+            sdhReadStreamNextFunction  = NULL;
+        }
     }
     else
     {
@@ -473,6 +551,91 @@ gos_result_t svl_sdhReadBytesFromMemory (u32_t address, u8_t* pBuffer, u32_t siz
     return readResult;
 }
 
+/*
+ * Function: svl_sdhReadStreamStart
+ */
+gos_result_t svl_sdhReadStreamStart (u32_t address, u8_t* pBuffer, u32_t size)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t readResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pBuffer != NULL && sdhReadStreamStartFunction != NULL)
+    {
+        readResult = sdhReadStreamStartFunction(address, pBuffer, size);
+    }
+    else if (pBuffer != NULL && sdhReadFunction != NULL)
+    {
+        readResult           = sdhReadFunction(address, pBuffer, size);
+        sdhReadStreamAddress = address + size;
+    }
+    else
+    {
+        // NULL pointer error.
+    }
+
+    return readResult;
+}
+
+/*
+ * Function: svl_sdhReadStreamNext
+ */
+gos_result_t svl_sdhReadStreamNext (u8_t* pBuffer, u32_t size)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t readResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if (pBuffer != NULL && sdhReadStreamNextFunction != NULL)
+    {
+        readResult = sdhReadStreamNextFunction(pBuffer, size);
+    }
+    else if (pBuffer != NULL && sdhReadFunction != NULL)
+    {
+        readResult           = sdhReadFunction(sdhReadStreamAddress, pBuffer, size);
+        sdhReadStreamAddress = sdhReadStreamAddress + size;
+    }
+    else
+    {
+        // NULL pointer error.
+    }
+
+    return readResult;
+}
+
+/*
+ * Function: svl_sdhReadStreamStop
+ */
+gos_result_t svl_sdhReadStreamStop (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t readResult = GOS_SUCCESS;
+
+    /*
+     * Function code.
+     */
+    if (sdhReadStreamNextFunction != NULL)
+    {
+        readResult = sdhReadStreamNextFunction(NULL, 0u);
+    }
+    else
+    {
+        // Buffers are already filled.
+    }
+
+    return readResult;
+}
+
 /**
  * @brief   SDH daemon task.
  * @details Handles the incoming requests via sysmon or IPL.
@@ -498,6 +661,13 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
     bool_t              defragment          = GOS_FALSE;
     u8_t                flashBufferIndex    = 0u;
     u8_t                flashChunkIndex     = 0u;
+    drv_crcContext32_t  downloadCrcContext  = {0};
+    u32_t               downloadCrc         = 0u;
+    u32_t               chunkDataSize       = 0u;
+    u32_t               eraseAddress        = 0u;
+    u32_t               eraseEndAddress     = 0u;
+    u32_t               writeAddress        = 0u;
+    u16_t               expectedChunkIdx    = 0u;
 
     /*
      * Function code.
@@ -512,9 +682,7 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
                 {
                     if (sdhReadFunction != NULL && sdhWriteFunction != NULL)
                     {
-#if SVL_SDH_TRACE_LEVEL > 0
-                        (void_t) gos_traceTrace(GOS_TRUE, "SDH binary number request received.\r\n");
-#endif
+                        GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "SDH binary number request received.\r\n");
                         u16_t numOfBinaries = 0u;
 
                         (void_t) sdhReadFunction(SVL_SDH_STORAGE_DESC_AREA_START, (u8_t*)&numOfBinaries, sizeof(numOfBinaries));
@@ -545,9 +713,7 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
                     {
                         (void_t) memcpy((void_t*)&index, sdhBuffer, sizeof(index));
 
-#if SVL_SDH_TRACE_LEVEL > 0
-                        (void_t) gos_traceTraceFormatted(GOS_TRUE, "SDH binary info request received. Index: %u\r\n", index);
-#endif
+                        GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "SDH binary info request received. Index: %u\r\n", index);
                         if (svl_sdhGetBinaryData(index, &binaryDescriptor) == GOS_SUCCESS)
                         {
                             (void_t) memcpy(sdhBuffer, (void_t*)&binaryDescriptor, sizeof(binaryDescriptor));
@@ -570,9 +736,7 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
                     {
                         (void_t) memcpy((void_t*)&index, (void_t*)sdhBuffer, sizeof(index));
 
-#if SVL_SDH_TRACE_LEVEL > 0
-                        (void_t) gos_traceTraceFormatted(GOS_TRUE, "SDH binary install request received. Index: %u\r\n", index);
-#endif
+                        GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "SDH binary install request received. Index: %u\r\n", index);
 
                         (void_t) sdhReadFunction(SVL_SDH_STORAGE_DESC_AREA_START, (u8_t*)&numOfBinaries, sizeof(numOfBinaries));
 
@@ -600,9 +764,7 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
                 {
                     if (sdhReadFunction != NULL)
                     {
-#if SVL_SDH_TRACE_LEVEL > 0
-                        (void_t) gos_traceTrace(GOS_TRUE, "SDH binary download request received.\r\n");
-#endif
+                        GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "SDH binary download request received.\r\n");
                         // Check if descriptor fits.
                         (void_t) sdhReadFunction(SVL_SDH_STORAGE_DESC_AREA_START, (u8_t*)&numOfBinaries, sizeof(numOfBinaries));
 
@@ -625,8 +787,9 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
                                 newBinaryDescriptor.binaryLocation = SVL_SDH_BINARY_AREA_START;
                             }
 
-#if SVL_SDH_TRACE_LEVEL == 2
-                            (void_t) gos_traceTraceFormatted(
+                            GOS_TRACE_LOG(
+                                    sdhTraceChannel,
+                                    GOS_TRACE_LEVEL_DEBUG,
                                     GOS_TRUE,
                                     "SDH new binary info:\r\n"
                                     "Name: %s\r\n"
@@ -646,7 +809,6 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
                                     newBinaryDescriptor.binaryInfo.size,
                                     newBinaryDescriptor.binaryInfo.startAddress,
                                     newBinaryDescriptor.binaryInfo.crc);
-#endif
 
                             if ((newBinaryDescriptor.binaryLocation + newBinaryDescriptor.binaryInfo.size) < SVL_SDH_BINARY_AREA_END)
                             {
@@ -659,6 +821,14 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
 
                                 numOfChunks = newBinaryDescriptor.binaryInfo.size / SVL_SDH_CHUNK_SIZE + (newBinaryDescriptor.binaryInfo.size % SVL_SDH_CHUNK_SIZE == 0 ? 0 : 1);
 
+                                // The binary area is erased ahead of the FLASH writes (see chunk reception),
+                                // so the response is not delayed by the erase.
+                                eraseAddress    = newBinaryDescriptor.binaryLocation;
+                                eraseEndAddress = newBinaryDescriptor.binaryLocation + numOfChunks * SVL_SDH_CHUNK_SIZE;
+
+                                // Verify the binary while the chunks stream through.
+                                (void_t) drv_crcStartCrc32(&downloadCrcContext);
+
                                 sdhState = SDH_STATE_DOWNLOADING_BINARY;
                             }
                             else
@@ -678,6 +848,7 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
 
                         flashBufferIndex = 0u;
                         flashChunkIndex = 0u;
+                        expectedChunkIdx = 0u;
                     }
                     else
                     {
@@ -692,12 +863,9 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
                         // Get chunk descriptor.
                         (void_t) memcpy((void_t*)&chunkDesc, (void_t*)sdhBuffer, sizeof(chunkDesc));
 
-#if SVL_SDH_TRACE_LEVEL > 0
-                        (void_t) gos_traceTrace(GOS_TRUE, "SDH binary chunk request received.\r\n");
-#endif
+                        GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "SDH binary chunk request received.\r\n");
 
-#if SVL_SDH_TRACE_LEVEL == 2
-                        if (numOfChunks > 0)
+                        if (GOS_TRACE_LEVEL_ENABLED(sdhTraceChannel, GOS_TRACE_LEVEL_DEBUG) && numOfChunks > 0)
                         {
                             u32_t percentage = 100 * 100 * (chunkDesc.chunkIdx + 1) / numOfChunks;
                             (void_t) gos_traceTraceFormatted(
@@ -711,55 +879,105 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
                         }
                         else
                         {
-                        	// Wrong number.
+                        	// Trace disabled or wrong number.
                         }
-#endif
-
-                        // Copy chunk to FLASH buffer.
-                        (void_t) memcpy((void_t*)(sdhFlashBuffer + flashBufferIndex * SVL_SDH_CHUNK_SIZE),
-                        		(void_t*)(sdhBuffer + sizeof(chunkDesc)), SVL_SDH_CHUNK_SIZE);
 
-                        // Increase offset.
-                        flashBufferIndex++;
-
-                        // If buffer is full or last chunk was received, write it to FLASH.
-                        if (((flashBufferIndex * SVL_SDH_CHUNK_SIZE) >= SVL_SDH_FLASH_BUFFER_SIZE) || (chunkDesc.chunkIdx == (numOfChunks - 1)))
+                        // The CRC is calculated on the fly, so the chunks have to arrive in order.
+                        if (chunkDesc.chunkIdx != expectedChunkIdx)
                         {
-                            (void_t) sdhWriteFunction(
-                                    newBinaryDescriptor.binaryLocation + flashChunkIndex * SVL_SDH_FLASH_BUFFER_SIZE,
-                                    sdhFlashBuffer,
-									SVL_SDH_FLASH_BUFFER_SIZE
-                            );
-                        	flashBufferIndex = 0u;
-                        	flashChunkIndex++;
+                            GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_WARNING, GOS_TRUE,
+                                    "SDH chunk %u rejected, expected: %u.\r\n",
+                                    chunkDesc.chunkIdx, expectedChunkIdx);
+
+                            // Report the expected index to the host.
+                            chunkDesc.chunkIdx = expectedChunkIdx;
+                            chunkDesc.result   = SDH_CHUNK_IDX_ERR;
                         }
                         else
                         {
-                        	// Wait for buffer to get full or for last chunk to be received.
-                        }
+                            // Add the binary part of the chunk to the CRC (last chunk may be padded).
+                            chunkDataSize = newBinaryDescriptor.binaryInfo.size - downloadCrcContext.dataSize;
+                            chunkDataSize = chunkDataSize < SVL_SDH_CHUNK_SIZE ? chunkDataSize : SVL_SDH_CHUNK_SIZE;
+                            (void_t) drv_crcUpdateCrc32(&downloadCrcContext, sdhBuffer + sizeof(chunkDesc), chunkDataSize);
 
-                        // Send response.
-                        chunkDesc.result = 1;
+                            // Copy chunk to FLASH buffer.
+                            (void_t) memcpy((void_t*)(sdhFlashBuffer + flashBufferIndex * SVL_SDH_CHUNK_SIZE),
+                            		(void_t*)(sdhBuffer + sizeof(chunkDesc)), SVL_SDH_CHUNK_SIZE);
 
-                        (void_t) memcpy((void_t*)sdhBuffer, (void_t*)&chunkDesc, sizeof(chunkDesc));
-                        (void_t) gos_triggerIncrement(&sdhControlFeedbackTrigger);
+                            // Increase offset.
+                            flashBufferIndex++;
 
-                        // Check if all chunks have been received.
-                        if (chunkDesc.chunkIdx == (numOfChunks - 1))
-                        {
-#if SVL_SDH_TRACE_LEVEL > 0
-                            (void_t) gos_traceTrace(GOS_TRUE, "SDH binary download finished.\r\n");
-#endif
-                            (void_t) sdhReadFunction(SVL_SDH_STORAGE_DESC_AREA_START, (u8_t*)&numOfBinaries, sizeof(numOfBinaries));
-                            numOfBinaries++;
-                            (void_t) sdhWriteFunction(SVL_SDH_STORAGE_DESC_AREA_START, (u8_t*)&numOfBinaries, sizeof(numOfBinaries));
+                            // If buffer is full or last chunk was received, write it to FLASH.
+                            if (((flashBufferIndex * SVL_SDH_CHUNK_SIZE) >= SVL_SDH_FLASH_BUFFER_SIZE) || (chunkDesc.chunkIdx == (numOfChunks - 1)))
+                            {
+                                writeAddress = newBinaryDescriptor.binaryLocation + flashChunkIndex * SVL_SDH_FLASH_BUFFER_SIZE;
 
-                            sdhState = SDH_STATE_IDLE;
-                        }
-                        else
-                        {
-                            // Continue reception.
+                                // Erase up to the end of the erase block the write reaches, so the chunks can
+                                // be programmed directly. The erase function keeps the partial first sector.
+                                if ((sdhEraseFunction != NULL) && ((writeAddress + SVL_SDH_FLASH_BUFFER_SIZE) > eraseAddress) &&
+                                    (eraseAddress < eraseEndAddress))
+                                {
+                                    u32_t eraseBlockEnd = ((writeAddress + SVL_SDH_FLASH_BUFFER_SIZE + SVL_SDH_ERASE_BLOCK_SIZE - 1) /
+                                            SVL_SDH_ERASE_BLOCK_SIZE) * SVL_SDH_ERASE_BLOCK_SIZE;
+                                    eraseBlockEnd = eraseBlockEnd < eraseEndAddress ? eraseBlockEnd : eraseEndAddress;
+
+                                    (void_t) sdhEraseFunction(eraseAddress, eraseBlockEnd - eraseAddress);
+                                    eraseAddress = eraseBlockEnd;
+                                }
+                                else
+                                {
+                                    // Area already erased or chunks are written with read-modify-write.
+                                }
+
+                                (void_t) sdhWriteFunction(
+                                        writeAddress,
+                                        sdhFlashBuffer,
+										SVL_SDH_FLASH_BUFFER_SIZE
+                                );
+                            	flashBufferIndex = 0u;
+                            	flashChunkIndex++;
+                            }
+                            else
+                            {
+                            	// Wait for buffer to get full or for last chunk to be received.
+                            }
+
+                            chunkDesc.result = SDH_CHUNK_OK;
+
+                            // Check if all chunks have been received.
+                            if (chunkDesc.chunkIdx == (numOfChunks - 1))
+                            {
+                                GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "SDH binary download finished.\r\n");
+                                (void_t) drv_crcFinishCrc32(&downloadCrcContext, &downloadCrc);
+
+                                if (downloadCrc == newBinaryDescriptor.binaryInfo.crc)
+                                {
+                                    (void_t) sdhReadFunction(SVL_SDH_STORAGE_DESC_AREA_START, (u8_t*)&numOfBinaries, sizeof(numOfBinaries));
+                                    numOfBinaries++;
+                                    (void_t) sdhWriteFunction(SVL_SDH_STORAGE_DESC_AREA_START, (u8_t*)&numOfBinaries, sizeof(numOfBinaries));
+                                }
+                                else
+                                {
+                                    // Binary is corrupted, do not register it.
+                                    GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_ERROR, GOS_TRUE,
+                                            "SDH binary CRC mismatch (expected: %u, received: %u), binary discarded.\r\n",
+                                            newBinaryDescriptor.binaryInfo.crc, downloadCrc);
+                                    chunkDesc.result = SDH_CHUNK_CRC_ERR;
+                                }
+
+                                sdhState = SDH_STATE_IDLE;
+                            }
+                            else
+                            {
+                                // Continue reception.
+                            }
+
+                            expectedChunkIdx++;
                         }
+
+                        // Send response.
+                        (void_t) memcpy((void_t*)sdhBuffer, (void_t*)&chunkDesc, sizeof(chunkDesc));
+                        (void_t) gos_triggerIncrement(&sdhControlFeedbackTrigger);
                     }
                     break;
                 }
@@ -769,9 +987,7 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
                     {
                         (void_t) memcpy((void_t*)&index, (void_t*)sdhBuffer, sizeof(index));
                         (void_t) memcpy((void_t*)&defragment, (void_t*)sdhBuffer + sizeof(index), sizeof(defragment));
-#if SVL_SDH_TRACE_LEVEL > 0
-                        (void_t) gos_traceTraceFormatted(GOS_TRUE, "SDH binary erase request received. Index: %u\r\n", index);
-#endif
+                        GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "SDH binary erase request received. Index: %u\r\n", index);
 
                         (void_t) sdhReadFunction(SVL_SDH_STORAGE_DESC_AREA_START, (u8_t*)&numOfBinaries, sizeof(numOfBinaries));
 
@@ -853,16 +1069,14 @@ GOS_STATIC void_t svl_sdhDaemon (void_t)
         else
         {
             // Timeout.
-#if SVL_SDH_TRACE_LEVEL > 0
             if (sdhState != SDH_STATE_IDLE)
             {
-                (void_t) gos_traceTrace(GOS_TRUE, "SDH timeout.\r\n");
+                GOS_TRACE_LOG(sdhTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "SDH timeout.\r\n");
             }
             else
             {
                 // Just message RX timeout in idle state.
             }
-#endif
             sdhState = SDH_STATE_IDLE;
             (void_t) gos_taskSleep(100);
         }
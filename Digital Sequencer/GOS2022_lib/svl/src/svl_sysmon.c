@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       svl_sysmon.c
 //! @author     Ahmed Gazar
-//! @date       2025-06-18
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.9
 //!
 //! @brief      GOS2022 Library / System Monitoring Service source.
 //! @details    For a more detailed description of this service, please refer to @ref svl_sysmon.h
@@ -25,6 +25,22 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2025-06-18    Ahmed Gazar     Initial version created
+// 1.1        2026-10-19    Ahmed Gazar     +    Trace level set message added
+//                                          *    Compile-time trace levels replaced by the sysmon
+//                                               trace channel
+// 1.2        2026-10-19    Ahmed Gazar     +    Request worker pool added
+//                                          *    Daemon loops merged into a common dispatcher
+//                                          *    User messages locked by their own mutex
+// 1.3        2026-10-19    Ahmed Gazar     +    Vectored TX functions registered
+// 1.4        2026-10-19    Ahmed Gazar     +    Sorted dispatch table for sysmon and user messages
+//                                          -    Linear LUT and user message scans removed
+// 1.5        2026-10-19    Ahmed Gazar     +    Telemetry subscriptions and publisher task added
+// 1.6        2026-10-19    Ahmed Gazar     +    Task snapshot message added
+// 1.7        2026-10-19    Ahmed Gazar     *    User messages locked by the mutex of their service
+//                                               instead of their own mutex
+// 1.8        2026-10-19    Ahmed Gazar     *    Worker task IDs registered through a local variable
+// 1.9        2026-10-19    Ahmed Gazar     *    Task snapshot reads the variable fields directly from
+//                                               the task descriptors
 //*************************************************************************************************
 //
 // Copyright (c) 2025 Ahmed Gazar
@@ -52,6 +68,54 @@
 #include <svl_cfg.h>
 #include <string.h>
 
+/*
+ * Macros
+ */
+/**
+ * Trace channel name length in the trace level set message.
+ */
+#define SVL_SYSMON_TRACE_CHANNEL_NAME_LENGTH ( 16u )
+
+/**
+ * Size of the request buffer of the workers.
+ */
+#define SVL_SYSMON_WORKER_RX_BUFF_SIZE       ( (SVL_SYSMON_WIRED_RX_BUFF_SIZE > SVL_SYSMON_WIRELESS_RX_BUFF_SIZE) ? \
+                                               SVL_SYSMON_WIRED_RX_BUFF_SIZE : SVL_SYSMON_WIRELESS_RX_BUFF_SIZE )
+
+/**
+ * Sleep time of a daemon waiting for an idle worker [ms].
+ */
+#define SVL_SYSMON_WORKER_WAIT_MS            ( 2u )
+
+/**
+ * Size of the message dispatch table (sysmon and user messages).
+ */
+#define SVL_SYSMON_DISPATCH_TABLE_SIZE       ( SVL_SYSMON_MSG_NUM_OF_MESSAGES + SVL_SYSMON_MAX_USER_MESSAGES )
+
+/**
+ * End of user message chain.
+ */
+#define SVL_SYSMON_USER_MESSAGE_NONE         ( 0xFFu )
+
+/**
+ * Telemetry frame flag: key frame (every record is sent in full).
+ */
+#define SVL_SYSMON_TELEMETRY_FRAME_KEY       ( 0x01u )
+
+/**
+ * Telemetry frame flag: records omitted because the frame buffer is full.
+ */
+#define SVL_SYSMON_TELEMETRY_FRAME_TRUNCATED ( 0x02u )
+
+/**
+ * Telemetry record flag: record unchanged since the previous frame (no data follows).
+ */
+#define SVL_SYSMON_TELEMETRY_REC_UNCHANGED   ( 0x01u )
+
+#if SVL_SYSMON_MAX_USER_MESSAGES >= SVL_SYSMON_USER_MESSAGE_NONE
+#error "SVL_SYSMON_MAX_USER_MESSAGES: maximum 254 user messages are supported."
+#endif
+
 /*
  * Type definitions
  */
@@ -75,7 +139,13 @@ typedef enum
     SVL_SYSMON_MSG_SYSRUNTIME_GET_RESP,                  //!< System runtime get response message LUT index.
     SVL_SYSMON_MSG_SYSTIME_SET,                          //!< System time set message LUT index.
     SVL_SYSMON_MSG_SYSTIME_SET_RESP,                     //!< System time set response message LUT index.
+    SVL_SYSMON_MSG_TRACE_LEVEL_SET,                      //!< Trace level set message LUT index.
+    SVL_SYSMON_MSG_TRACE_LEVEL_SET_RESP,                 //!< Trace level set response message LUT index.
     SVL_SYSMON_MSG_RESET_REQ,                            //!< System reset message LUT index.
+    SVL_SYSMON_MSG_TELEMETRY_SUBSCRIBE,                  //!< Telemetry subscribe message LUT index.
+    SVL_SYSMON_MSG_TELEMETRY_SUBSCRIBE_RESP,             //!< Telemetry subscribe response message LUT index.
+    SVL_SYSMON_MSG_TASK_SNAPSHOT_GET,                    //!< Task snapshot get message LUT index.
+    SVL_SYSMON_MSG_TASK_SNAPSHOT_GET_RESP,               //!< Task snapshot get response message LUT index.
     SVL_SYSMON_MSG_NUM_OF_MESSAGES,                      //!< Number of messages.
 }svl_sysmonMessageEnum_t;
 
@@ -100,9 +170,25 @@ typedef enum
     SVL_SYSMON_MSG_SYSRUNTIME_GET_RESP_ID    = 0x0A06,   //!< System runtime get response message ID.
     SVL_SYSMON_MSG_SYSTIME_SET_ID            = 0x0007,   //!< System time set message ID.
     SVL_SYSMON_MSG_SYSTIME_SET_RESP_ID       = 0x0A07,   //!< System time set response ID.
+    SVL_SYSMON_MSG_TRACE_LEVEL_SET_ID        = 0x0008,   //!< Trace level set message ID.
+    SVL_SYSMON_MSG_TRACE_LEVEL_SET_RESP_ID   = 0x0A08,   //!< Trace level set response ID.
     SVL_SYSMON_MSG_RESET_REQ_ID              = 0x0FFF,   //!< System reset request ID.
+    SVL_SYSMON_MSG_TELEMETRY_SUB_ID          = 0x0009,   //!< Telemetry subscribe message ID.
+    SVL_SYSMON_MSG_TELEMETRY_SUB_RESP_ID     = 0x0A09,   //!< Telemetry subscribe response ID.
+    SVL_SYSMON_MSG_TELEMETRY_DATA_ID         = 0x0B09,   //!< Telemetry data (pushed) message ID.
+    SVL_SYSMON_MSG_TASK_SNAPSHOT_GET_ID      = 0x000A,   //!< Task snapshot get message ID.
+    SVL_SYSMON_MSG_TASK_SNAPSHOT_GET_RESP_ID = 0x0A0A,   //!< Task snapshot get response message ID.
 }svl_sysmonMessageId_t;
 
+/**
+ * Dispatch table entry type enum.
+ */
+typedef enum
+{
+    SVL_SYSMON_DISPATCH_SYSMON = 0,                      //!< Sysmon message (LUT entry).
+    SVL_SYSMON_DISPATCH_USER                             //!< User message.
+}svl_sysmonDispatchType_t;
+
 /**
  * Message result enum.
  */
@@ -250,6 +336,81 @@ typedef struct __attribute__((packed))
 {
 	svl_sysmonMessageResult_t messageResult;             //!< Message result.
 }svl_sysmonSystimeSetResultMessage_t;
+
+/**
+ * Trace level set message structure.
+ */
+typedef struct __attribute__((packed))
+{
+    char_t           channelName [SVL_SYSMON_TRACE_CHANNEL_NAME_LENGTH]; //!< Channel name ("all" for every channel).
+    gos_traceLevel_t level;                                              //!< Desired trace level.
+}svl_sysmonTraceLevelSetMessage_t;
+
+/**
+ * Trace level set message result structure.
+ */
+typedef struct __attribute__((packed))
+{
+	svl_sysmonMessageResult_t messageResult;             //!< Message result.
+}svl_sysmonTraceLevelSetResultMessage_t;
+
+/**
+ * Telemetry subscribe message structure.
+ */
+typedef struct __attribute__((packed))
+{
+    u16_t period;                                        //!< Publishing period [ms] (0: unsubscribe).
+    u32_t itemMask;                                      //!< Subscribed items (bit n: item n).
+}svl_sysmonTelemetrySubscribeMessage_t;
+
+/**
+ * Telemetry subscribe message result structure.
+ */
+typedef struct __attribute__((packed))
+{
+	svl_sysmonMessageResult_t messageResult;             //!< Message result.
+}svl_sysmonTelemetrySubscribeResultMessage_t;
+
+/**
+ * Task snapshot entry structure.
+ */
+typedef struct __attribute__((packed))
+{
+    gos_tid_t                    taskId;                 //!< Task ID.
+    svl_sysmonTaskVariableData_t taskVariableData;       //!< Task variable data.
+}svl_sysmonTaskSnapshotEntry_t;
+
+/**
+ * Task snapshot message structure (only the captured entries are sent).
+ */
+typedef struct __attribute__((packed))
+{
+	svl_sysmonMessageResult_t     messageResult;         //!< Message result.
+    u32_t                         sysTicks;              //!< System ticks at the time of capture.
+    u16_t                         taskCount;             //!< Number of captured tasks.
+    svl_sysmonTaskSnapshotEntry_t tasks [CFG_TASK_MAX_NUMBER]; //!< Task entries.
+}svl_sysmonTaskSnapshotMessage_t;
+
+/**
+ * Telemetry frame header structure.
+ */
+typedef struct __attribute__((packed))
+{
+    u16_t sequence;                                      //!< Frame sequence number.
+    u8_t  flags;                                         //!< Frame flags.
+    u16_t recordCount;                                   //!< Number of records in the frame.
+}svl_sysmonTelemetryFrameHeader_t;
+
+/**
+ * Telemetry record header structure.
+ */
+typedef struct __attribute__((packed))
+{
+    u8_t  itemId;                                        //!< Telemetry item ID.
+    u8_t  index;                                         //!< Record index within the item.
+    u8_t  flags;                                         //!< Record flags.
+    u16_t size;                                          //!< Size of the record data.
+}svl_sysmonTelemetryRecordHeader_t;
 /**
  * @}
  */
@@ -270,6 +431,41 @@ typedef struct
     svl_sysmonMessageHandler_t pHandler;                 //!< Handler function pointer.
 }svl_sysmonLut_t;
 
+/**
+ * Dispatch table entry structure.
+ */
+typedef struct
+{
+    u16_t                      messageId;                //!< Message ID.
+    u8_t                       type;                     //!< Entry type (svl_sysmonDispatchType_t).
+    u8_t                       index;                    //!< LUT index or index of the first user message.
+}svl_sysmonDispatchEntry_t;
+
+/**
+ * Telemetry subscription structure.
+ */
+typedef struct
+{
+    gos_gcpChannelNumber_t     channel;                  //!< Channel to publish on.
+    u16_t                      period;                   //!< Publishing period [ms] (0: inactive).
+    u32_t                      itemMask;                 //!< Subscribed items.
+    bool_t                     restart;                  //!< Subscription changed, restart with a key frame.
+}svl_sysmonTelemetrySubscription_t;
+
+/**
+ * Request worker descriptor structure.
+ */
+typedef struct
+{
+    gos_taskDescriptor_t       taskDescriptor;           //!< Worker task descriptor.
+    gos_trigger_t              trigger;                  //!< Worker wake-up trigger.
+    bool_t                     idle;                     //!< Worker idle flag.
+    gos_gcpChannelNumber_t     channel;                  //!< Channel of the request.
+    gos_gcpTransactionId_t     transactionId;            //!< Transaction ID of the request.
+    u16_t                      messageId;                //!< Message ID of the request.
+    u8_t                       rxBuffer [SVL_SYSMON_WORKER_RX_BUFF_SIZE]; //!< Request payload.
+}svl_sysmonWorker_t;
+
 /*
  * External variables
  */
@@ -351,17 +547,119 @@ GOS_STATIC svl_sysmonSystimeSetMessage_t          sysTimeSetMessage          = {
  */
 GOS_STATIC svl_sysmonSystimeSetResultMessage_t    sysTimeSetResultMessage    = {0};
 
+/**
+ * Trace level set message.
+ */
+GOS_STATIC svl_sysmonTraceLevelSetMessage_t       traceLevelSetMessage       = {0};
+
+/**
+ * Trace level set result message.
+ */
+GOS_STATIC svl_sysmonTraceLevelSetResultMessage_t traceLevelSetResultMessage = {0};
+
+/**
+ * Task snapshot message.
+ */
+GOS_STATIC svl_sysmonTaskSnapshotMessage_t             taskSnapshotMessage             = {0};
+
+/**
+ * Telemetry subscribe message.
+ */
+GOS_STATIC svl_sysmonTelemetrySubscribeMessage_t       telemetrySubscribeMessage       = {0};
+
+/**
+ * Telemetry subscribe result message.
+ */
+GOS_STATIC svl_sysmonTelemetrySubscribeResultMessage_t telemetrySubscribeResultMessage = {0};
+
+/**
+ * Sysmon trace channel.
+ */
+GOS_STATIC gos_traceChannel_t                     sysmonTraceChannel         = GOS_TRACE_CHANNEL_INIT("sysmon", SVL_SYSMON_TRACE_LEVEL);
+
 /**
  * Sysmon user messages.
  */
 GOS_STATIC svl_sysmonUserMessageDescriptor_t      userMessages [SVL_SYSMON_MAX_USER_MESSAGES];
 
+/**
+ * Common user message mutex (for user messages without a service mutex).
+ */
+GOS_STATIC gos_mutex_t                            userMessageMutex;
+
+/**
+ * Request workers.
+ */
+GOS_STATIC svl_sysmonWorker_t                     workers [SVL_SYSMON_WORKER_NUMBER];
+
+/**
+ * Next user message with the same ID (chain of duplicate registrations).
+ */
+GOS_STATIC u8_t                                   userMessageNext [SVL_SYSMON_MAX_USER_MESSAGES];
+
+/**
+ * Message dispatch table sorted by message ID.
+ */
+GOS_STATIC volatile svl_sysmonDispatchEntry_t     dispatchTable [SVL_SYSMON_DISPATCH_TABLE_SIZE];
+
+/**
+ * Number of entries in the dispatch table.
+ */
+GOS_STATIC volatile u8_t                          dispatchEntryCount;
+
+/**
+ * Dispatch table version (incremented on every modification).
+ */
+GOS_STATIC volatile u32_t                         dispatchTableVersion;
+
+/**
+ * Telemetry subscription.
+ */
+GOS_STATIC svl_sysmonTelemetrySubscription_t      telemetrySubscription;
+
+/**
+ * Telemetry publisher wake-up trigger (subscription changed).
+ */
+GOS_STATIC gos_trigger_t                          telemetryTrigger;
+
+/**
+ * Telemetry record fill functions (indexed by item ID).
+ */
+GOS_STATIC svl_sysmonTelemetryFillFunction_t      telemetryFillFunctions [SVL_SYSMON_TELEMETRY_ITEM_NUM];
+
+/**
+ * Mask of the items with a registered fill function.
+ */
+GOS_STATIC u32_t                                  telemetryItemMask;
+
+/**
+ * Telemetry frame buffer.
+ */
+GOS_STATIC u8_t                                   telemetryFrame [SVL_SYSMON_TELEMETRY_BUFF_SIZE];
+
+/**
+ * Previous telemetry sample (every record in full) for delta encoding.
+ */
+GOS_STATIC u8_t                                   telemetrySample [SVL_SYSMON_TELEMETRY_BUFF_SIZE];
+
+/**
+ * Size of the previous telemetry sample.
+ */
+GOS_STATIC u16_t                                  telemetrySampleSize;
+
+/**
+ * Task descriptor buffer of the telemetry publisher.
+ */
+GOS_STATIC gos_taskDescriptor_t                   telemetryTaskDesc;
+
 /*
  * Function prototypes
  */
 GOS_STATIC gos_result_t              svl_sysmonFillTaskData              (svl_sysmonTaskData_t* pSysmonTaskData, gos_taskDescriptor_t* pTaskData);
-GOS_STATIC gos_result_t              svl_sysmonFillTskVariableData       (svl_sysmonTaskVariableData_t* pSysmonTaskVariableData, gos_taskDescriptor_t* pTaskData);
-GOS_STATIC svl_sysmonMessageEnum_t   svl_sysmonGetLutIndex               (svl_sysmonMessageId_t messageId);
+GOS_STATIC gos_result_t              svl_sysmonFillTskVariableData       (svl_sysmonTaskVariableData_t* pSysmonTaskVariableData, GOS_CONST gos_taskDescriptor_t* pTaskData);
+GOS_STATIC u8_t                      svl_sysmonDispatchSearch            (u16_t messageId);
+GOS_STATIC gos_result_t              svl_sysmonDispatchInsert            (u16_t messageId, svl_sysmonDispatchType_t type, u8_t index);
+GOS_STATIC bool_t                    svl_sysmonGetDispatchEntry          (u16_t messageId, svl_sysmonDispatchEntry_t* pEntry);
 GOS_STATIC svl_sysmonMessageResult_t svl_sysmonCheckMessage              (void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex);
 GOS_STATIC void_t                    svl_sysmonSendResponse              (gos_gcpChannelNumber_t gcpChannel, svl_sysmonMessageEnum_t lutIndex);
 GOS_STATIC void_t                    svl_sysmonHandlePingRequest         (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex);
@@ -371,9 +669,19 @@ GOS_STATIC void_t                    svl_sysmonHandleTaskVariableDataGet (gos_gc
 GOS_STATIC void_t                    svl_sysmonHandleTaskModification    (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex);
 GOS_STATIC void_t                    svl_sysmonHandleSysRuntimeGet       (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex);
 GOS_STATIC void_t                    svl_sysmonHandleSystimeSet          (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex);
+GOS_STATIC void_t                    svl_sysmonHandleTraceLevelSet       (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex);
 GOS_STATIC void_t                    svl_sysmonHandleResetRequest        (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex);
+GOS_STATIC void_t                    svl_sysmonHandleTelemetrySubscribe  (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex);
+GOS_STATIC void_t                    svl_sysmonHandleTaskSnapshotGet     (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex);
+GOS_STATIC void_t                    svl_sysmonServeChannel              (gos_gcpChannelNumber_t gcpChannel, u8_t* pRxBuffer, u16_t rxBufferSize);
+GOS_STATIC void_t                    svl_sysmonDispatchMessage           (gos_gcpChannelNumber_t gcpChannel, u16_t messageId, u8_t* pBuffer);
+GOS_STATIC void_t                    svl_sysmonWorkerTask                (void_t);
 GOS_STATIC void_t                    svl_sysmonWiredDaemonTask           (void_t);
 GOS_STATIC void_t                    svl_sysmonWirelessDaemonTask        (void_t);
+GOS_STATIC u16_t                     svl_sysmonTelemetryFillCpu          (u8_t index, u8_t* pBuffer, u16_t bufferSize);
+GOS_STATIC u16_t                     svl_sysmonTelemetryFillTasks        (u8_t index, u8_t* pBuffer, u16_t bufferSize);
+GOS_STATIC u16_t                     svl_sysmonTelemetryBuildFrame       (u16_t sequence, u32_t itemMask, bool_t keyFrame);
+GOS_STATIC void_t                    svl_sysmonTelemetryTask             (void_t);
 
 /**
  * Sysmon wired daemon task descriptor.
@@ -399,6 +707,18 @@ GOS_STATIC gos_taskDescriptor_t sysmonWirelessDaemonTaskDesc =
     .taskPrivilegeLevel  = GOS_TASK_PRIVILEGE_KERNEL
 };
 
+/**
+ * Sysmon telemetry publisher task descriptor.
+ */
+GOS_STATIC gos_taskDescriptor_t sysmonTelemetryTaskDesc =
+{
+    .taskFunction        = svl_sysmonTelemetryTask,
+    .taskName            = "svl_sysmon_telemetry",
+    .taskPriority        = SVL_SYSMON_TELEMETRY_PRIO,
+    .taskStackSize       = SVL_SYSMON_TELEMETRY_STACK,
+    .taskPrivilegeLevel  = GOS_TASK_PRIVILEGE_KERNEL
+};
+
 /**
  * Sysmon look-up table.
  */
@@ -501,6 +821,19 @@ GOS_STATIC GOS_CONST svl_sysmonLut_t sysmonLut [SVL_SYSMON_MSG_NUM_OF_MESSAGES]
         .pMessagePayload = (void_t*)&sysTimeSetResultMessage,
         .payloadSize     = sizeof(sysTimeSetResultMessage)
     },
+    [SVL_SYSMON_MSG_TRACE_LEVEL_SET]        =
+    {
+        .messageId       = SVL_SYSMON_MSG_TRACE_LEVEL_SET_ID,
+        .pMessagePayload = (void_t*)&traceLevelSetMessage,
+        .payloadSize     = sizeof(traceLevelSetMessage),
+        .pHandler        = svl_sysmonHandleTraceLevelSet
+    },
+    [SVL_SYSMON_MSG_TRACE_LEVEL_SET_RESP]   =
+    {
+        .messageId       = SVL_SYSMON_MSG_TRACE_LEVEL_SET_RESP_ID,
+        .pMessagePayload = (void_t*)&traceLevelSetResultMessage,
+        .payloadSize     = sizeof(traceLevelSetResultMessage)
+    },
     [SVL_SYSMON_MSG_RESET_REQ]              =
     {
         .messageId       = SVL_SYSMON_MSG_RESET_REQ_ID,
@@ -508,6 +841,32 @@ GOS_STATIC GOS_CONST svl_sysmonLut_t sysmonLut [SVL_SYSMON_MSG_NUM_OF_MESSAGES]
         .payloadSize     = 0u,
         .pHandler        = svl_sysmonHandleResetRequest
     },
+    [SVL_SYSMON_MSG_TELEMETRY_SUBSCRIBE]    =
+    {
+        .messageId       = SVL_SYSMON_MSG_TELEMETRY_SUB_ID,
+        .pMessagePayload = (void_t*)&telemetrySubscribeMessage,
+        .payloadSize     = sizeof(telemetrySubscribeMessage),
+        .pHandler        = svl_sysmonHandleTelemetrySubscribe
+    },
+    [SVL_SYSMON_MSG_TELEMETRY_SUBSCRIBE_RESP] =
+    {
+        .messageId       = SVL_SYSMON_MSG_TELEMETRY_SUB_RESP_ID,
+        .pMessagePayload = (void_t*)&telemetrySubscribeResultMessage,
+        .payloadSize     = sizeof(telemetrySubscribeResultMessage)
+    },
+    [SVL_SYSMON_MSG_TASK_SNAPSHOT_GET]      =
+    {
+        .messageId       = SVL_SYSMON_MSG_TASK_SNAPSHOT_GET_ID,
+        .pMessagePayload = NULL,
+        .payloadSize     = 0u,
+        .pHandler        = svl_sysmonHandleTaskSnapshotGet
+    },
+    [SVL_SYSMON_MSG_TASK_SNAPSHOT_GET_RESP] =
+    {
+        .messageId       = SVL_SYSMON_MSG_TASK_SNAPSHOT_GET_RESP_ID,
+        .pMessagePayload = (void_t*)&taskSnapshotMessage,
+        .payloadSize     = sizeof(taskSnapshotMessage)
+    },
 };
 
 /*
@@ -520,6 +879,10 @@ gos_result_t svl_sysmonInit (void_t)
      */
     gos_result_t sysmonInitResult = GOS_SUCCESS;
     u8_t         userMessageIndex = 0u;
+    u8_t         workerIndex      = 0u;
+    u8_t         nameLength       = 0u;
+    u8_t         lutIndex         = 0u;
+    gos_tid_t    workerTaskId     = GOS_INVALID_TASK_ID;
 
     /*
      * Function code.
@@ -530,13 +893,59 @@ gos_result_t svl_sysmonInit (void_t)
         userMessages[userMessageIndex].payload     = NULL;
         userMessages[userMessageIndex].payloadSize = 0u;
         userMessages[userMessageIndex].messageId   = SVL_SYSMON_MSG_INVALID_ID;
+        userMessageNext[userMessageIndex]          = SVL_SYSMON_USER_MESSAGE_NONE;
+    }
+
+    GOS_CONCAT_RESULT(sysmonInitResult, gos_mutexInit(&userMessageMutex));
+
+    // Built-in telemetry items.
+    for (lutIndex = 0u; lutIndex < SVL_SYSMON_TELEMETRY_ITEM_NUM; lutIndex++)
+    {
+        telemetryFillFunctions[lutIndex] = NULL;
+    }
+
+    telemetryFillFunctions[SVL_SYSMON_TELEMETRY_ITEM_CPU]   = svl_sysmonTelemetryFillCpu;
+    telemetryFillFunctions[SVL_SYSMON_TELEMETRY_ITEM_TASKS] = svl_sysmonTelemetryFillTasks;
+    telemetryItemMask      = (1u << SVL_SYSMON_TELEMETRY_ITEM_CPU) | (1u << SVL_SYSMON_TELEMETRY_ITEM_TASKS);
+    telemetrySubscription.period = 0u;
+
+    GOS_CONCAT_RESULT(sysmonInitResult, gos_triggerInit(&telemetryTrigger));
+    GOS_CONCAT_RESULT(sysmonInitResult, gos_taskRegister(&sysmonTelemetryTaskDesc, NULL));
+
+    // Build dispatch table from the LUT (the unknown message entry is not dispatched).
+    dispatchEntryCount = 0u;
+
+    for (lutIndex = (u8_t)SVL_SYSMON_MSG_PING; lutIndex < (u8_t)SVL_SYSMON_MSG_NUM_OF_MESSAGES; lutIndex++)
+    {
+        GOS_CONCAT_RESULT(sysmonInitResult, svl_sysmonDispatchInsert(sysmonLut[lutIndex].messageId,
+                SVL_SYSMON_DISPATCH_SYSMON, lutIndex));
     }
 
+    // Register worker tasks.
+    for (workerIndex = 0u; workerIndex < SVL_SYSMON_WORKER_NUMBER; workerIndex++)
+    {
+        (void_t) strcpy(workers[workerIndex].taskDescriptor.taskName, "svl_sysmon_worker_0");
+        nameLength = (u8_t)strlen(workers[workerIndex].taskDescriptor.taskName);
+
+        workers[workerIndex].taskDescriptor.taskName[nameLength - 1u] = (char_t)('0' + workerIndex);
+        workers[workerIndex].taskDescriptor.taskFunction              = svl_sysmonWorkerTask;
+        workers[workerIndex].taskDescriptor.taskStackSize             = SVL_SYSMON_WORKER_STACK;
+        workers[workerIndex].taskDescriptor.taskPriority              = SVL_SYSMON_WORKER_PRIO;
+        workers[workerIndex].taskDescriptor.taskPrivilegeLevel        = GOS_TASK_PRIVILEGE_KERNEL;
+        workers[workerIndex].idle                                     = GOS_TRUE;
+
+        GOS_CONCAT_RESULT(sysmonInitResult, gos_triggerInit(&workers[workerIndex].trigger));
+        GOS_CONCAT_RESULT(sysmonInitResult, gos_taskRegister(&workers[workerIndex].taskDescriptor, &workerTaskId));
+        workers[workerIndex].taskDescriptor.taskId = workerTaskId;
+    }
+
+    GOS_CONCAT_RESULT(sysmonInitResult, gos_traceChannelRegister(&sysmonTraceChannel));
+
     if (sysmonConfig.wiredRxFunction != NULL &&
     	sysmonConfig.wiredTxFunction != NULL)
     {
     	GOS_CONCAT_RESULT(sysmonInitResult, gos_gcpRegisterPhysicalDriver(sysmonConfig.wiredChannelNumber,
-    			sysmonConfig.wiredTxFunction, sysmonConfig.wiredRxFunction));
+    			sysmonConfig.wiredTxFunction, sysmonConfig.wiredTxVectorFunction, sysmonConfig.wiredRxFunction));
         // Register task.
         GOS_CONCAT_RESULT(sysmonInitResult, gos_taskRegister(&sysmonWiredDaemonTaskDesc, NULL));
     }
@@ -549,7 +958,7 @@ gos_result_t svl_sysmonInit (void_t)
 		sysmonConfig.wirelessTxFunction != NULL)
     {
     	GOS_CONCAT_RESULT(sysmonInitResult, gos_gcpRegisterPhysicalDriver(sysmonConfig.wirelessChannelNumber,
-    			sysmonConfig.wirelessTxFunction, sysmonConfig.wirelessRxFunction));
+    			sysmonConfig.wirelessTxFunction, sysmonConfig.wirelessTxVectorFunction, sysmonConfig.wirelessRxFunction));
     	// Register task.
     	GOS_CONCAT_RESULT(sysmonInitResult, gos_taskRegister(&sysmonWirelessDaemonTaskDesc, NULL));
     }
@@ -585,9 +994,10 @@ gos_result_t svl_sysmonRegisterUserMessage (svl_sysmonUserMessageDescriptor_t* p
             if (userMessages[userMessageIndex].messageId == SVL_SYSMON_MSG_INVALID_ID &&
                 userMessages[userMessageIndex].callback  == NULL)
             {
-                // Store user message descriptor.
+                // Store user message descriptor and make it visible for the dispatcher.
                 (void_t) memcpy((void_t*)&userMessages[userMessageIndex], (void_t*)pDesc, sizeof(*pDesc));
-                registerResult = GOS_SUCCESS;
+                userMessageNext[userMessageIndex] = SVL_SYSMON_USER_MESSAGE_NONE;
+                registerResult = svl_sysmonDispatchInsert(pDesc->messageId, SVL_SYSMON_DISPATCH_USER, userMessageIndex);
                 break;
             }
             else
@@ -604,6 +1014,42 @@ gos_result_t svl_sysmonRegisterUserMessage (svl_sysmonUserMessageDescriptor_t* p
     return registerResult;
 }
 
+/*
+ * Function: svl_sysmonRegisterTelemetrySource
+ */
+gos_result_t svl_sysmonRegisterTelemetrySource (svl_sysmonTelemetrySourceDescriptor_t* pDesc)
+{
+    /*
+     * Local variables.
+     */
+    gos_result_t registerResult = GOS_ERROR;
+
+    /*
+     * Function code.
+     */
+    if ((pDesc != NULL) && (pDesc->fillFunction != NULL) && (pDesc->itemId < SVL_SYSMON_TELEMETRY_ITEM_NUM))
+    {
+        GOS_ATOMIC_ENTER
+        if (telemetryFillFunctions[pDesc->itemId] == NULL)
+        {
+            telemetryFillFunctions[pDesc->itemId] = pDesc->fillFunction;
+            telemetryItemMask |= (1u << pDesc->itemId);
+            registerResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Item already registered.
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Error.
+    }
+
+    return registerResult;
+}
+
 /**
  * @brief   Fills the task data structure.
  * @details Copies the relevant fields of the task descriptor to the task
@@ -665,7 +1111,7 @@ GOS_STATIC gos_result_t svl_sysmonFillTaskData (svl_sysmonTaskData_t* pSysmonTas
  * @retval  #GOS_SUCCESS Data filled successfully.
  * @retval  #GOS_ERROR   Either of the function parameters is NULL.
  */
-GOS_STATIC gos_result_t svl_sysmonFillTskVariableData (svl_sysmonTaskVariableData_t* pSysmonTaskVariableData, gos_taskDescriptor_t* pTaskData)
+GOS_STATIC gos_result_t svl_sysmonFillTskVariableData (svl_sysmonTaskVariableData_t* pSysmonTaskVariableData, GOS_CONST gos_taskDescriptor_t* pTaskData)
 {
 	/*
 	 * Local variables.
@@ -684,7 +1130,7 @@ GOS_STATIC gos_result_t svl_sysmonFillTskVariableData (svl_sysmonTaskVariableDat
         pSysmonTaskVariableData->taskCsCounter     = pTaskData->taskCsCounter;
         pSysmonTaskVariableData->taskState         = pTaskData->taskState;
 
-        (void_t) memcpy((void_t*)&(pSysmonTaskVariableData->taskRunTime), (void_t*)&(pTaskData->taskRunTime), sizeof(pTaskData->taskRunTime));
+        (void_t) memcpy((void_t*)&(pSysmonTaskVariableData->taskRunTime), (GOS_CONST void_t*)&(pTaskData->taskRunTime), sizeof(pTaskData->taskRunTime));
 
 	    fillResult = GOS_SUCCESS;
 	}
@@ -697,90 +1143,228 @@ GOS_STATIC gos_result_t svl_sysmonFillTskVariableData (svl_sysmonTaskVariableDat
 }
 
 /**
- * @brief   Gets the LUT index of the given message.
- * @details Returns the look-up table index that belongs to the given message ID.
+ * @brief   Searches the dispatch table.
+ * @details Binary search for the first entry whose message ID is not less than
+ *          the given ID.
  *
- * @param[in] messageId ID of the message to get the index for.
+ * @param[in] messageId ID of the message to search for.
  *
- * @return  Look-up table index of the message.
+ * @return  Position of the message in the dispatch table (or the position
+ *          where it should be inserted).
  */
-GOS_STATIC svl_sysmonMessageEnum_t svl_sysmonGetLutIndex (svl_sysmonMessageId_t messageId)
+GOS_STATIC u8_t svl_sysmonDispatchSearch (u16_t messageId)
 {
     /*
      * Local variables.
      */
-	svl_sysmonMessageEnum_t index = 0u;
+    u8_t lower = 0u;
+    u8_t upper = dispatchEntryCount;
+    u8_t middle = 0u;
 
     /*
      * Function code.
      */
-    for (index = 0u; index < SVL_SYSMON_MSG_NUM_OF_MESSAGES; index++)
+    while (lower < upper)
     {
-        if (sysmonLut[index].messageId == messageId)
+        middle = (u8_t)((lower + upper) >> 1);
+
+        if (dispatchTable[middle].messageId < messageId)
         {
-            break;
+            lower = middle + 1u;
         }
         else
         {
-            // Continue searching.
+            upper = middle;
         }
     }
 
-    return index;
+    return lower;
 }
 
 /**
- * @brief   Checks the high-level message parameters.
- * @details Checks the protocol version and the payload CRC value.
+ * @brief   Inserts a message in the dispatch table.
+ * @details Keeps the table sorted by message ID. User messages registered with an
+ *          existing user message ID are chained to the existing entry, while user
+ *          messages with a sysmon message ID are not dispatched. The modification
+ *          is done atomically, and the table version is incremented so that a
+ *          lookup interrupted by it is repeated.
  *
- * @param[in] pBuffer  Pointer to the buffer to copy from.
- * @param[in] lutIndex Look-up table index of the message.
+ * @param[in] messageId ID of the message.
+ * @param[in] type      Entry type.
+ * @param[in] index     LUT index or user message index.
  *
- * @return  Result of message checking.
+ * @return  Result of insertion.
  *
- * @retval  #SVL_SYSMON_MSG_RES_OK          Message OK.
+ * @retval  #GOS_SUCCESS Message inserted (or chained) successfully.
+ * @retval  #GOS_ERROR   Dispatch table is full or sysmon message ID is duplicated.
  */
-GOS_STATIC svl_sysmonMessageResult_t svl_sysmonCheckMessage (void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex)
+GOS_STATIC gos_result_t svl_sysmonDispatchInsert (u16_t messageId, svl_sysmonDispatchType_t type, u8_t index)
 {
     /*
      * Local variables.
      */
-    svl_sysmonMessageResult_t result = SVL_SYSMON_MSG_RES_OK;
+    gos_result_t insertResult = GOS_ERROR;
+    u8_t         position     = 0u;
+    u8_t         entryIndex   = 0u;
+    u8_t         chainIndex   = 0u;
 
     /*
      * Function code.
      */
-    // Check if there is a payload to be copied.
-    if (sysmonLut[lutIndex].pMessagePayload != NULL)
+    GOS_ATOMIC_ENTER
+    position = svl_sysmonDispatchSearch(messageId);
+
+    if ((position < dispatchEntryCount) && (dispatchTable[position].messageId == messageId))
     {
-        (void_t) memcpy(sysmonLut[lutIndex].pMessagePayload, pBuffer, sysmonLut[lutIndex].payloadSize);
+        if ((dispatchTable[position].type == SVL_SYSMON_DISPATCH_USER) && (type == SVL_SYSMON_DISPATCH_USER))
+        {
+            // Append user message to the end of the chain.
+            chainIndex = dispatchTable[position].index;
+
+            while (userMessageNext[chainIndex] != SVL_SYSMON_USER_MESSAGE_NONE)
+            {
+                chainIndex = userMessageNext[chainIndex];
+            }
+
+            userMessageNext[chainIndex] = index;
+            insertResult                = GOS_SUCCESS;
+        }
+        else if (type == SVL_SYSMON_DISPATCH_USER)
+        {
+            // Sysmon messages take precedence, user message is not dispatched.
+            insertResult = GOS_SUCCESS;
+        }
+        else
+        {
+            // Duplicated sysmon message ID.
+        }
+    }
+    else if (dispatchEntryCount < SVL_SYSMON_DISPATCH_TABLE_SIZE)
+    {
+        // Shift the greater IDs and insert new entry.
+        for (entryIndex = dispatchEntryCount; entryIndex > position; entryIndex--)
+        {
+            dispatchTable[entryIndex].messageId = dispatchTable[entryIndex - 1u].messageId;
+            dispatchTable[entryIndex].type      = dispatchTable[entryIndex - 1u].type;
+            dispatchTable[entryIndex].index     = dispatchTable[entryIndex - 1u].index;
+        }
+
+        dispatchTable[position].messageId = messageId;
+        dispatchTable[position].type      = (u8_t)type;
+        dispatchTable[position].index     = index;
+        dispatchEntryCount++;
+        dispatchTableVersion++;
+        insertResult = GOS_SUCCESS;
     }
     else
     {
-        // Nothing to do.
+        // Dispatch table is full.
     }
+    GOS_ATOMIC_EXIT
 
-    return result;
+    return insertResult;
 }
 
 /**
- * @brief   Sends the response to the given message.
- * @details Fills out the remaining transmit header parameters (except for the result field),
- *          and transmits the message with the corresponding payload.
+ * @brief   Gets the dispatch table entry of the given message.
+ * @details Looks up the message without locking. If the table has been modified
+ *          during the lookup, the lookup is repeated.
  *
- * @param[in] gcpChannel GCP channel number to transmit the response on.
- * @param[in] lutIndex   Look-up table index of the message.
+ * @param[in]  messageId ID of the message to get the entry for.
+ * @param[out] pEntry    Pointer to the entry to copy to.
  *
- * @return  -
+ * @return  Whether the message has been found.
+ *
+ * @retval  #GOS_TRUE  Message found.
+ * @retval  #GOS_FALSE Unknown message ID.
  */
-GOS_STATIC void_t svl_sysmonSendResponse (gos_gcpChannelNumber_t gcpChannel, svl_sysmonMessageEnum_t lutIndex)
+GOS_STATIC bool_t svl_sysmonGetDispatchEntry (u16_t messageId, svl_sysmonDispatchEntry_t* pEntry)
 {
+    /*
+     * Local variables.
+     */
+    bool_t found    = GOS_FALSE;
+    u32_t  version  = 0u;
+    u8_t   position = 0u;
+
     /*
      * Function code.
      */
-    (void_t) gos_gcpTransmitMessage(
-    		gcpChannel,                          sysmonLut[lutIndex].messageId,
-            sysmonLut[lutIndex].pMessagePayload, sysmonLut[lutIndex].payloadSize,
+    do
+    {
+        version  = dispatchTableVersion;
+        found    = GOS_FALSE;
+        position = svl_sysmonDispatchSearch(messageId);
+
+        if ((position < dispatchEntryCount) && (dispatchTable[position].messageId == messageId))
+        {
+            pEntry->messageId = dispatchTable[position].messageId;
+            pEntry->type      = dispatchTable[position].type;
+            pEntry->index     = dispatchTable[position].index;
+            found             = GOS_TRUE;
+        }
+        else
+        {
+            // Unknown message ID.
+        }
+    }
+    while (version != dispatchTableVersion);
+
+    return found;
+}
+
+/**
+ * @brief   Checks the high-level message parameters.
+ * @details Checks the protocol version and the payload CRC value.
+ *
+ * @param[in] pBuffer  Pointer to the buffer to copy from.
+ * @param[in] lutIndex Look-up table index of the message.
+ *
+ * @return  Result of message checking.
+ *
+ * @retval  #SVL_SYSMON_MSG_RES_OK          Message OK.
+ */
+GOS_STATIC svl_sysmonMessageResult_t svl_sysmonCheckMessage (void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex)
+{
+    /*
+     * Local variables.
+     */
+    svl_sysmonMessageResult_t result = SVL_SYSMON_MSG_RES_OK;
+
+    /*
+     * Function code.
+     */
+    // Check if there is a payload to be copied.
+    if (sysmonLut[lutIndex].pMessagePayload != NULL)
+    {
+        (void_t) memcpy(sysmonLut[lutIndex].pMessagePayload, pBuffer, sysmonLut[lutIndex].payloadSize);
+    }
+    else
+    {
+        // Nothing to do.
+    }
+
+    return result;
+}
+
+/**
+ * @brief   Sends the response to the given message.
+ * @details Fills out the remaining transmit header parameters (except for the result field),
+ *          and transmits the message with the corresponding payload.
+ *
+ * @param[in] gcpChannel GCP channel number to transmit the response on.
+ * @param[in] lutIndex   Look-up table index of the message.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t svl_sysmonSendResponse (gos_gcpChannelNumber_t gcpChannel, svl_sysmonMessageEnum_t lutIndex)
+{
+    /*
+     * Function code.
+     */
+    (void_t) gos_gcpTransmitMessage(
+    		gcpChannel,                          sysmonLut[lutIndex].messageId,
+            sysmonLut[lutIndex].pMessagePayload, sysmonLut[lutIndex].payloadSize,
 			0xFFFF
             );
 }
@@ -1171,6 +1755,45 @@ GOS_STATIC void_t svl_sysmonHandleSystimeSet (gos_gcpChannelNumber_t gcpChannel,
     (void_t) svl_sysmonSendResponse(gcpChannel, (lutIndex + 1));
 }
 
+/**
+ * @brief   Handles the trace level set request.
+ * @details Sets the runtime level of the requested trace channel.
+ *
+ * @param[in] gcpChannel GCP channel number to transmit the response on.
+ * @param[in] pBuffer    The buffer with the received bytes.
+ * @param[in] lutIndex   Look-up table index of the message.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t svl_sysmonHandleTraceLevelSet (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex)
+{
+    /*
+     * Function code.
+     */
+    traceLevelSetResultMessage.messageResult = svl_sysmonCheckMessage(pBuffer, lutIndex);
+
+    if (traceLevelSetResultMessage.messageResult == SVL_SYSMON_MSG_RES_OK)
+    {
+        // Make sure the name is terminated.
+        traceLevelSetMessage.channelName[SVL_SYSMON_TRACE_CHANNEL_NAME_LENGTH - 1] = '\0';
+
+        if (gos_traceChannelSetLevel(traceLevelSetMessage.channelName, traceLevelSetMessage.level) == GOS_SUCCESS)
+        {
+            traceLevelSetResultMessage.messageResult = SVL_SYSMON_MSG_RES_OK;
+        }
+        else
+        {
+            traceLevelSetResultMessage.messageResult = SVL_SYSMON_MSG_RES_ERROR;
+        }
+    }
+    else
+    {
+        // Message error.
+    }
+
+    (void_t) svl_sysmonSendResponse(gcpChannel, (lutIndex + 1));
+}
+
 /**
  * @brief   Handles the system reset request.
  * @details Resets the system.
@@ -1197,20 +1820,138 @@ GOS_STATIC void_t svl_sysmonHandleResetRequest (gos_gcpChannelNumber_t gcpChanne
 }
 
 /**
- * @brief   System monitoring wired daemon task.
- * @details Serves the incoming system monitoring requests
- *          on the wired GCP channel.
+ * @brief   Handles the telemetry subscribe request.
+ * @details Replaces the telemetry subscription with the requested one and wakes
+ *          up the publisher. A period of 0 cancels the subscription.
+ *
+ * @param[in] gcpChannel GCP channel number to transmit the response and the telemetry on.
+ * @param[in] pBuffer    The buffer with the received bytes.
+ * @param[in] lutIndex   Look-up table index of the message.
  *
  * @return  -
  */
-GOS_STATIC void_t svl_sysmonWiredDaemonTask (void_t)
+GOS_STATIC void_t svl_sysmonHandleTelemetrySubscribe (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex)
+{
+    /*
+     * Function code.
+     */
+    telemetrySubscribeResultMessage.messageResult = svl_sysmonCheckMessage(pBuffer, lutIndex);
+
+    if (telemetrySubscribeResultMessage.messageResult == SVL_SYSMON_MSG_RES_OK)
+    {
+        if ((telemetrySubscribeMessage.period != 0u) &&
+            ((telemetrySubscribeMessage.period < SVL_SYSMON_TELEMETRY_MIN_PERIOD) ||
+             (telemetrySubscribeMessage.itemMask == 0u) ||
+             ((telemetrySubscribeMessage.itemMask & ~telemetryItemMask) != 0u)))
+        {
+            // Too short period or unknown item.
+            telemetrySubscribeResultMessage.messageResult = SVL_SYSMON_MSG_RES_ERROR;
+        }
+        else
+        {
+            GOS_ATOMIC_ENTER
+            telemetrySubscription.channel  = gcpChannel;
+            telemetrySubscription.period   = telemetrySubscribeMessage.period;
+            telemetrySubscription.itemMask = telemetrySubscribeMessage.itemMask;
+            telemetrySubscription.restart  = GOS_TRUE;
+            GOS_ATOMIC_EXIT
+
+            (void_t) gos_triggerIncrement(&telemetryTrigger);
+        }
+    }
+    else
+    {
+        // Message error.
+    }
+
+    (void_t) svl_sysmonSendResponse(gcpChannel, (lutIndex + 1));
+}
+
+/**
+ * @brief   Handles the task snapshot get request.
+ * @details Captures the variable data of every task atomically, so the entries
+ *          belong to the same system tick, and sends them in one message (chunked
+ *          by GCP). Only the variable fields are read from the task descriptors
+ *          (not the whole descriptors), so the atomic section stays short. Only
+ *          the captured entries are transmitted.
+ *
+ * @param[in] gcpChannel GCP channel number to transmit the response on.
+ * @param[in] pBuffer    The buffer with the received bytes.
+ * @param[in] lutIndex   Look-up table index of the message.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t svl_sysmonHandleTaskSnapshotGet (gos_gcpChannelNumber_t gcpChannel, void_t* pBuffer, svl_sysmonMessageEnum_t lutIndex)
+{
+    /*
+     * Local variables.
+     */
+    u16_t                           taskIndex   = 0u;
+    u16_t                           messageSize = 0u;
+    GOS_CONST gos_taskDescriptor_t* pTaskDesc   = NULL;
+
+    /*
+     * Function code.
+     */
+    taskSnapshotMessage.messageResult = svl_sysmonCheckMessage(pBuffer, lutIndex);
+    taskSnapshotMessage.taskCount     = 0u;
+
+    if (taskSnapshotMessage.messageResult == SVL_SYSMON_MSG_RES_OK)
+    {
+        GOS_ATOMIC_ENTER
+        taskSnapshotMessage.sysTicks = gos_kernelGetSysTicks();
+
+        for (taskIndex = 0u; taskIndex < CFG_TASK_MAX_NUMBER; taskIndex++)
+        {
+            if (gos_taskGetDescriptorByIndex(taskIndex, &pTaskDesc) == GOS_SUCCESS)
+            {
+                taskSnapshotMessage.tasks[taskIndex].taskId = pTaskDesc->taskId;
+                (void_t) svl_sysmonFillTskVariableData(&taskSnapshotMessage.tasks[taskIndex].taskVariableData, pTaskDesc);
+                taskSnapshotMessage.taskCount++;
+            }
+            else
+            {
+                // Last task found.
+                break;
+            }
+        }
+        GOS_ATOMIC_EXIT
+    }
+    else
+    {
+        // Message error.
+    }
+
+    messageSize = (u16_t)(sizeof(taskSnapshotMessage) -
+            ((CFG_TASK_MAX_NUMBER - taskSnapshotMessage.taskCount) * sizeof(svl_sysmonTaskSnapshotEntry_t)));
+
+    (void_t) gos_gcpTransmitMessage(
+            gcpChannel,                          sysmonLut[lutIndex + 1].messageId,
+            (void_t*)&taskSnapshotMessage,       messageSize,
+            0xFFFF
+            );
+}
+
+/**
+ * @brief   Serves the incoming system monitoring requests of a channel.
+ * @details Receives the requests and hands them over to an idle worker, so a
+ *          slow request does not hold back the following ones.
+ *
+ * @param[in] gcpChannel   GCP channel number to serve.
+ * @param[in] pRxBuffer    Receive buffer of the channel.
+ * @param[in] rxBufferSize Size of the receive buffer.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t svl_sysmonServeChannel (gos_gcpChannelNumber_t gcpChannel, u8_t* pRxBuffer, u16_t rxBufferSize)
 {
     /*
      * Local variables.
      */
-    svl_sysmonMessageEnum_t lutIndex         = 0u;
-    u8_t                    userMessageIndex = 0u;
-    u16_t                   messageId        = 0u;
+    svl_sysmonWorker_t*    pWorker       = NULL;
+    gos_gcpTransactionId_t transactionId = GOS_GCP_NO_TRANSACTION;
+    u16_t                  messageId     = 0u;
+    u8_t                   workerIndex   = 0u;
 
     /*
      * Function code.
@@ -1221,100 +1962,224 @@ GOS_STATIC void_t svl_sysmonWiredDaemonTask (void_t)
         messageId = 0u;
 
         // Check if a message was received.
-        if (gos_gcpReceiveMessage(sysmonConfig.wiredChannelNumber, &messageId, wiredRxBuffer, SVL_SYSMON_WIRED_RX_BUFF_SIZE, 0xFFFF) == GOS_SUCCESS)
+        if (gos_gcpReceiveRequest(gcpChannel, &messageId, &transactionId, pRxBuffer, rxBufferSize, 0xFFFFu) == GOS_SUCCESS)
         {
-    		if (gos_mutexLock(&sysmonMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
-    		{
-                // Get LUT index.
-                lutIndex = svl_sysmonGetLutIndex(messageId);
-                (void_t) gos_mutexUnlock(&sysmonMutex);
-    		}
-    		else
-    		{
-    			// Mutex error.
-    		}
-
-            // Check user registered messages.
-            if ((lutIndex == SVL_SYSMON_MSG_UNKNOWN) || (lutIndex == SVL_SYSMON_MSG_NUM_OF_MESSAGES))
+            // Wait for an idle worker.
+            do
             {
-                for (userMessageIndex = 0u; userMessageIndex < SVL_SYSMON_MAX_USER_MESSAGES; userMessageIndex++)
+                pWorker = NULL;
+
+                GOS_ATOMIC_ENTER
+                for (workerIndex = 0u; workerIndex < SVL_SYSMON_WORKER_NUMBER; workerIndex++)
                 {
-                    if (userMessages[userMessageIndex].messageId == messageId)
+                    if (workers[workerIndex].idle == GOS_TRUE)
                     {
-                    	if (gos_mutexLock(&sysmonMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
-                    	{
-                            // If payload is not NULL, copy it.
-                            if (userMessages[userMessageIndex].payload != NULL)
-                            {
-                                (void_t) memcpy(userMessages[userMessageIndex].payload, (void_t*)wiredRxBuffer, userMessages[userMessageIndex].payloadSize);
-                            }
-                            else
-                            {
-                                // Message has no payload.
-                            }
-
-                            // Call callback function.
-                            if (userMessages[userMessageIndex].callback != NULL)
-                            {
-#if SVL_SYSMON_TRACE_LEVEL > 0
-                                (void_t) gos_traceTraceFormatted(GOS_TRUE, "[Wired] User message received with ID: 0x%04x\r\n", messageId);
-#endif
-                            	userMessages[userMessageIndex].callback(sysmonConfig.wiredChannelNumber);
-                            }
-                            else
-                            {
-                            	// NULL pointer.
-                            }
-
-                    		(void_t) gos_mutexUnlock(&sysmonMutex);
-                    	}
-                    	else
-                    	{
-                    		// Mutex error.
-                    	}
+                        workers[workerIndex].idle = GOS_FALSE;
+                        pWorker                   = &workers[workerIndex];
+                        break;
                     }
                     else
                     {
-                        // Message error.
+                        // Continue searching.
                     }
                 }
+                GOS_ATOMIC_EXIT
+
+                if (pWorker == NULL)
+                {
+                    (void_t) gos_taskSleep(SVL_SYSMON_WORKER_WAIT_MS);
+                }
+                else
+                {
+                    // Worker found.
+                }
+            }
+            while (pWorker == NULL);
+
+            pWorker->channel       = gcpChannel;
+            pWorker->transactionId = transactionId;
+            pWorker->messageId     = messageId;
+            (void_t) memcpy((void_t*)pWorker->rxBuffer, (void_t*)pRxBuffer, rxBufferSize);
+
+            (void_t) gos_triggerIncrement(&pWorker->trigger);
+        }
+        else
+        {
+            // Reception error.
+            (void_t) gos_taskSleep(5);
+        }
+    }
+}
+
+/**
+ * @brief   Dispatches a received system monitoring message.
+ * @details Calls the built-in handler of the message (under the sysmon mutex) or
+ *          the registered user callbacks (under the mutex of their service).
+ *
+ * @param[in] gcpChannel GCP channel number the message was received on.
+ * @param[in] messageId  Message ID.
+ * @param[in] pBuffer    The buffer with the received bytes.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t svl_sysmonDispatchMessage (gos_gcpChannelNumber_t gcpChannel, u16_t messageId, u8_t* pBuffer)
+{
+    /*
+     * Local variables.
+     */
+    svl_sysmonDispatchEntry_t dispatchEntry    = {0};
+    svl_sysmonMessageEnum_t   lutIndex         = SVL_SYSMON_MSG_UNKNOWN;
+    u8_t                      userMessageIndex = 0u;
+    gos_mutex_t*              pUserMutex       = NULL;
+    char_t*                   pChannelName     = (gcpChannel == sysmonConfig.wiredChannelNumber) ? "Wired" : "Wireless";
+
+    /*
+     * Function code.
+     */
+    if (svl_sysmonGetDispatchEntry(messageId, &dispatchEntry) == GOS_FALSE)
+    {
+        // Unknown message ID.
+    }
+    else if (dispatchEntry.type == SVL_SYSMON_DISPATCH_USER)
+    {
+        // Serve every user message registered with this ID.
+        for (userMessageIndex = dispatchEntry.index; userMessageIndex != SVL_SYSMON_USER_MESSAGE_NONE;
+             userMessageIndex = userMessageNext[userMessageIndex])
+        {
+            // Messages of the same service share its buffers, so they are serialized by the service.
+            pUserMutex = (userMessages[userMessageIndex].pServiceMutex != NULL) ?
+                    userMessages[userMessageIndex].pServiceMutex : &userMessageMutex;
+
+            if (gos_mutexLock(pUserMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+            {
+                // If payload is not NULL, copy it.
+                if (userMessages[userMessageIndex].payload != NULL)
+                {
+                    (void_t) memcpy(userMessages[userMessageIndex].payload, (void_t*)pBuffer, userMessages[userMessageIndex].payloadSize);
+                }
+                else
+                {
+                    // Message has no payload.
+                }
+
+                // Call callback function.
+                if (userMessages[userMessageIndex].callback != NULL)
+                {
+                    GOS_TRACE_LOG(sysmonTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "[%s] User message received with ID: 0x%04x\r\n", pChannelName, messageId);
+                    userMessages[userMessageIndex].callback(gcpChannel);
+                }
+                else
+                {
+                    // NULL pointer.
+                }
+
+                (void_t) gos_mutexUnlock(pUserMutex);
             }
             else
             {
-            	if (gos_mutexLock(&sysmonMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
-            	{
-                	// Check if handler exists.
-                    if (sysmonLut[lutIndex].pHandler != NULL)
-                    {
-#if SVL_SYSMON_TRACE_LEVEL > 0
-                        (void_t) gos_traceTraceFormatted(GOS_TRUE, "[Wired] Sysmon message received with ID: 0x%04x\r\n", messageId);
-#endif
-                    	sysmonLut[lutIndex].pHandler(sysmonConfig.wiredChannelNumber, wiredRxBuffer, lutIndex);
-                    }
-                    else
-                    {
-#if SVL_SYSMON_TRACE_LEVEL > 0
-                        (void_t) gos_traceTraceFormatted(GOS_TRUE, "[Wired] Unknown message received with ID: 0x%04x\r\n", messageId);
-#endif
-                        (void_t) svl_sysmonSendResponse(sysmonConfig.wiredChannelNumber, SVL_SYSMON_MSG_UNKNOWN);
-                    }
+                // Mutex error.
+            }
+        }
+    }
+    else
+    {
+        lutIndex = (svl_sysmonMessageEnum_t)dispatchEntry.index;
 
-            		(void_t) gos_mutexUnlock(&sysmonMutex);
-            	}
-            	else
-            	{
-            		// Mutex error.
-            	}
+        // Sysmon handlers share the static message buffers.
+        if (gos_mutexLock(&sysmonMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
+        {
+            // Check if handler exists.
+            if (sysmonLut[lutIndex].pHandler != NULL)
+            {
+                GOS_TRACE_LOG(sysmonTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "[%s] Sysmon message received with ID: 0x%04x\r\n", pChannelName, messageId);
+                sysmonLut[lutIndex].pHandler(gcpChannel, pBuffer, lutIndex);
             }
+            else
+            {
+                GOS_TRACE_LOG(sysmonTraceChannel, GOS_TRACE_LEVEL_INFO, GOS_TRUE, "[%s] Unknown message received with ID: 0x%04x\r\n", pChannelName, messageId);
+                (void_t) svl_sysmonSendResponse(gcpChannel, SVL_SYSMON_MSG_UNKNOWN);
+            }
+
+            (void_t) gos_mutexUnlock(&sysmonMutex);
         }
         else
         {
-            // Reception error.
-            (void_t) gos_taskSleep(5);
+            // Mutex error.
+        }
+    }
+}
+
+/**
+ * @brief   System monitoring request worker task.
+ * @details Serves the requests handed over by the daemons. The worker is bound to
+ *          the transaction of the request, so the messages sent by the handlers are
+ *          its responses.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t svl_sysmonWorkerTask (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_tid_t           ownTaskId   = GOS_INVALID_TASK_ID;
+    svl_sysmonWorker_t* pWorker     = NULL;
+    u8_t                workerIndex = 0u;
+
+    /*
+     * Function code.
+     */
+    (void_t) gos_taskGetCurrentId(&ownTaskId);
+
+    for (workerIndex = 0u; workerIndex < SVL_SYSMON_WORKER_NUMBER; workerIndex++)
+    {
+        if (workers[workerIndex].taskDescriptor.taskId == ownTaskId)
+        {
+            pWorker = &workers[workerIndex];
+            break;
+        }
+        else
+        {
+            // Nothing to do.
+        }
+    }
+
+    for (;;)
+    {
+        if (pWorker == NULL)
+        {
+            // Unknown worker, should not happen.
+            (void_t) gos_taskSuspend(ownTaskId);
+        }
+        else
+        {
+            (void_t) gos_triggerWait(&pWorker->trigger, 1u, GOS_TRIGGER_ENDLESS_TMO);
+            (void_t) gos_triggerReset(&pWorker->trigger);
+
+            (void_t) gos_gcpBindTransaction(pWorker->channel, pWorker->transactionId);
+            svl_sysmonDispatchMessage(pWorker->channel, pWorker->messageId, pWorker->rxBuffer);
+            (void_t) gos_gcpBindTransaction(pWorker->channel, GOS_GCP_NO_TRANSACTION);
+
+            pWorker->idle = GOS_TRUE;
         }
     }
 }
 
+/**
+ * @brief   System monitoring wired daemon task.
+ * @details Serves the incoming system monitoring requests
+ *          on the wired GCP channel.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t svl_sysmonWiredDaemonTask (void_t)
+{
+    /*
+     * Function code.
+     */
+    svl_sysmonServeChannel(sysmonConfig.wiredChannelNumber, wiredRxBuffer, SVL_SYSMON_WIRED_RX_BUFF_SIZE);
+}
+
 /**
  * @brief   System monitoring wireless daemon task.
  * @details Serves the incoming system monitoring requests
@@ -1323,115 +2188,261 @@ GOS_STATIC void_t svl_sysmonWiredDaemonTask (void_t)
  * @return  -
  */
 GOS_STATIC void_t svl_sysmonWirelessDaemonTask (void_t)
+{
+    /*
+     * Function code.
+     */
+    (void_t) gos_taskSleep(3000);
+
+    svl_sysmonServeChannel(sysmonConfig.wirelessChannelNumber, wirelessRxBuffer, SVL_SYSMON_WIRELESS_RX_BUFF_SIZE);
+}
+
+/**
+ * @brief   Fills the CPU usage telemetry record.
+ * @details Copies the current CPU usage to the record buffer.
+ *
+ * @param[in]  index      Record index.
+ * @param[out] pBuffer    Record buffer.
+ * @param[in]  bufferSize Size of the record buffer.
+ *
+ * @return  Size of the record (0 if there is no record with the given index).
+ */
+GOS_STATIC u16_t svl_sysmonTelemetryFillCpu (u8_t index, u8_t* pBuffer, u16_t bufferSize)
 {
     /*
      * Local variables.
      */
-    svl_sysmonMessageEnum_t lutIndex         = 0u;
-    u8_t                    userMessageIndex = 0u;
-    u16_t                   messageId        = 0u;
+    u16_t recordSize = 0u;
+    u16_t cpuUsage   = 0u;
 
     /*
      * Function code.
      */
-    (void_t) gos_taskSleep(3000);
+    if ((index == 0u) && (bufferSize >= sizeof(cpuUsage)))
+    {
+        cpuUsage   = gos_kernelGetCpuUsage();
+        recordSize = sizeof(cpuUsage);
+        (void_t) memcpy((void_t*)pBuffer, (void_t*)&cpuUsage, recordSize);
+    }
+    else
+    {
+        // No more records.
+    }
 
-    for (;;)
+    return recordSize;
+}
+
+/**
+ * @brief   Fills the task variable data telemetry record.
+ * @details Copies the variable data of the task with the given index to the record
+ *          buffer.
+ *
+ * @param[in]  index      Record (task) index.
+ * @param[out] pBuffer    Record buffer.
+ * @param[in]  bufferSize Size of the record buffer.
+ *
+ * @return  Size of the record (0 if there is no task with the given index).
+ */
+GOS_STATIC u16_t svl_sysmonTelemetryFillTasks (u8_t index, u8_t* pBuffer, u16_t bufferSize)
+{
+    /*
+     * Local variables.
+     */
+    u16_t recordSize = 0u;
+
+    /*
+     * Function code.
+     */
+    if ((bufferSize >= sizeof(svl_sysmonTaskVariableData_t)) &&
+        (gos_taskGetDataByIndex(index, &telemetryTaskDesc) == GOS_SUCCESS))
     {
-        // Reset message ID.
-        messageId = 0u;
+        (void_t) svl_sysmonFillTskVariableData((svl_sysmonTaskVariableData_t*)pBuffer, &telemetryTaskDesc);
+        recordSize = sizeof(svl_sysmonTaskVariableData_t);
+    }
+    else
+    {
+        // No more records.
+    }
 
-        // Check if a message was received.
-        if (gos_gcpReceiveMessage(sysmonConfig.wirelessChannelNumber, &messageId, wirelessRxBuffer, SVL_SYSMON_WIRELESS_RX_BUFF_SIZE, 0xFFFFu) == GOS_SUCCESS)
+    return recordSize;
+}
+
+/**
+ * @brief   Builds a telemetry frame.
+ * @details Collects the records of the subscribed items in the frame buffer. Records
+ *          that are equal to the ones in the previous sample are sent as a header
+ *          only, unless a key frame is built. The full records are kept as the
+ *          previous sample for the next frame.
+ *
+ * @param[in] sequence Frame sequence number.
+ * @param[in] itemMask Subscribed items.
+ * @param[in] keyFrame Key frame flag.
+ *
+ * @return  Size of the frame.
+ */
+GOS_STATIC u16_t svl_sysmonTelemetryBuildFrame (u16_t sequence, u32_t itemMask, bool_t keyFrame)
+{
+    /*
+     * Local variables.
+     */
+    svl_sysmonTelemetryFrameHeader_t  frameHeader  = {0};
+    svl_sysmonTelemetryRecordHeader_t recordHeader = {0};
+    u16_t                             framePos     = sizeof(frameHeader);
+    u16_t                             samplePos    = 0u;
+    u16_t                             available    = 0u;
+    u16_t                             recordSize   = 0u;
+    u8_t                              itemId       = 0u;
+    u16_t                             index        = 0u;
+    u8_t*                             pRecordData  = NULL;
+
+    /*
+     * Function code.
+     */
+    frameHeader.sequence = sequence;
+    frameHeader.flags    = (keyFrame == GOS_TRUE) ? SVL_SYSMON_TELEMETRY_FRAME_KEY : 0u;
+
+    for (itemId = 0u; itemId < SVL_SYSMON_TELEMETRY_ITEM_NUM; itemId++)
+    {
+        if (((itemMask & (1u << itemId)) != 0u) && (telemetryFillFunctions[itemId] != NULL))
         {
-    		if (gos_mutexLock(&sysmonMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
-    		{
-                // Get LUT index.
-                lutIndex = svl_sysmonGetLutIndex(messageId);
-                (void_t) gos_mutexUnlock(&sysmonMutex);
-    		}
-    		else
-    		{
-    			// Mutex error.
-    		}
-
-            // Check user registered messages.
-            if ((lutIndex == SVL_SYSMON_MSG_UNKNOWN) || (lutIndex == SVL_SYSMON_MSG_NUM_OF_MESSAGES))
+            for (index = 0u; index <= 0xFFu; index++)
             {
-                for (userMessageIndex = 0u; userMessageIndex < SVL_SYSMON_MAX_USER_MESSAGES; userMessageIndex++)
+                // The sample contains every record in full, so it can be longer than the frame.
+                available = SVL_SYSMON_TELEMETRY_BUFF_SIZE - ((framePos > samplePos) ? framePos : samplePos);
+
+                if (available <= sizeof(recordHeader))
                 {
-                    if (userMessages[userMessageIndex].messageId == messageId)
-                    {
-                    	if (gos_mutexLock(&sysmonMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
-                    	{
-                            // If payload is not NULL, copy it.
-                            if (userMessages[userMessageIndex].payload != NULL)
-                            {
-                                (void_t) memcpy(userMessages[userMessageIndex].payload, (void_t*)wirelessRxBuffer, userMessages[userMessageIndex].payloadSize);
-                            }
-                            else
-                            {
-                                // Message has no payload.
-                            }
-
-                            // Call callback function.
-                            if (userMessages[userMessageIndex].callback != NULL)
-                            {
-#if SVL_SYSMON_TRACE_LEVEL > 0
-                                (void_t) gos_traceTraceFormatted(GOS_TRUE, "[Wireless] User message received with ID: 0x%04x\r\n", messageId);
-#endif
-                            	userMessages[userMessageIndex].callback(sysmonConfig.wirelessChannelNumber);
-                            }
-                            else
-                            {
-                            	// NULL pointer.
-                            }
-
-                    		(void_t) gos_mutexUnlock(&sysmonMutex);
-                    	}
-                    	else
-                    	{
-                    		// Mutex error.
-                    	}
-                    }
-                    else
-                    {
-                        // Message error.
-                    }
+                    frameHeader.flags |= SVL_SYSMON_TELEMETRY_FRAME_TRUNCATED;
+                    break;
                 }
-            }
-            else
-            {
-            	if (gos_mutexLock(&sysmonMutex, GOS_MUTEX_ENDLESS_TMO) == GOS_SUCCESS)
-            	{
-                	// Check if handler exists.
-                    if (sysmonLut[lutIndex].pHandler != NULL)
-                    {
-#if SVL_SYSMON_TRACE_LEVEL > 0
-                        (void_t) gos_traceTraceFormatted(GOS_TRUE, "[Wireless] Sysmon message received with ID: 0x%04x\r\n", messageId);
-#endif
-                    	sysmonLut[lutIndex].pHandler(sysmonConfig.wirelessChannelNumber, wirelessRxBuffer, lutIndex);
-                    }
-                    else
-                    {
-#if SVL_SYSMON_TRACE_LEVEL > 0
-                        (void_t) gos_traceTraceFormatted(GOS_TRUE, "[Wireless] Unknown message received with ID: 0x%04x\r\n", messageId);
-#endif
-                        (void_t) svl_sysmonSendResponse(sysmonConfig.wirelessChannelNumber, SVL_SYSMON_MSG_UNKNOWN);
-                    }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                pRecordData = &telemetryFrame[framePos + sizeof(recordHeader)];
+                recordSize  = telemetryFillFunctions[itemId]((u8_t)index, pRecordData, available - sizeof(recordHeader));
 
-            		(void_t) gos_mutexUnlock(&sysmonMutex);
-            	}
-            	else
-            	{
-            		// Mutex error.
-            	}
+                if (recordSize == 0u)
+                {
+                    // Last record of the item.
+                    break;
+                }
+                else
+                {
+                    // Nothing to do.
+                }
+
+                recordHeader.itemId = itemId;
+                recordHeader.index  = (u8_t)index;
+                recordHeader.flags  = 0u;
+                recordHeader.size   = recordSize;
+
+                if ((keyFrame == GOS_FALSE) &&
+                    ((samplePos + sizeof(recordHeader) + recordSize) <= telemetrySampleSize) &&
+                    (memcmp((void_t*)&telemetrySample[samplePos], (void_t*)&recordHeader, sizeof(recordHeader)) == 0) &&
+                    (memcmp((void_t*)&telemetrySample[samplePos + sizeof(recordHeader)], (void_t*)pRecordData, recordSize) == 0))
+                {
+                    // Unchanged, drop the data.
+                    recordHeader.flags = SVL_SYSMON_TELEMETRY_REC_UNCHANGED;
+                    (void_t) memcpy((void_t*)&telemetryFrame[framePos], (void_t*)&recordHeader, sizeof(recordHeader));
+                    framePos += sizeof(recordHeader);
+                }
+                else
+                {
+                    // Changed, keep the data in the frame and update the sample.
+                    (void_t) memcpy((void_t*)&telemetryFrame[framePos], (void_t*)&recordHeader, sizeof(recordHeader));
+                    (void_t) memcpy((void_t*)&telemetrySample[samplePos], (void_t*)&recordHeader, sizeof(recordHeader));
+                    (void_t) memcpy((void_t*)&telemetrySample[samplePos + sizeof(recordHeader)], (void_t*)pRecordData, recordSize);
+                    framePos += sizeof(recordHeader) + recordSize;
+                }
+
+                samplePos += sizeof(recordHeader) + recordSize;
+                frameHeader.recordCount++;
             }
         }
         else
         {
-            // Reception error.
-            //(void_t) gos_taskSleep(10);
+            // Item not subscribed.
+        }
+
+        if ((frameHeader.flags & SVL_SYSMON_TELEMETRY_FRAME_TRUNCATED) != 0u)
+        {
+            break;
+        }
+        else
+        {
+            // Continue with the next item.
+        }
+    }
+
+    telemetrySampleSize = samplePos;
+    (void_t) memcpy((void_t*)telemetryFrame, (void_t*)&frameHeader, sizeof(frameHeader));
+
+    return framePos;
+}
+
+/**
+ * @brief   System monitoring telemetry publisher task.
+ * @details Sends the subscribed items periodically as one batched frame on the
+ *          channel of the subscription. Every #SVL_SYSMON_TELEMETRY_KEYFRAME_PERIOD
+ *          frame, and the first frame after a subscription change are key frames.
+ *
+ * @return  -
+ */
+GOS_STATIC void_t svl_sysmonTelemetryTask (void_t)
+{
+    /*
+     * Local variables.
+     */
+    gos_gcpChannelNumber_t channel   = 0u;
+    u16_t                  period    = 0u;
+    u32_t                  itemMask  = 0u;
+    bool_t                 restart   = GOS_FALSE;
+    u16_t                  sequence  = 0u;
+    u16_t                  frameSize = 0u;
+
+    /*
+     * Function code.
+     */
+    for (;;)
+    {
+        GOS_ATOMIC_ENTER
+        channel                       = telemetrySubscription.channel;
+        period                        = telemetrySubscription.period;
+        itemMask                      = telemetrySubscription.itemMask;
+        restart                       = telemetrySubscription.restart;
+        telemetrySubscription.restart = GOS_FALSE;
+        GOS_ATOMIC_EXIT
+
+        if (period == 0u)
+        {
+            // No subscription, wait for one.
+            (void_t) gos_triggerWait(&telemetryTrigger, 1u, GOS_TRIGGER_ENDLESS_TMO);
+            (void_t) gos_triggerReset(&telemetryTrigger);
+        }
+        else
+        {
+            if (restart == GOS_TRUE)
+            {
+                sequence = 0u;
+            }
+            else
+            {
+                // Nothing to do.
+            }
+
+            frameSize = svl_sysmonTelemetryBuildFrame(sequence, itemMask,
+                    ((sequence % SVL_SYSMON_TELEMETRY_KEYFRAME_PERIOD) == 0u) ? GOS_TRUE : GOS_FALSE);
+
+            (void_t) gos_gcpTransmitMessage(channel, SVL_SYSMON_MSG_TELEMETRY_DATA_ID,
+                    (void_t*)telemetryFrame, frameSize, 0xFFFF);
+
+            sequence++;
+
+            // Sleep for the period, or until the subscription changes.
+            (void_t) gos_triggerWait(&telemetryTrigger, 1u, period);
+            (void_t) gos_triggerReset(&telemetryTrigger);
         }
     }
 }
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       app_init.c
 //! @author     Ahmed Gazar
-//! @date       2025-09-10
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.1
 //!
 //! @brief      Digital Step Sequencer / Application / Initializer source.
 //! @details    This component contains the platform and application initialization.
@@ -25,6 +25,7 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2025-09-09    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    Trace binary transmit driver registered
 //*************************************************************************************************
 //
 // Copyright (c) 2025 Ahmed Gazar
@@ -60,6 +61,7 @@ GOS_STATIC gos_driver_functions_t driverFunctions =
 {
 	.traceDriverTransmitString       = drv_traceTransmit,
 	.traceDriverTransmitStringUnsafe = drv_traceTransmitUnsafe,
+	.traceDriverTransmitBinary       = drv_traceTransmitBinary,
 	.timerDriverSysTimerGetValue     = drv_systimerGetValue,
 };
 
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       dsm_cfg.c
 //! @author     Ahmed Gazar
-//! @date       2025-09-10
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.1
 //!
 //! @brief      Digital Step Sequencer / SVL Configuration / DSM configuration source.
 //! @details    This file contains the configuration parameters of the DSM service.
@@ -25,6 +25,7 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2025-09-10    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    CRC driver initialization added
 //*************************************************************************************************
 //
 // Copyright (c) 2025 Ahmed Gazar
@@ -98,6 +99,7 @@ GOS_CONST svl_dsmInitPhaseDesc_t platformInitPhaseConfig [] =
 			{ "DMA driver initialization",           drv_dmaInit                },
 			{ "UART driver initialization",          drv_uartInit               },
 			{ "IT driver initialization",            drv_itInit                 },
+			{ "CRC driver initialization",           drv_crcInit                },
 		}
 	},
 };
@@ -14,8 +14,8 @@
 //*************************************************************************************************
 //! @file       sysmon_cfg.c
 //! @author     Ahmed Gazar
-//! @date       2025-09-10
-//! @version    1.0
+//! @date       2026-10-19
+//! @version    1.1
 //!
 //! @brief      Digital Step Sequencer / SVL Configuration / System Monitoring configuration source.
 //! @details    This file contains the configuration parameters of the DSM service.
@@ -25,6 +25,7 @@
 // Version    Date          Author          Description
 // ------------------------------------------------------------------------------------------------
 // 1.0        2025-09-10    Ahmed Gazar     Initial version created.
+// 1.1        2026-10-19    Ahmed Gazar     +    Vectored TX functions added
 //*************************************************************************************************
 //
 // Copyright (c) 2025 Ahmed Gazar
@@ -58,10 +59,12 @@
  */
 GOS_CONST svl_sysmonServiceConfig_t sysmonConfig =
 {
-	.wiredChannelNumber    = 0u,
-	.wiredTxFunction       = drv_sysmonWiredTransmit,
-	.wiredRxFunction       = drv_sysmonWiredReceive,
-	.wirelessChannelNumber = 0u,
-	.wirelessTxFunction    = NULL,
-	.wirelessRxFunction    = NULL
+	.wiredChannelNumber       = 0u,
+	.wiredTxFunction          = drv_sysmonWiredTransmit,
+	.wiredTxVectorFunction    = drv_sysmonWiredTransmitVector,
+	.wiredRxFunction          = drv_sysmonWiredReceive,
+	.wirelessChannelNumber    = 0u,
+	.wirelessTxFunction       = NULL,
+	.wirelessTxVectorFunction = NULL,
+	.wirelessRxFunction       = NULL
 };